@@ -16,6 +16,7 @@
 
 #include "../audio/audio.hpp"
 #include "../core/game_core.hpp"
+#include "../core/camera.hpp"
 #include "../level/level.hpp"
 #include "../overworld/overworld.hpp"
 #include "../user/preferences.hpp"
@@ -29,12 +30,45 @@ using namespace std;
 namespace fs = boost::filesystem;
 
 namespace TSC {
+
+float Get_Distance_Volume_Mod(float distance, float reduction_begin, float reduction_end)
+{
+    // if in volume reduction range
+    if (distance > reduction_begin) {
+        if (distance >= reduction_end) {
+            return 0.0f;
+        }
+
+        return 1.0f - (distance - reduction_begin) / (reduction_end - reduction_begin);
+    }
+
+    // no reduction
+    return 1.0f;
+}
+
+float Get_Camera_Distance(float pos_x, float pos_y)
+{
+    // get distance from camera center position
+    float dx = fabs(pActive_Camera->m_x + (game_res_w * 0.5f) - pos_x);
+    float dy = fabs(pActive_Camera->m_y + (game_res_h * 0.5f) - pos_y);
+
+    return sqrt(dx * dx + dy * dy);
+}
+
 /* *** *** *** *** *** *** *** *** Audio Sound *** *** *** *** *** *** *** *** *** */
 
 cAudio_Sound::cAudio_Sound(void)
 {
     m_data = NULL;
     m_resource_id = -1;
+    m_priority = SOUND_PRIORITY_NORMAL;
+    m_start_ticks = 0;
+    m_volume = 0.0f;
+    m_positional = 0;
+    m_pos_x = 0.0f;
+    m_pos_y = 0.0f;
+    m_volume_reduction_begin = 0.0f;
+    m_volume_reduction_end = 0.0f;
 }
 
 cAudio_Sound::~cAudio_Sound(void)
@@ -59,6 +93,8 @@ void cAudio_Sound::Free(void)
     }
 
     m_resource_id = -1;
+    m_priority = SOUND_PRIORITY_NORMAL;
+    m_positional = 0;
 }
 
 bool cAudio_Sound::Play(int use_res_id /* = -1 */, bool loops /* = false */)
@@ -85,6 +121,7 @@ bool cAudio_Sound::Play(int use_res_id /* = -1 */, bool loops /* = false */)
     }
 
     m_resource_id = use_res_id;
+    m_start_ticks = TSC_GetTicks();
     // play sound
     m_sound.setBuffer(m_data->m_buffer);
     m_sound.play();
@@ -92,6 +129,30 @@ bool cAudio_Sound::Play(int use_res_id /* = -1 */, bool loops /* = false */)
     return 1;
 }
 
+void cAudio_Sound::Set_Position(float pos_x, float pos_y, float reduction_begin, float reduction_end)
+{
+    m_positional = 1;
+    m_pos_x = pos_x;
+    m_pos_y = pos_y;
+    m_volume_reduction_begin = reduction_begin;
+    m_volume_reduction_end = reduction_end;
+
+    Update_Position();
+}
+
+bool cAudio_Sound::Update_Position(void)
+{
+    const float distance = Get_Camera_Distance(m_pos_x, m_pos_y);
+
+    if (distance >= m_volume_reduction_end) {
+        return 0;
+    }
+
+    m_sound.setVolume(m_volume * Get_Distance_Volume_Mod(distance, m_volume_reduction_begin, m_volume_reduction_end));
+
+    return 1;
+}
+
 void cAudio_Sound::Stop(void)
 {
     // if not loaded
@@ -104,6 +165,8 @@ void cAudio_Sound::Stop(void)
 
 /* *** *** *** *** *** *** *** *** Audio *** *** *** *** *** *** *** *** *** */
 
+const unsigned int cAudio::m_max_identical_sounds = 4;
+
 cAudio::cAudio(void)
 {
     m_initialised = 0;
@@ -111,6 +174,11 @@ cAudio::cAudio(void)
     m_music_enabled = 0;
 
     m_debug = 0;
+    m_max_sounds = 0;
+
+    m_voices_stolen = 0;
+    m_voices_dropped = 0;
+    m_voices_culled = 0;
 
     m_sound_volume = cPreferences::m_sound_volume_default;
     m_music_volume = cPreferences::m_music_volume_default;
@@ -164,7 +232,7 @@ bool cAudio::Init(void)
         m_sound_enabled = 0;
     }
 
-    m_max_sounds = 100; // XXX: what???
+    m_max_sounds = 100;
 
     return 1;
 }
@@ -202,28 +270,32 @@ void cAudio::Close(bool close_sound/*=true*/, bool close_music/*=true*/)
     m_fade_direction = FadeDirection::NONE;
 }
 
-cSound* cAudio::Get_Sound_File(fs::path filename) const
+cSound* cAudio::Get_Sound_File(const fs::path& filename) const
 {
     if (!m_initialised || !m_sound_enabled) {
         return NULL;
     }
 
-    // not available
-    if (!File_Exists(filename)) {
-        // add sound directory if required
-        if (!filename.is_absolute())
-            filename = pResource_Manager->Get_Game_Sounds_Directory() / filename;
+    return Get_Sound_File(Get_Sound_Handle(filename));
+}
+
+cSound* cAudio::Get_Sound_File(Sound_Handle handle) const
+{
+    if (!m_initialised || !m_sound_enabled || !handle) {
+        return NULL;
     }
 
-    cSound* sound = pSound_Manager->Get_Pointer(filename);
+    cSound* sound = pSound_Manager->Get_Handle_Sound(handle);
 
     // if not already cached
     if (!sound) {
+        const fs::path& filename = pSound_Manager->Get_Handle_Filename(handle);
+
         sound = new cSound();
 
         // loaded sound
         if (sound->Load(filename)) {
-            pSound_Manager->Add(sound);
+            pSound_Manager->Add(sound, handle);
 
             if (m_debug) {
                 cout << "Loaded sound file : " << filename.c_str() << endl;
@@ -231,6 +303,7 @@ cSound* cAudio::Get_Sound_File(fs::path filename) const
         }
         // failed loading
         else {
+            cerr << "Warning: Could not load sound file '" << path_to_utf8(filename) << "'" << endl;
             delete sound;
             return NULL;
         }
@@ -239,48 +312,92 @@ cSound* cAudio::Get_Sound_File(fs::path filename) const
     return sound;
 }
 
-bool cAudio::Play_Sound(fs::path filename, int res_id /* = -1 */, int volume /* = -1 */, bool loops /* = false */)
+Sound_Handle cAudio::Get_Sound_Handle(const fs::path& filename) const
+{
+    return pSound_Manager->Get_Handle(filename);
+}
+
+bool cAudio::Play_Sound(const fs::path& filename, int res_id /* = -1 */, int volume /* = -1 */, bool loops /* = false */, Sound_Priority priority /* = SOUND_PRIORITY_NORMAL */)
 {
     if (!m_initialised || !m_sound_enabled) {
         return 0;
     }
 
-    // not available
-    if (!File_Exists(filename)) {
-        // add sound directory
-        if (!filename.is_absolute())
-            filename = pResource_Manager->Get_Game_Sounds_Directory() / filename;
+    return Play_Sound(Get_Sound_Handle(filename), res_id, volume, loops, priority);
+}
 
-        // not found
-        if (!File_Exists(filename)) {
-            cerr << "Warning: Could not find sound file '" << path_to_utf8(filename) << "'" << endl;
-            return false;
-        }
+bool cAudio::Play_Sound(Sound_Handle handle, int res_id /* = -1 */, int volume /* = -1 */, bool loops /* = false */, Sound_Priority priority /* = SOUND_PRIORITY_NORMAL */)
+{
+    return Play_Voice(handle, res_id, volume, loops, priority) != NULL;
+}
+
+bool cAudio::Play_Sound(Game_Sound sound, int res_id /* = -1 */, int volume /* = -1 */, bool loops /* = false */, Sound_Priority priority /* = SOUND_PRIORITY_NORMAL */)
+{
+    return Play_Voice(pSound_Manager->Get_Game_Sound(sound), res_id, volume, loops, priority) != NULL;
+}
+
+bool cAudio::Play_Sound_At(Sound_Handle handle, float pos_x, float pos_y, int volume /* = -1 */, bool loops /* = false */, Sound_Priority priority /* = SOUND_PRIORITY_NORMAL */, float reduction_begin /* = 400.0f */, float reduction_end /* = 1000.0f */)
+{
+    if (!m_initialised || !m_sound_enabled) {
+        return 0;
+    }
+
+    // out of range
+    if (Get_Camera_Distance(pos_x, pos_y) >= reduction_end) {
+        m_voices_culled++;
+        return 0;
+    }
+
+    cAudio_Sound* sound = Play_Voice(handle, -1, volume, loops, priority);
+
+    if (!sound) {
+        return 0;
+    }
+
+    sound->Set_Position(pos_x, pos_y, reduction_begin, reduction_end);
+
+    return 1;
+}
+
+cAudio_Sound* cAudio::Play_Voice(Sound_Handle handle, int res_id, int volume, bool loops, Sound_Priority priority)
+{
+    if (!m_initialised || !m_sound_enabled) {
+        return NULL;
+    }
+
+    // not found, already reported
+    if (!handle) {
+        return NULL;
     }
 
-    cSound* sound_data = Get_Sound_File(filename);
+    cSound* sound_data = Get_Sound_File(handle);
 
     // failed loading
     if (!sound_data) {
-        cerr << "Warning: Could not load sound file '" << path_to_utf8(filename) << "'" << endl;
-        return false;
+        return NULL;
+    }
+
+    // sounds replacing each other are important
+    if (res_id >= 0 && priority < SOUND_PRIORITY_HIGH) {
+        priority = SOUND_PRIORITY_HIGH;
     }
 
     // create channel
-    cAudio_Sound* sound = Create_Sound_Channel();
+    cAudio_Sound* sound = Create_Sound_Channel(sound_data, priority);
 
     if (!sound) {
         // no free channel available
-        return 0;
+        return NULL;
     }
 
     // load data
     sound->Load(sound_data);
+    sound->m_priority = priority;
 
     // failed to play
     if (!sound->Play(res_id, loops)) {
-        debug_print("Could not play sound file : %s\n", path_to_utf8(filename).c_str());
-        return 0;
+        debug_print("Could not play sound file : %s\n", path_to_utf8(sound_data->m_filename).c_str());
+        return NULL;
     }
     // playing successfully
     else {
@@ -295,10 +412,11 @@ bool cAudio::Play_Sound(fs::path filename, int res_id /* = -1 */, int volume /*
         }
 
         // set volume
-        sound->m_sound.setVolume(volume);
+        sound->m_volume = static_cast<float>(volume);
+        sound->m_sound.setVolume(sound->m_volume);
     }
 
-    return 1;
+    return sound;
 }
 
 bool cAudio::Play_Music(fs::path filename, bool loops /* = false */, bool force /* = 1 */, unsigned int fadein_ms /* = 0 */)
@@ -354,28 +472,35 @@ bool cAudio::Play_Music(fs::path filename, bool loops /* = false */, bool force
     return true;
 }
 
-cAudio_Sound* cAudio::Get_Playing_Sound(fs::path filename)
+cAudio_Sound* cAudio::Get_Playing_Sound(const fs::path& filename)
 {
     if (!m_sound_enabled || !m_initialised) {
         return NULL;
     }
 
-    // add sound directory
-    if (!filename.is_absolute())
-        filename = pResource_Manager->Get_Game_Sounds_Directory() / filename;
+    return Get_Playing_Sound(Get_Sound_Handle(filename));
+}
+
+cAudio_Sound* cAudio::Get_Playing_Sound(Sound_Handle handle)
+{
+    if (!m_sound_enabled || !m_initialised) {
+        return NULL;
+    }
+
+    const cSound* sound_data = pSound_Manager->Get_Handle_Sound(handle);
+
+    // never played
+    if (!sound_data) {
+        return NULL;
+    }
 
     // get all sounds
     for (AudioSoundList::const_iterator itr = m_active_sounds.begin(); itr != m_active_sounds.end(); ++itr) {
         // get object pointer
         cAudio_Sound* obj = (*itr);
 
-        // if not playing
-        if (obj->m_sound.getStatus() != sf::SoundSource::Playing) {
-            continue;
-        }
-
         // found it
-        if (obj->m_data->m_filename.compare(filename) == 0) {
+        if (obj->m_data == sound_data && obj->m_sound.getStatus() == sf::SoundSource::Playing) {
             // return first found
             return obj;
         }
@@ -385,21 +510,62 @@ cAudio_Sound* cAudio::Get_Playing_Sound(fs::path filename)
     return NULL;
 }
 
-cAudio_Sound* cAudio::Create_Sound_Channel(void)
+cAudio_Sound* cAudio::Create_Sound_Channel(const cSound* data, Sound_Priority priority)
 {
     assert(m_max_sounds > 0);
 
+    cAudio_Sound* free_sound = NULL;
+    // oldest playing identical sound
+    cAudio_Sound* oldest_identical = NULL;
+    unsigned int identical_count = 0;
+    // least important playing sound
+    cAudio_Sound* victim = NULL;
+
     // get all sounds
     for (AudioSoundList::iterator itr = m_active_sounds.begin(); itr != m_active_sounds.end(); ++itr) {
         // get object pointer
         cAudio_Sound* obj = (*itr);
 
         // if not playing
-        if (obj->m_sound.getStatus() != sf::SoundSource::Playing) {
-            // found a free channel
-            obj->Free();
-            return obj;
+        if (!obj->Is_Playing()) {
+            if (!free_sound) {
+                free_sound = obj;
+            }
+
+            continue;
+        }
+
+        if (obj->m_data == data) {
+            identical_count++;
+
+            if (!oldest_identical || obj->m_start_ticks < oldest_identical->m_start_ticks) {
+                oldest_identical = obj;
+            }
+        }
+
+        // can not take more important sounds
+        if (obj->m_priority > priority) {
+            continue;
         }
+
+        // lowest priority, then quietest, then oldest
+        if (!victim || obj->m_priority < victim->m_priority ||
+            (obj->m_priority == victim->m_priority && (obj->m_volume < victim->m_volume ||
+            (obj->m_volume == victim->m_volume && obj->m_start_ticks < victim->m_start_ticks)))) {
+            victim = obj;
+        }
+    }
+
+    // too many identical sounds, restart the oldest
+    if (identical_count >= m_max_identical_sounds) {
+        oldest_identical->Free();
+        return oldest_identical;
+    }
+
+    // found a free channel
+    if (free_sound) {
+        free_sound->Free();
+        return free_sound;
     }
 
     // if not maximum sounds
@@ -409,10 +575,47 @@ cAudio_Sound* cAudio::Create_Sound_Channel(void)
         return sound;
     }
 
+    if (victim) {
+        m_voices_stolen++;
+        victim->Free();
+        return victim;
+    }
+
     // none found
+    m_voices_dropped++;
     return NULL;
 }
 
+unsigned int cAudio::Get_Playing_Voice_Count(void) const
+{
+    unsigned int count = 0;
+
+    for (AudioSoundList::const_iterator itr = m_active_sounds.begin(); itr != m_active_sounds.end(); ++itr) {
+        if ((*itr)->Is_Playing()) {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+void cAudio::Update_Voices(void)
+{
+    for (AudioSoundList::iterator itr = m_active_sounds.begin(); itr != m_active_sounds.end(); ++itr) {
+        cAudio_Sound* obj = (*itr);
+
+        if (!obj->m_positional || !obj->Is_Playing()) {
+            continue;
+        }
+
+        // out of range
+        if (!obj->Update_Position()) {
+            obj->Stop();
+            m_voices_culled++;
+        }
+    }
+}
+
 void cAudio::Toggle_Music(void)
 {
     pPreferences->m_audio_music = !pPreferences->m_audio_music;
@@ -562,6 +765,10 @@ void cAudio::Set_Music_Volume(uint8_t volume)
 
 void cAudio::Update(void)
 {
+    if (m_initialised && m_sound_enabled) {
+        Update_Voices();
+    }
+
     if (!m_initialised || !m_music_enabled) {
         return;
     }
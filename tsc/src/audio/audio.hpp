@@ -53,6 +53,25 @@ namespace TSC {
         RID_MOON            = 7
     };
 
+    /* Sound priorities
+     * When all voices are used a sound may only take the voice of a
+     * sound with the same or a lower priority.
+    */
+    enum Sound_Priority {
+        // ambient and collectible sounds
+        SOUND_PRIORITY_LOW = 0,
+        SOUND_PRIORITY_NORMAL = 1,
+        // player and boss sounds
+        SOUND_PRIORITY_HIGH = 2
+    };
+
+    /* Returns the volume modifier for the distance to the camera center
+     * Full volume up to reduction_begin, then falling down to silence at reduction_end.
+    */
+    float Get_Distance_Volume_Mod(float distance, float reduction_begin, float reduction_end);
+    // Returns the distance of the given position to the camera center
+    float Get_Camera_Distance(float pos_x, float pos_y);
+
     /* *** *** *** *** *** *** *** Audio Sound object *** *** *** *** *** *** *** *** *** *** */
 
 // Callback for a sound finished playing
@@ -77,6 +96,19 @@ namespace TSC {
         bool Play(int use_res_id = -1, bool loops = false);
         // Stop the Sound if playing
         void Stop(void);
+        // Returns true if playing
+        bool Is_Playing(void) const
+        {
+            return m_data && m_sound.getStatus() == sf::SoundSource::Playing;
+        }
+
+        /* Play at the given position
+         * The volume is reduced with the distance to the camera center
+         * and the sound is stopped once it is out of range.
+        */
+        void Set_Position(float pos_x, float pos_y, float reduction_begin, float reduction_end);
+        // Update the volume from the distance, returns false if out of range
+        bool Update_Position(void);
 
         // sound object
         cSound* m_data;
@@ -85,6 +117,19 @@ namespace TSC {
         sf::Sound m_sound;
         // the last used resource id
         int m_resource_id;
+        // priority when voices are stolen
+        Sound_Priority m_priority;
+        // time when started playing
+        uint32_t m_start_ticks;
+        // volume without the distance modifier
+        float m_volume;
+
+        // if set the volume depends on the distance to the camera
+        bool m_positional;
+        float m_pos_x;
+        float m_pos_y;
+        float m_volume_reduction_begin;
+        float m_volume_reduction_end;
     };
 
     typedef vector<cAudio_Sound*> AudioSoundList;
@@ -122,21 +167,43 @@ namespace TSC {
         /* Check if the sound was already loaded and returns a pointer to it else it will be loaded.
          * The returned sound should not be deleted or modified.
          */
-        cSound* Get_Sound_File(boost::filesystem::path filename) const;
+        cSound* Get_Sound_File(const boost::filesystem::path& filename) const;
+        cSound* Get_Sound_File(Sound_Handle handle) const;
+
+        /* Returns the handle of the given sound
+         * Playing by handle needs no filesystem access. Handles are only
+         * valid until the sound manager is recreated, the sounds of the
+         * game code are kept by it as Game_Sound.
+        */
+        Sound_Handle Get_Sound_Handle(const boost::filesystem::path& filename) const;
 
-        // Play the given sound. `filename' should be relative to the sounds/ directory.
-        bool Play_Sound(boost::filesystem::path filename, int res_id = -1, int volume = -1, bool loops = false);
+        /* Play the given sound. `filename' should be relative to the sounds/ directory.
+         * res_id : stops all sounds using the same resource id, these are played with high priority
+         * priority : if all voices are used it can take the voice of a sound with the same or a lower priority
+        */
+        bool Play_Sound(const boost::filesystem::path& filename, int res_id = -1, int volume = -1, bool loops = false, Sound_Priority priority = SOUND_PRIORITY_NORMAL);
+        bool Play_Sound(Sound_Handle handle, int res_id = -1, int volume = -1, bool loops = false, Sound_Priority priority = SOUND_PRIORITY_NORMAL);
+        bool Play_Sound(Game_Sound sound, int res_id = -1, int volume = -1, bool loops = false, Sound_Priority priority = SOUND_PRIORITY_NORMAL);
+        /* Play the given sound at a level position
+         * It is not played if out of range and the volume follows the distance to the camera.
+        */
+        bool Play_Sound_At(Sound_Handle handle, float pos_x, float pos_y, int volume = -1, bool loops = false, Sound_Priority priority = SOUND_PRIORITY_NORMAL, float reduction_begin = 400.0f, float reduction_end = 1000.0f);
         // If no forcing it will be played after the current music
         bool Play_Music(boost::filesystem::path filename, bool loops = false, bool force = 1, unsigned int fadein_ms = 0);
 
         /* Returns a pointer to the sound if it is active.
          * The returned sound should not be deleted or modified.
          */
-        cAudio_Sound* Get_Playing_Sound(boost::filesystem::path filename);
+        cAudio_Sound* Get_Playing_Sound(const boost::filesystem::path& filename);
+        cAudio_Sound* Get_Playing_Sound(Sound_Handle handle);
 
-        /* Returns true if a free channel for the sound is available
+        /* Returns a voice for the given sound or NULL
+         * If all voices are used the voice of an older identical sound or
+         * of the least important, quietest or oldest sound is stolen.
         */
-        cAudio_Sound* Create_Sound_Channel(void);
+        cAudio_Sound* Create_Sound_Channel(const cSound* data, Sound_Priority priority);
+        // Returns the number of playing voices
+        unsigned int Get_Playing_Voice_Count(void) const;
 
         // Toggle Music on/off
         void Toggle_Music(void);
@@ -207,6 +274,20 @@ namespace TSC {
 
         // maximum sounds allowed at once
         unsigned int m_max_sounds;
+        // maximum identical sounds playing at once
+        static const unsigned int m_max_identical_sounds;
+
+        // voices taken from other sounds
+        unsigned int m_voices_stolen;
+        // sounds not played as no voice was available
+        unsigned int m_voices_dropped;
+        // sounds not played or stopped as out of range
+        unsigned int m_voices_culled;
+    private:
+        // Play the given sound and return its voice or NULL
+        cAudio_Sound* Play_Voice(Sound_Handle handle, int res_id, int volume, bool loops, Sound_Priority priority);
+        // Update the volume of positional voices and stop them if out of range
+        void Update_Voices(void);
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
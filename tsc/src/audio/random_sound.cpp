@@ -89,6 +89,8 @@ void cRandom_Sound::Init(void)
     m_start_rect.m_h = m_rect.m_h;
 
     // default values
+    m_sound_handle = 0;
+    m_sound_handle_resolved = 0;
     m_continuous = 0;
     m_delay_min = 1000;
     m_delay_max = 5000;
@@ -99,7 +101,6 @@ void cRandom_Sound::Init(void)
 
     m_distance_to_camera = 0.0f;
     m_next_play_delay = 0.0f;
-    m_volume_update_counter = 0.0f;
 
     m_editor_color_volume_reduction_begin = Color(0.1f, 0.5f, 0.1f, 0.2f);
     m_editor_color_volume_reduction_end = Color(0.2f, 0.4f, 0.1f, 0.2f);
@@ -150,8 +151,8 @@ xmlpp::Element* cRandom_Sound::Save_To_XML_Node(xmlpp::Element* p_element)
 void cRandom_Sound::Set_Filename(const std::string& str)
 {
     // stop playing sounds
-    for (unsigned int i = 0; i < 100; i++) {
-        cAudio_Sound* sound = pAudio->Get_Playing_Sound(m_filename);
+    for (unsigned int i = 0; i < 100 && m_sound_handle; i++) {
+        cAudio_Sound* sound = pAudio->Get_Playing_Sound(m_sound_handle);
 
         if (!sound) {
             break;
@@ -161,6 +162,20 @@ void cRandom_Sound::Set_Filename(const std::string& str)
     }
 
     m_filename = str;
+
+    // not resolved yet as the editor sets every typed character
+    m_sound_handle = 0;
+    m_sound_handle_resolved = 0;
+}
+
+Sound_Handle cRandom_Sound::Get_Sound_Handle(void)
+{
+    if (!m_sound_handle_resolved) {
+        m_sound_handle = pAudio->Get_Sound_Handle(utf8_to_path(m_filename));
+        m_sound_handle_resolved = 1;
+    }
+
+    return m_sound_handle;
 }
 
 std::string cRandom_Sound::Get_Filename(void) const
@@ -280,14 +295,7 @@ float cRandom_Sound::Get_Volume_Reduction_End(void) const
 
 float cRandom_Sound::Get_Distance_Volume_Mod(void) const
 {
-    // if in volume reduction range
-    if (m_distance_to_camera > m_volume_reduction_begin) {
-        const float distance = m_distance_to_camera - m_volume_reduction_begin;
-        return 1.0f - distance / (m_volume_reduction_end - m_volume_reduction_begin);
-    }
-
-    // no reduction
-    return 1.0f;
+    return TSC::Get_Distance_Volume_Mod(m_distance_to_camera, m_volume_reduction_begin, m_volume_reduction_end);
 }
 
 void cRandom_Sound::Update(void)
@@ -301,30 +309,11 @@ void cRandom_Sound::Update(void)
     bool play = 0;
 
     if (m_continuous) {
-        m_volume_update_counter -= pFramerate->m_elapsed_ticks;
-
-        // get the sound
-        cAudio_Sound* sound = pAudio->Get_Playing_Sound(m_filename);
-
-        // if not playing
-        if (!sound) {
+        // if not playing, the voice manager updates the volume of playing sounds
+        if (!pAudio->Get_Playing_Sound(Get_Sound_Handle())) {
             // play it
             play = 1;
         }
-        // update volume
-        else if (m_volume_update_counter <= 0.0f) {
-            // volume based on maximum
-            float sound_volume = m_volume_max * 0.01f;
-            // apply distance modifier
-            sound_volume *= Get_Distance_Volume_Mod();
-            // set to mixer volume
-            sound_volume *= static_cast<float>(MAX_VOLUME);
-            // set volume
-            sound->m_sound.setVolume(static_cast<uint8_t>(sound_volume));
-
-            // update volume every 100 ms
-            m_volume_update_counter = 100.0f;
-        }
     }
     else {
         // subtract duration of this frame in milliseconds
@@ -363,14 +352,10 @@ void cRandom_Sound::Update(void)
         }
 
         sound_volume *= 0.01f;
-
-        // adjust volume based on distance
-        sound_volume *= Get_Distance_Volume_Mod();
-
         sound_volume *= static_cast<float>(MAX_VOLUME);
 
-        // play sound
-        pAudio->Play_Sound(m_filename, -1, static_cast<int>(sound_volume), m_continuous);
+        // play sound, the volume is adjusted based on the distance
+        pAudio->Play_Sound_At(Get_Sound_Handle(), m_pos_x, m_pos_y, static_cast<int>(sound_volume), m_continuous, SOUND_PRIORITY_LOW, m_volume_reduction_begin, m_volume_reduction_end);
     }
 }
 
@@ -403,11 +388,7 @@ bool cRandom_Sound::Is_Update_Valid()
         return 0;
     }
 
-    // get distance from camera center position
-    float dx = fabs(pActive_Camera->m_x + (game_res_w * 0.5f) - m_pos_x);
-    float dy = fabs(pActive_Camera->m_y + (game_res_h * 0.5f) - m_pos_y);
-
-    m_distance_to_camera = sqrt(dx * dx + dy * dy);
+    m_distance_to_camera = Get_Camera_Distance(m_pos_x, m_pos_y);
 
     // if outside the range
     if (m_distance_to_camera >= m_volume_reduction_end) {
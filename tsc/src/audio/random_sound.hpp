@@ -19,6 +19,7 @@
 
 #include "../core/global_basic.hpp"
 #include "../objects/sprite.hpp"
+#include "../audio/sound_manager.hpp"
 
 namespace TSC {
 
@@ -110,9 +111,15 @@ namespace TSC {
     protected:
         virtual std::string Get_XML_Type_Name();
 
+        // Returns the handle of the audio file
+        Sound_Handle Get_Sound_Handle(void);
+
     private:
         // the audio filename to play
         std::string m_filename;
+        // handle of the audio file, resolved when first played
+        Sound_Handle m_sound_handle;
+        bool m_sound_handle_resolved;
         // is it played continuous
         bool m_continuous;
         // delay in milliseconds
@@ -132,8 +139,6 @@ namespace TSC {
 
         // time until next play
         float m_next_play_delay;
-        // time until next volume update
-        float m_volume_update_counter;
 
         // editor color volume reduction begin
         Color m_editor_color_volume_reduction_begin;
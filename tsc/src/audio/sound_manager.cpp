@@ -15,6 +15,8 @@
 */
 
 #include "../core/property_helper.hpp"
+#include "../core/filesystem/filesystem.hpp"
+#include "../core/filesystem/resource_manager.hpp"
 #include "../audio/sound_manager.hpp"
 
 namespace fs = boost::filesystem;
@@ -50,10 +52,62 @@ void cSound::Free(void)
 
 /* *** *** *** *** *** *** cSound_Manager *** *** *** *** *** *** *** *** *** *** *** */
 
+// files of the game sounds, in the order of Game_Sound
+static const char* game_sound_filenames[SOUND_AMOUNT] = {
+    "enemy/army/hit.ogg",
+    "enemy/army/shell/hit.ogg",
+    "enemy/army/stand_up.wav",
+    "enemy/boss/furball/hit.wav",
+    "enemy/boss/furball/hit_failed.wav",
+    "enemy/boss/turtle/big_hit.ogg",
+    "enemy/boss/turtle/hit.ogg",
+    "enemy/boss/turtle/power_up.ogg",
+    "enemy/boss/turtle/shell_attack.ogg",
+    "enemy/rokko/activate.wav",
+    "enemy/spika/move.ogg",
+    "enemy/thromp/hit.ogg",
+    "enemy/turtle/shell/hit.ogg",
+    "item/empty_box.wav",
+    "item/feather.ogg",
+    "item/fireball.ogg",
+    "item/fireball_explode.wav",
+    "item/fireball_explosion.wav",
+    "item/fireball_repelled.wav",
+    "item/fireplant.ogg",
+    "item/ice_kill.wav",
+    "item/iceball.wav",
+    "item/iceball_explosion.wav",
+    "item/jewel_1.ogg",
+    "item/jewel_2.ogg",
+    "item/live_up.ogg",
+    "item/moon.ogg",
+    "item/mushroom.ogg",
+    "item/mushroom_blue.wav",
+    "item/mushroom_ghost.ogg",
+    "item/star_kill.ogg",
+    "player/dead.ogg",
+    "player/ghost_end.ogg",
+    "player/jump_big.ogg",
+    "player/jump_big_power.ogg",
+    "player/jump_ghost.ogg",
+    "player/jump_small.ogg",
+    "player/jump_small_power.ogg",
+    "player/pickup_item.wav",
+    "player/powerdown.ogg",
+    "player/run_stop.ogg",
+    "sprout_1.ogg",
+    "wall_hit.wav",
+};
+
 cSound_Manager::cSound_Manager(void)
     : cObject_Manager<cSound>()
 {
     m_load_count = 0;
+
+    // handles only stay valid for this manager
+    for (unsigned int i = 0; i < SOUND_AMOUNT; i++) {
+        m_game_sounds[i] = Get_Handle(utf8_to_path(game_sound_filenames[i]));
+    }
 }
 
 cSound_Manager::~cSound_Manager(void)
@@ -63,23 +117,81 @@ cSound_Manager::~cSound_Manager(void)
 
 cSound* cSound_Manager::Get_Pointer(const fs::path& path)
 {
-    for (SoundList::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
-        cSound* obj = (*itr);
+    Path_Sound_Map::const_iterator itr = m_path_sounds.find(path.string());
 
-        if (obj->m_filename.compare(path) == 0) {
-            // return first found
-            return obj;
-        }
+    if (itr == m_path_sounds.end()) {
+        // not found
+        return NULL;
     }
 
-    // not found
-    return NULL;
+    return itr->second;
 }
 
 void cSound_Manager::Add(cSound* sound)
 {
     m_load_count++;
     cObject_Manager<cSound>::Add(sound);
+
+    m_path_sounds[sound->m_filename.string()] = sound;
+}
+
+void cSound_Manager::Add(cSound* sound, Sound_Handle handle)
+{
+    Add(sound);
+
+    m_handle_sounds[handle] = sound;
+}
+
+Sound_Handle cSound_Manager::Get_Handle(const fs::path& filename)
+{
+    Handle_Map::const_iterator itr = m_handles.find(filename.string());
+
+    if (itr != m_handles.end()) {
+        return itr->second;
+    }
+
+    fs::path resolved = filename;
+
+    // add sound directory if required
+    if (!File_Exists(resolved) && !resolved.is_absolute()) {
+        resolved = pResource_Manager->Get_Game_Sounds_Directory() / resolved;
+    }
+
+    Sound_Handle handle = 0;
+
+    if (!File_Exists(resolved)) {
+        cerr << "Warning: Could not find sound file '" << path_to_utf8(resolved) << "'" << endl;
+    }
+    else {
+        // an other name of the same file
+        itr = m_handles.find(resolved.string());
+
+        if (itr != m_handles.end()) {
+            handle = itr->second;
+        }
+        else {
+            m_handle_filenames.push_back(resolved);
+            handle = m_handle_filenames.size();
+
+            m_handles[resolved.string()] = handle;
+        }
+    }
+
+    // missing files are remembered too
+    m_handles[filename.string()] = handle;
+
+    return handle;
+}
+
+const fs::path& cSound_Manager::Get_Handle_Filename(Sound_Handle handle) const
+{
+    static const fs::path empty;
+
+    if (handle == 0 || handle > m_handle_filenames.size()) {
+        return empty;
+    }
+
+    return m_handle_filenames[handle - 1];
 }
 
 void cSound_Manager::Delete_Sounds(void)
@@ -90,6 +202,17 @@ void cSound_Manager::Delete_Sounds(void)
         delete obj;
         obj = NULL;
     }
+
+    m_handle_sounds.clear();
+    m_path_sounds.clear();
+}
+
+void cSound_Manager::Delete_All(void)
+{
+    cObject_Manager<cSound>::Delete_All();
+
+    m_handle_sounds.clear();
+    m_path_sounds.clear();
 }
 
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
@@ -42,6 +42,63 @@ namespace TSC {
 
     typedef vector<cSound*> SoundList;
 
+    /* Interned sound name
+     * Resolving a name to its file needs filesystem access, a handle
+     * does this only once. 0 is no sound.
+    */
+    typedef unsigned int Sound_Handle;
+
+    /* Sounds played by the game code
+     * Their handles are resolved when the sound manager is created,
+     * see cSound_Manager::Get_Game_Sound().
+    */
+    enum Game_Sound {
+        SOUND_ENEMY_ARMY_HIT,
+        SOUND_ENEMY_ARMY_SHELL_HIT,
+        SOUND_ENEMY_ARMY_STAND_UP,
+        SOUND_ENEMY_BOSS_FURBALL_HIT,
+        SOUND_ENEMY_BOSS_FURBALL_HIT_FAILED,
+        SOUND_ENEMY_BOSS_TURTLE_BIG_HIT,
+        SOUND_ENEMY_BOSS_TURTLE_HIT,
+        SOUND_ENEMY_BOSS_TURTLE_POWER_UP,
+        SOUND_ENEMY_BOSS_TURTLE_SHELL_ATTACK,
+        SOUND_ENEMY_ROKKO_ACTIVATE,
+        SOUND_ENEMY_SPIKA_MOVE,
+        SOUND_ENEMY_THROMP_HIT,
+        SOUND_ENEMY_TURTLE_SHELL_HIT,
+        SOUND_ITEM_EMPTY_BOX,
+        SOUND_ITEM_FEATHER,
+        SOUND_ITEM_FIREBALL,
+        SOUND_ITEM_FIREBALL_EXPLODE,
+        SOUND_ITEM_FIREBALL_EXPLOSION,
+        SOUND_ITEM_FIREBALL_REPELLED,
+        SOUND_ITEM_FIREPLANT,
+        SOUND_ITEM_ICE_KILL,
+        SOUND_ITEM_ICEBALL,
+        SOUND_ITEM_ICEBALL_EXPLOSION,
+        SOUND_ITEM_JEWEL_1,
+        SOUND_ITEM_JEWEL_2,
+        SOUND_ITEM_LIVE_UP,
+        SOUND_ITEM_MOON,
+        SOUND_ITEM_MUSHROOM,
+        SOUND_ITEM_MUSHROOM_BLUE,
+        SOUND_ITEM_MUSHROOM_GHOST,
+        SOUND_ITEM_STAR_KILL,
+        SOUND_PLAYER_DEAD,
+        SOUND_PLAYER_GHOST_END,
+        SOUND_PLAYER_JUMP_BIG,
+        SOUND_PLAYER_JUMP_BIG_POWER,
+        SOUND_PLAYER_JUMP_GHOST,
+        SOUND_PLAYER_JUMP_SMALL,
+        SOUND_PLAYER_JUMP_SMALL_POWER,
+        SOUND_PLAYER_PICKUP_ITEM,
+        SOUND_PLAYER_POWERDOWN,
+        SOUND_PLAYER_RUN_STOP,
+        SOUND_SPROUT_1,
+        SOUND_WALL_HIT,
+        SOUND_AMOUNT
+    };
+
     /* *** *** *** *** *** *** cSound_Manager *** *** *** *** *** *** *** *** *** *** *** */
 
     /*  Keeps track of all sounds in memory
@@ -63,6 +120,32 @@ namespace TSC {
          */
         void Add(cSound* item);
 
+        /* Returns the handle for the given sound name
+         * Relative names are looked up in the game sounds directory.
+         * The name is only resolved the first time, returns 0 if the file was not found.
+        */
+        Sound_Handle Get_Handle(const boost::filesystem::path& filename);
+        // Returns the resolved file of the given handle
+        const boost::filesystem::path& Get_Handle_Filename(Sound_Handle handle) const;
+        // Returns the loaded sound of the given handle or NULL
+        cSound* Get_Handle_Sound(Sound_Handle handle) const
+        {
+            Handle_Sound_Map::const_iterator itr = m_handle_sounds.find(handle);
+
+            if (itr == m_handle_sounds.end()) {
+                return NULL;
+            }
+
+            return itr->second;
+        }
+        // Add a Sound loaded for the given handle
+        void Add(cSound* item, Sound_Handle handle);
+        // Returns the handle of the given game sound
+        inline Sound_Handle Get_Game_Sound(Game_Sound sound) const
+        {
+            return m_game_sounds[sound];
+        }
+
         cSound* operator [](unsigned int identifier)
         {
             return cObject_Manager<cSound>::Get_Pointer(identifier);
@@ -75,10 +158,27 @@ namespace TSC {
 
         // Delete all Sounds, but keep object vector entries
         void Delete_Sounds(void);
+        // Delete all Sounds, the handles stay valid
+        virtual void Delete_All(void);
 
     private:
+        typedef std::unordered_map<std::string, Sound_Handle> Handle_Map;
+        typedef std::unordered_map<Sound_Handle, cSound*> Handle_Sound_Map;
+        typedef std::unordered_map<std::string, cSound*> Path_Sound_Map;
+
         // sounds loaded since initialization
         unsigned int m_load_count;
+
+        // handle of the given and the resolved sound names
+        Handle_Map m_handles;
+        // resolved file of every handle, handle 1 is the first entry
+        vector<boost::filesystem::path> m_handle_filenames;
+        // loaded sound of the handles
+        Handle_Sound_Map m_handle_sounds;
+        // loaded sound of the files
+        Path_Sound_Map m_path_sounds;
+        // handles of the game sounds
+        Sound_Handle m_game_sounds[SOUND_AMOUNT];
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
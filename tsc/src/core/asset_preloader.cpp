@@ -0,0 +1,174 @@
+/***************************************************************************
+ * asset_preloader.cpp - load game files on worker threads
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../core/asset_preloader.hpp"
+#include "../core/filesystem/filesystem.hpp"
+#include "../core/filesystem/resource_manager.hpp"
+#include "../core/property_helper.hpp"
+#include "../core/global_basic.hpp"
+
+using namespace std;
+
+namespace fs = boost::filesystem;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** *** cPreload_Manifest *** *** *** *** *** *** *** *** *** *** */
+
+cPreload_Manifest::cPreload_Manifest(void)
+    : cFile_parser()
+{
+    //
+}
+
+cPreload_Manifest::~cPreload_Manifest(void)
+{
+    //
+}
+
+bool cPreload_Manifest::Load(void)
+{
+    m_images.clear();
+    m_sounds.clear();
+
+    fs::path filename = pResource_Manager->Get_User_Data_Directory() / utf8_to_path("preload.txt");
+
+    if (!File_Exists(filename)) {
+        filename = pResource_Manager->Get_Game_Data_Directory() / utf8_to_path("preload.txt");
+    }
+
+    return Parse(filename);
+}
+
+bool cPreload_Manifest::HandleMessage(const std::string* parts, unsigned int count, unsigned int line)
+{
+    if (count != 2) {
+        cerr << path_to_utf8(Trim_Filename(data_file, 0, 0)) << " : line " << line << " Error :" << endl;
+        cerr << "Error : " << parts[0] << " needs 1 parameter" << endl;
+        return 0;
+    }
+
+    if (parts[0].compare("image") == 0) {
+        m_images.push_back(utf8_to_path(parts[1]));
+    }
+    else if (parts[0].compare("image_dir") == 0) {
+        vector<fs::path> dir_images = Get_Directory_Files(pResource_Manager->Get_Game_Pixmaps_Directory() / utf8_to_path(parts[1]), ".png", false, false);
+        m_images.insert(m_images.end(), dir_images.begin(), dir_images.end());
+    }
+    else if (parts[0].compare("sound") == 0) {
+        m_sounds.push_back(utf8_to_path(parts[1]));
+    }
+    else {
+        cerr << path_to_utf8(Trim_Filename(data_file, 0, 0)) << " : line " << line << " Error :" << endl;
+        cerr << "Error : Unknown type " << parts[0] << endl;
+        return 0;
+    }
+
+    return 1;
+}
+
+/* *** *** *** *** *** *** *** cAsset_Preloader *** *** *** *** *** *** *** *** *** *** */
+
+const unsigned int cAsset_Preloader::m_max_threads = 4;
+
+cAsset_Preloader::cAsset_Preloader(size_t job_count, const Job_Function& function)
+{
+    m_function = function;
+    m_job_count = job_count;
+    m_next_job = 0;
+    m_returned_count = 0;
+    m_exit = 0;
+
+    // leave the main thread some room for the uploads
+    size_t thread_count = boost::thread::hardware_concurrency();
+
+    if (thread_count > m_max_threads) {
+        thread_count = m_max_threads;
+    }
+    if (thread_count > m_job_count) {
+        thread_count = m_job_count;
+    }
+    if (thread_count < 1 && m_job_count > 0) {
+        thread_count = 1;
+    }
+
+    for (size_t i = 0; i < thread_count; i++) {
+        m_threads.create_thread(boost::bind(&cAsset_Preloader::Thread_Function, this));
+    }
+}
+
+cAsset_Preloader::~cAsset_Preloader(void)
+{
+    {
+        boost::lock_guard<boost::mutex> lock(m_mutex);
+        m_exit = 1;
+    }
+
+    m_condition.notify_all();
+    m_threads.join_all();
+}
+
+bool cAsset_Preloader::Wait_Finished(std::vector<size_t>& finished, size_t max_count)
+{
+    boost::unique_lock<boost::mutex> lock(m_mutex);
+
+    if (m_returned_count >= m_job_count) {
+        return 0;
+    }
+
+    if (max_count > m_job_count - m_returned_count) {
+        max_count = m_job_count - m_returned_count;
+    }
+
+    while (m_finished.size() < max_count) {
+        m_condition.wait(lock);
+    }
+
+    for (size_t i = 0; i < max_count; i++) {
+        finished.push_back(m_finished.front());
+        m_finished.pop_front();
+        m_returned_count++;
+    }
+
+    return 1;
+}
+
+void cAsset_Preloader::Thread_Function(void)
+{
+    boost::unique_lock<boost::mutex> lock(m_mutex);
+
+    while (!m_exit && m_next_job < m_job_count) {
+        const size_t job = m_next_job;
+        m_next_job++;
+
+        lock.unlock();
+
+        try {
+            m_function(job);
+        }
+        catch (const std::exception& err) {
+            cerr << "Warning: Preloading failed: " << err.what() << endl;
+        }
+
+        lock.lock();
+
+        m_finished.push_back(job);
+        m_condition.notify_all();
+    }
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
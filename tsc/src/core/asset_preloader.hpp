@@ -0,0 +1,106 @@
+/***************************************************************************
+ * asset_preloader.hpp - load game files on worker threads
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_ASSET_PRELOADER_HPP
+#define TSC_ASSET_PRELOADER_HPP
+
+#include "../core/global_basic.hpp"
+#include "../core/file_parser.hpp"
+#include <deque>
+#include <boost/function.hpp>
+#include <boost/bind.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+namespace TSC {
+
+    /* *** *** *** *** *** *** *** cPreload_Manifest *** *** *** *** *** *** *** *** *** *** */
+
+    /* The list of images and sounds loaded while the game starts
+     * Read from preload.txt in the user data directory if available,
+     * else from the game data directory.
+    */
+    class cPreload_Manifest : public cFile_parser {
+    public:
+        cPreload_Manifest(void);
+        virtual ~cPreload_Manifest(void);
+
+        // Read the manifest, returns false if no manifest was found
+        bool Load(void);
+
+        // Handle one tokenized line
+        virtual bool HandleMessage(const std::string* parts, unsigned int count, unsigned int line);
+
+        // images relative to the pixmaps directory
+        std::vector<boost::filesystem::path> m_images;
+        // sounds relative to the sounds directory
+        std::vector<boost::filesystem::path> m_sounds;
+    };
+
+    /* *** *** *** *** *** *** *** cAsset_Preloader *** *** *** *** *** *** *** *** *** *** */
+
+    /* Runs the given function for every job index on worker threads
+     *
+     * The jobs may only do work that is safe on other threads like
+     * decoding image and sound files. The caller waits for finished
+     * jobs with Wait_Finished() and does everything that needs the main
+     * thread, like creating the OpenGL textures, with their results.
+     * The results are stored by the function itself, every job index
+     * is run exactly once.
+    */
+    class cAsset_Preloader {
+    public:
+        typedef boost::function<void (size_t)> Job_Function;
+
+        /* Start running the jobs
+         * job_count : number of jobs, the job indexes are 0 to job_count - 1
+         * function : run for every job index
+        */
+        cAsset_Preloader(size_t job_count, const Job_Function& function);
+        // Cancels the jobs not started yet and waits for the running ones
+        ~cAsset_Preloader(void);
+
+        /* Wait until max_count jobs or all remaining ones are finished and add their indexes to finished
+         * Only jobs not returned before are added.
+         * max_count : number of jobs to return at most
+         * Returns false if all jobs were already returned
+        */
+        bool Wait_Finished(std::vector<size_t>& finished, size_t max_count);
+
+        // maximum number of worker threads
+        static const unsigned int m_max_threads;
+    private:
+        void Thread_Function(void);
+
+        Job_Function m_function;
+        size_t m_job_count;
+        // next job to start
+        size_t m_next_job;
+        // jobs already returned by Wait_Finished()
+        size_t m_returned_count;
+        // finished jobs not returned yet
+        std::deque<size_t> m_finished;
+
+        boost::thread_group m_threads;
+        boost::mutex m_mutex;
+        boost::condition_variable m_condition;
+        bool m_exit;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
@@ -16,6 +16,7 @@
 
 #include "../core/camera.hpp"
 #include "../core/game_core.hpp"
+#include "../core/sprite_manager.hpp"
 #include "../level/level_player.hpp"
 #include "../core/framerate.hpp"
 #include "../input/mouse.hpp"
@@ -45,6 +46,12 @@ cCamera::cCamera(cSprite_Manager* sprite_manager)
 
     m_fixed_hor_vel = 0.0f;
 
+    m_prev_x = m_x;
+    m_prev_y = m_y;
+    m_sim_x = m_x;
+    m_sim_y = m_y;
+    m_interpolated = 0;
+
     // default camera limit
     Reset_Limits();
 }
@@ -291,6 +298,43 @@ void cCamera::Update_Limit_Y(float& y) const
     }
 }
 
+void cCamera::Save_Position(void)
+{
+    m_prev_x = m_x;
+    m_prev_y = m_y;
+}
+
+void cCamera::Interpolate_Position(float alpha)
+{
+    Restore_Position();
+
+    const float diff_x = m_x - m_prev_x;
+    const float diff_y = m_y - m_prev_y;
+
+    // jumped like when entering a level or centering
+    if (fabs(diff_x) > cSprite_Manager::m_max_interpolation_distance || fabs(diff_y) > cSprite_Manager::m_max_interpolation_distance) {
+        return;
+    }
+
+    m_sim_x = m_x;
+    m_sim_y = m_y;
+    m_interpolated = 1;
+
+    m_x = m_prev_x + (diff_x * alpha);
+    m_y = m_prev_y + (diff_y * alpha);
+}
+
+void cCamera::Restore_Position(void)
+{
+    if (!m_interpolated) {
+        return;
+    }
+
+    m_x = m_sim_x;
+    m_y = m_sim_y;
+    m_interpolated = 0;
+}
+
 void cCamera::Update(void)
 {
     // level
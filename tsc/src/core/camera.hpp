@@ -61,6 +61,16 @@ namespace TSC {
         // update
         void Update(void);
 
+        // Remember the current position before a simulation step
+        void Save_Position(void);
+        /* Move between the position before and after the last simulation step
+         * for drawing. Must be followed by Restore_Position().
+         * alpha : 0.0 is the previous and 1.0 the current position
+        */
+        void Interpolate_Position(float alpha);
+        // Move back to the simulated position
+        void Restore_Position(void);
+
         // center on the player with the given direction ( DIR_HORIZONTAL, DIR_VERTICAL and DIR_ALL )
         void Center(const ObjectDirection direction = DIR_ALL);
         // get centered player position x
@@ -118,6 +128,13 @@ namespace TSC {
         // fixed horizontal scrolling velocity
         float m_fixed_hor_vel;
 
+        // position before the last simulation step
+        float m_prev_x, m_prev_y;
+        // simulated position while interpolated
+        float m_sim_x, m_sim_y;
+        // if set the position is interpolated for drawing
+        bool m_interpolated;
+
         // default limits
         static const GL_rect m_default_limits;
     };
@@ -871,7 +871,7 @@ bool cEditor::Try_Add_Image_Item(boost::filesystem::path settings_path, const cI
 bool cEditor::Try_Add_Special_Item(cSprite* p_sprite)
 {
     // Get the list of tags attached to this graphic.
-    std::vector<std::string> available_tags = string_split(p_sprite->m_editor_tags, ";");
+    std::vector<std::string> available_tags = string_split(p_sprite->Get_Editor_Tags(), ";");
 
     // If the master tag is not in the tag list, do not add this graphic to the
     // editor.
@@ -993,10 +993,12 @@ void cEditor::load_image_items()
     std::vector<fs::path> image_files = Get_Directory_Files(pResource_Manager->Get_Game_Pixmaps_Directory(), ".settings");
     std::vector<std::pair<fs::path, cImage_Settings_Data*>> items;
 
+    // the settings files may have changed since they were cached
+    pSettingsParser->Clear_Cache();
+
     // Parse all the settings files
     for (const fs::path& settings_path: image_files) {
-        cImage_Settings_Parser parser;
-        cImage_Settings_Data* p_settings = parser.Get(settings_path);
+        cImage_Settings_Data* p_settings = pSettingsParser->Get(settings_path);
         items.push_back(std::make_pair(settings_path, p_settings));
     }
 
@@ -1345,7 +1347,7 @@ void cEditor::Process_Input(void)
     }
 
     // Camera Movement
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Right) || pJoystick->Right()) {
+    if (pKeyboard->Is_Key_Down(sf::Keyboard::Right) || pJoystick->Right()) {
         if (pKeyboard->Is_Shift_Down()) {
             pActive_Camera->Move(CAMERA_SPEED * pFramerate->m_speed_factor * 3 * pPreferences->m_scroll_speed, 0.0f);
         }
@@ -1353,7 +1355,7 @@ void cEditor::Process_Input(void)
             pActive_Camera->Move(CAMERA_SPEED * pFramerate->m_speed_factor * pPreferences->m_scroll_speed, 0.0f);
         }
     }
-    else if (sf::Keyboard::isKeyPressed(sf::Keyboard::Left) || pJoystick->Left()) {
+    else if (pKeyboard->Is_Key_Down(sf::Keyboard::Left) || pJoystick->Left()) {
         if (pKeyboard->Is_Shift_Down()) {
             pActive_Camera->Move(-(CAMERA_SPEED * pFramerate->m_speed_factor * 3 * pPreferences->m_scroll_speed), 0.0f);
         }
@@ -1361,7 +1363,7 @@ void cEditor::Process_Input(void)
             pActive_Camera->Move(-(CAMERA_SPEED * pFramerate->m_speed_factor * pPreferences->m_scroll_speed), 0.0f);
         }
     }
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Up) || pJoystick->Up()) {
+    if (pKeyboard->Is_Key_Down(sf::Keyboard::Up) || pJoystick->Up()) {
         if (pKeyboard->Is_Shift_Down()) {
             pActive_Camera->Move(0.0f, -(CAMERA_SPEED * pFramerate->m_speed_factor * 3 * pPreferences->m_scroll_speed));
         }
@@ -1369,7 +1371,7 @@ void cEditor::Process_Input(void)
             pActive_Camera->Move(0.0f, -(CAMERA_SPEED * pFramerate->m_speed_factor * pPreferences->m_scroll_speed));
         }
     }
-    else if (sf::Keyboard::isKeyPressed(sf::Keyboard::Down) || pJoystick->Down()) {
+    else if (pKeyboard->Is_Key_Down(sf::Keyboard::Down) || pJoystick->Down()) {
         if (pKeyboard->Is_Shift_Down()) {
             pActive_Camera->Move(0.0f, CAMERA_SPEED * pFramerate->m_speed_factor * 3 * pPreferences->m_scroll_speed);
         }
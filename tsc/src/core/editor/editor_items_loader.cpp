@@ -118,7 +118,7 @@ void cEditorItemsLoader::on_end_element(const Glib::ustring& name)
     // Cf. above why we can reduce the vector to its first element.
     // Once the parser does not produce legacy output with multi-sprite
     // elements anymore, simplify this code accordingly.
-    sprites[0]->m_editor_tags = tags.c_str();
+    sprites[0]->Set_Editor_Tags(tags.c_str());
     m_tagged_sprites.push_back(sprites[0]);
 
     // Prepare for next element
@@ -52,72 +52,70 @@ bool cFile_parser::Parse(const fs::path& filename)
 
     std::string line;
     unsigned int line_num = 0;
+    std::vector<std::string> parts;
 
     while (std::getline(ifs, line)) {
         line_num++;
-        Parse_Line(line, line_num);
+        Parse_Line(line, line_num, parts);
     }
 
     return 1;
 }
 
-bool cFile_parser::Parse_Line(std::string str_line, int line_num)
+bool cFile_parser::Parse_Line(const std::string& str_line, int line_num, std::vector<std::string>& parts)
 {
-    if (str_line.empty()) {
-        return 1;
-    }
-
-    // linux support
-    string_erase_all(str_line, '\r');
-    // no tabs
-    string_replace_all(str_line, "\t", " ");
-    // remove beginning spaces
-    string_trim_from_begin(str_line, ' ');
-    // remove trailing spaces
-    string_trim_from_end(str_line, ' ');
+    // skip beginning and trailing spaces, tabs and carriage returns
+    std::string::size_type pos = str_line.find_first_not_of(" \t\r");
 
     // ignore empty lines and comments
-    if (str_line.empty() || *str_line.begin() == '#') {
+    if (pos == std::string::npos || str_line[pos] == '#') {
         // no error
         return 1;
     }
 
-    std::string tempstr = str_line;
-    int count = 1;
+    const std::string::size_type end = str_line.find_last_not_of(" \t\r") + 1;
+    unsigned int count = 0;
 
-    // count spaces
-    while (tempstr.find(' ') != std::string::npos) {
-        tempstr.erase(tempstr.find(' ') , 1);
-        count++;
-    }
+    /* every single space or tab separates a part
+     * the part strings keep their memory for the next lines
+    */
+    while (1) {
+        std::string::size_type part_end = str_line.find_first_of(" \t", pos);
 
-    tempstr = str_line;
+        if (part_end == std::string::npos || part_end > end) {
+            part_end = end;
+        }
 
-    std::string* parts = new std::string[ count + 1 ];
+        if (parts.size() <= count) {
+            parts.resize(count + 1);
+        }
 
-    std::string::size_type len;
-    int part_count = 0;
+        std::string& part = parts[count];
+        part.assign(str_line, pos, part_end - pos);
 
-    while (count > 0) {
-        // get length of the part
-        len = tempstr.find_first_of(' ');
-        // create part
-        parts[part_count] = tempstr.substr(0, len);
-        // remove part from temp string
-        tempstr.erase(0, len + 1);
+        // linux support
+        if (part.find('\r') != std::string::npos) {
+            string_erase_all(part, '\r');
+        }
 
-        part_count++;
-        count--;
-    }
+        count++;
 
-    parts[part_count] = tempstr;
+        if (part_end >= end) {
+            break;
+        }
 
-    // Message handler
-    bool success = HandleMessage(parts, part_count, line_num);
+        pos = part_end + 1;
+    }
 
-    delete []parts;
+    // handlers may look at one part more than given
+    if (parts.size() <= count) {
+        parts.resize(count + 1);
+    }
+
+    parts[count].clear();
 
-    return success;
+    // Message handler
+    return HandleMessage(&parts[0], count, line_num);
 }
 
 bool cFile_parser::HandleMessage(const std::string* parts, unsigned int count, unsigned int line)
@@ -31,8 +31,10 @@ namespace TSC {
         // Parses the given file
         bool Parse(const boost::filesystem::path& filename);
 
-        // Tokenize a line
-        bool Parse_Line(std::string str_line, int line_num);
+        /* Tokenize a line
+         * parts : buffer for the tokens, reused for every line of a file
+        */
+        bool Parse_Line(const std::string& str_line, int line_num, std::vector<std::string>& parts);
 
         // Handle one tokenized line
         virtual bool HandleMessage(const std::string* parts, unsigned int count, unsigned int line);
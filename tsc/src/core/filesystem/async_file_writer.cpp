@@ -0,0 +1,200 @@
+/***************************************************************************
+ * async_file_writer.cpp - write files on a worker thread
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../core/filesystem/async_file_writer.hpp"
+#include "../../core/property_helper.hpp"
+#include "../../core/global_basic.hpp"
+
+#ifdef __unix__
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace fs = boost::filesystem;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** *** cAsync_File_Writer *** *** *** *** *** *** *** *** *** *** */
+
+cAsync_File_Writer::cAsync_File_Writer(void)
+{
+    m_active_job = 0;
+    m_last_job = 0;
+    m_exit = 0;
+
+    m_thread = boost::thread(&cAsync_File_Writer::Thread_Function, this);
+}
+
+cAsync_File_Writer::~cAsync_File_Writer(void)
+{
+    {
+        boost::lock_guard<boost::mutex> lock(m_mutex);
+        m_exit = 1;
+    }
+
+    m_condition.notify_all();
+
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+unsigned int cAsync_File_Writer::Write(const fs::path& filename, const std::string& data)
+{
+    Job job;
+    job.m_filename = filename;
+    job.m_data = data;
+
+    {
+        boost::lock_guard<boost::mutex> lock(m_mutex);
+        job.m_id = ++m_last_job;
+        m_jobs.push_back(job);
+    }
+
+    m_condition.notify_all();
+
+    return job.m_id;
+}
+
+bool cAsync_File_Writer::Get_Result(unsigned int job_id, bool& success, std::string& error)
+{
+    boost::lock_guard<boost::mutex> lock(m_mutex);
+
+    std::map<unsigned int, Result>::iterator itr = m_results.find(job_id);
+
+    if (itr == m_results.end()) {
+        return 0;
+    }
+
+    success = itr->second.m_success;
+    error = itr->second.m_error;
+    m_results.erase(itr);
+
+    return 1;
+}
+
+bool cAsync_File_Writer::Is_Pending(unsigned int job_id)
+{
+    boost::lock_guard<boost::mutex> lock(m_mutex);
+
+    if (m_active_job == job_id) {
+        return 1;
+    }
+
+    for (std::deque<Job>::const_iterator itr = m_jobs.begin(); itr != m_jobs.end(); ++itr) {
+        if (itr->m_id == job_id) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+void cAsync_File_Writer::Wait(void)
+{
+    boost::unique_lock<boost::mutex> lock(m_mutex);
+
+    while (!m_jobs.empty() || m_active_job) {
+        m_condition.wait(lock);
+    }
+}
+
+bool cAsync_File_Writer::Write_File(const fs::path& filename, const std::string& data, std::string& error)
+{
+    fs::path tempname = filename;
+    tempname += ".tmp";
+
+    try {
+        fs::ofstream file(tempname, ios::out | ios::binary | ios::trunc);
+
+        if (!file.is_open()) {
+            error = "Could not open '" + path_to_utf8(tempname) + "' for writing";
+            return 0;
+        }
+
+        file.write(data.data(), data.size());
+        file.close();
+
+        if (file.fail()) {
+            error = "Could not write '" + path_to_utf8(tempname) + "'";
+            fs::remove(tempname);
+            return 0;
+        }
+
+#ifdef __unix__
+        // make sure the data is on the disk before it replaces the old file
+        int fd = open(tempname.c_str(), O_RDONLY);
+        if (fd >= 0) {
+            fsync(fd);
+            close(fd);
+        }
+#endif
+
+        fs::rename(tempname, filename);
+    }
+    catch (const fs::filesystem_error& err) {
+        error = err.what();
+        return 0;
+    }
+
+    return 1;
+}
+
+void cAsync_File_Writer::Thread_Function(void)
+{
+    boost::unique_lock<boost::mutex> lock(m_mutex);
+
+    while (1) {
+        while (m_jobs.empty() && !m_exit) {
+            m_condition.wait(lock);
+        }
+
+        // all jobs are written
+        if (m_jobs.empty()) {
+            break;
+        }
+
+        Job job = m_jobs.front();
+        m_jobs.pop_front();
+        m_active_job = job.m_id;
+
+        // write without blocking new jobs
+        lock.unlock();
+
+        Result result;
+        result.m_success = Write_File(job.m_filename, job.m_data, result.m_error);
+
+        if (!result.m_success) {
+            cerr << "Error: Couldn't write file '" << path_to_utf8(job.m_filename) << "': " << result.m_error << endl;
+        }
+
+        lock.lock();
+
+        m_results[job.m_id] = result;
+        m_active_job = 0;
+
+        m_condition.notify_all();
+    }
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+cAsync_File_Writer* pAsync_File_Writer = NULL;
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
@@ -0,0 +1,103 @@
+/***************************************************************************
+ * async_file_writer.hpp - write files on a worker thread
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_ASYNC_FILE_WRITER_HPP
+#define TSC_ASYNC_FILE_WRITER_HPP
+
+#include "../../core/global_basic.hpp"
+#include <deque>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+namespace TSC {
+
+    /* *** *** *** *** *** *** *** cAsync_File_Writer *** *** *** *** *** *** *** *** *** *** */
+
+    /* Writes already serialized file contents on a worker thread.
+     * The caller snapshots its state into a string on the main
+     * thread and only the slow disk access happens in the
+     * background.
+     *
+     * Every file is first written next to its target with a ".tmp"
+     * extension, synced to the disk and then renamed over it, so a
+     * crash while writing never leaves a half written file behind. Jobs are written in
+     * the order they were added.
+    */
+    class cAsync_File_Writer {
+    public:
+        cAsync_File_Writer(void);
+        // Waits until all jobs are written
+        ~cAsync_File_Writer(void);
+
+        /* Queue the given data to be written to filename
+         * Returns the job id to check the result with Get_Result()
+        */
+        unsigned int Write(const boost::filesystem::path& filename, const std::string& data);
+
+        /* Check if the given job is finished
+         * Returns false if it is still queued or writing, otherwise
+         * the result is removed and success is set
+         * error : set to the error message if not successful
+        */
+        bool Get_Result(unsigned int job_id, bool& success, std::string& error);
+        // Returns true if the given job is queued or writing
+        bool Is_Pending(unsigned int job_id);
+        // Wait until all queued jobs are written
+        void Wait(void);
+
+        /* Write the data to filename through a temporary file
+         * Returns false and sets error on failure
+        */
+        static bool Write_File(const boost::filesystem::path& filename, const std::string& data, std::string& error);
+    private:
+        struct Job {
+            unsigned int m_id;
+            boost::filesystem::path m_filename;
+            std::string m_data;
+        };
+
+        struct Result {
+            bool m_success;
+            std::string m_error;
+        };
+
+        // Worker thread loop
+        void Thread_Function(void);
+
+        boost::thread m_thread;
+        boost::mutex m_mutex;
+        // signaled when a job is added or finished
+        boost::condition_variable m_condition;
+
+        // jobs not yet written
+        std::deque<Job> m_jobs;
+        // id of the job being written or 0
+        unsigned int m_active_job;
+        // finished jobs not yet requested
+        std::map<unsigned int, Result> m_results;
+        // last given job id
+        unsigned int m_last_job;
+        // if set the thread exits when all jobs are written
+        bool m_exit;
+    };
+
+    // Async File Writer
+    extern cAsync_File_Writer* pAsync_File_Writer;
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
@@ -88,6 +88,10 @@ void cResource_Manager::Init_User_Directory(void)
     if (!Dir_Exists(Get_User_Imgcache_Directory())) {
         fs::create_directories(Get_User_Imgcache_Directory());
     }
+    // Create bytecode cache directory
+    if (!Dir_Exists(Get_User_Bytecode_Cache_Directory())) {
+        fs::create_directories(Get_User_Bytecode_Cache_Directory());
+    }
     // Create config directory
     if (!Dir_Exists(m_paths.user_config_dir)) {
         fs::create_directories(m_paths.user_config_dir);
@@ -159,6 +163,11 @@ fs::path cResource_Manager::Get_User_Imgcache_Directory()
     return m_paths.user_cache_dir / utf8_to_path(USER_IMGCACHE_DIR);
 }
 
+fs::path cResource_Manager::Get_User_Bytecode_Cache_Directory()
+{
+    return m_paths.user_cache_dir / utf8_to_path(USER_BYTECODE_CACHE_DIR);
+}
+
 fs::path cResource_Manager::Get_User_Pixmaps_Directory()
 {
     std::string resolution = int_to_string(pPreferences->m_video_screen_w) + "x" + int_to_string(pPreferences->m_video_screen_h);
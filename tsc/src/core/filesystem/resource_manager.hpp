@@ -106,6 +106,7 @@ namespace TSC {
         boost::filesystem::path Get_User_World_Directory();
         boost::filesystem::path Get_User_Campaign_Directory();
         boost::filesystem::path Get_User_Imgcache_Directory();
+        boost::filesystem::path Get_User_Bytecode_Cache_Directory();
         boost::filesystem::path Get_User_Pixmaps_Directory();
         boost::filesystem::path Get_User_CEGUI_Logfile();
         boost::filesystem::path Get_User_GameConsole_Logfile();
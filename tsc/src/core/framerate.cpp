@@ -41,14 +41,24 @@ void cPerformance_Timer::Reset(void)
 }
 
 void cPerformance_Timer::Update(void)
+{
+    Update(pFramerate->m_perf_last_ticks);
+}
+
+void cPerformance_Timer::Update(uint32_t& last_ticks)
+{
+    uint32_t new_ticks = TSC_GetTicks();
+    Add(new_ticks - last_ticks);
+    last_ticks = new_ticks;
+}
+
+void cPerformance_Timer::Add(uint32_t elapsed_ms)
 {
     // count frame
     frame_counter++;
 
     // add milliseconds
-    uint32_t new_ticks = TSC_GetTicks();
-    ms_counter += new_ticks - pFramerate->m_perf_last_ticks;
-    pFramerate->m_perf_last_ticks = new_ticks;
+    ms_counter += elapsed_ms;
 
     // counted 100 frames
     if (frame_counter >= 100) {
@@ -61,6 +71,8 @@ void cPerformance_Timer::Update(void)
 
 /* *** *** *** *** *** *** cFramerate *** *** *** *** *** *** *** *** *** *** *** */
 
+const unsigned int cFramerate::m_max_steps = 8;
+
 cFramerate::cFramerate(void)
 {
     m_fps_target = 0;
@@ -75,10 +87,12 @@ cFramerate::cFramerate(void)
     m_max_elapsed_ticks = 100;
     m_speed_factor = 0.1f;
     m_force_speed_factor = 0.0f;
+    m_step_accumulator = 0.0f;
+    m_updates_since_steps = 0;
     m_perf_last_ticks = 0;
 
     // create performance timers
-    for (unsigned int i = 0; i < 24; i++) {
+    for (unsigned int i = 0; i < 28; i++) {
         m_perf_timer.push_back(new cPerformance_Timer());
     }
 }
@@ -134,6 +148,10 @@ void cFramerate::Update(void)
         m_speed_factor = static_cast<float>(m_elapsed_ticks / (1000 / m_fps_target));
     }
 
+    // time to simulate in the next frame
+    m_step_accumulator += m_elapsed_ticks;
+    m_updates_since_steps++;
+
     // speed factor based fps
     m_fps = m_fps_target / m_speed_factor;
 
@@ -171,6 +189,8 @@ void cFramerate::Reset(void)
     m_fps_average = 0;
     m_fps_average_framedelay = m_last_ticks;
     m_frames_counted = 0;
+    m_step_accumulator = 0.0f;
+    m_updates_since_steps = 0;
 
     // reset performance timer
     for (Performance_Timer_List::iterator itr = m_perf_timer.begin(); itr != m_perf_timer.end(); ++itr) {
@@ -188,6 +208,42 @@ void cFramerate::Set_Fixed_Speedfacor(const float val)
     m_force_speed_factor = val;
 }
 
+unsigned int cFramerate::Get_Simulation_Steps(void)
+{
+    const float step_ms = 1000.0f / simulation_fps;
+
+    /* updated more than once since the last frame in a blocking loop
+     * like a fade, only simulate the time of this frame
+    */
+    if (m_updates_since_steps > 1) {
+        m_step_accumulator = static_cast<float>(m_elapsed_ticks);
+    }
+
+    m_updates_since_steps = 0;
+
+    unsigned int steps = static_cast<unsigned int>(m_step_accumulator / step_ms);
+
+    // too slow to catch up
+    if (steps > m_max_steps) {
+        steps = m_max_steps;
+        m_step_accumulator = steps * step_ms;
+    }
+
+    m_step_accumulator -= steps * step_ms;
+
+    return steps;
+}
+
+float cFramerate::Get_Step_Interpolation(void) const
+{
+    return Clamp(m_step_accumulator / (1000.0f / simulation_fps), 0.0f, 1.0f);
+}
+
+float cFramerate::Get_Step_Speed_Factor(void)
+{
+    return static_cast<float>(speedfactor_fps) / simulation_fps;
+}
+
 /* *** *** *** *** *** *** *** helper functions *** *** *** *** *** *** *** *** *** *** */
 
 void Correct_Frame_Time(const unsigned int fps)
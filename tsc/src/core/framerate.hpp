@@ -34,6 +34,10 @@ namespace TSC {
 
         // Update and set new framerate ticks
         void Update(void);
+        // Update with the given section start ticks and set them to the current ticks
+        void Update(uint32_t& last_ticks);
+        // Count a frame with the given milliseconds measured elsewhere
+        void Add(uint32_t elapsed_ms);
 
         // current frame counter
         uint32_t frame_counter;
@@ -69,6 +73,18 @@ namespace TSC {
         */
         void Set_Fixed_Speedfacor(const float val);
 
+        /* Returns the amount of simulation steps due this frame and removes
+         * their time. Can be zero if the frame was faster than one step.
+         * Time of blocking loops like fades since the last call is dropped.
+        */
+        unsigned int Get_Simulation_Steps(void);
+        /* Returns how far the time not yet simulated is into the next step
+         * 0.0 - 1.0 for drawing between the last two simulation steps
+        */
+        float Get_Step_Interpolation(void) const;
+        // Returns the speed factor of one simulation step
+        static float Get_Step_Speed_Factor(void);
+
         // target fps for speed factor calculations
         float m_fps_target;
         // current fps
@@ -100,6 +116,13 @@ namespace TSC {
         // fixed speed factor value
         float m_force_speed_factor;
 
+        // milliseconds not yet simulated
+        float m_step_accumulator;
+        // Update() calls since the last Get_Simulation_Steps()
+        unsigned int m_updates_since_steps;
+        // maximum simulation steps per frame, time beyond is dropped
+        static const unsigned int m_max_steps;
+
         // ## performance values ##
         // ticks since last section
         uint32_t m_perf_last_ticks;
@@ -37,6 +37,8 @@
 #include "../user/savegame/savegame.hpp"
 #include "../overworld/world_editor.hpp"
 #include "filesystem/resource_manager.hpp"
+#include "../core/asset_preloader.hpp"
+#include "../video/img_manager.hpp"
 #include "../core/global_basic.hpp"
 
 using namespace std;
@@ -347,6 +349,12 @@ void Clear_Input_Events(void)
     pJoystick->Reset_keys();
 }
 
+// Decode an image on a worker thread of Preload_Images()
+static void Preload_Image_Job(const vector<fs::path>& image_files, vector<cVideo::cSoftware_Image>& software_images, size_t index)
+{
+    software_images[index] = pVideo->Load_Image(image_files[index]);
+}
+
 void Preload_Images(bool draw_gui /* = 0 */)
 {
     CEGUI::Window* p_rootwindow = CEGUI::System::getSingleton().getDefaultGUIContext().getRootWindow();
@@ -361,115 +369,60 @@ void Preload_Images(bool draw_gui /* = 0 */)
         Loading_Screen_Draw_Text(_("Loading Images"));
     }
 
-    // image files
+    cPreload_Manifest manifest;
+    manifest.Load();
+
+    // image files not loaded yet
     vector<fs::path> image_files;
 
-    // player
-    vector<fs::path> player_small_images    = Get_Directory_Files(pResource_Manager->Get_Game_Pixmaps_Directory() / utf8_to_path("alex/small"), ".png", false, false);
-    vector<fs::path> player_big_images      = Get_Directory_Files(pResource_Manager->Get_Game_Pixmaps_Directory() / utf8_to_path("alex/big"), ".png", false, false);
-    vector<fs::path> player_fire_images     = Get_Directory_Files(pResource_Manager->Get_Game_Pixmaps_Directory() / utf8_to_path("alex/fire"), ".png", false, false);
-    vector<fs::path> player_ice_images      = Get_Directory_Files(pResource_Manager->Get_Game_Pixmaps_Directory() / utf8_to_path("alex/ice"), ".png", false, false);
-    vector<fs::path> player_ghost_images    = Get_Directory_Files(pResource_Manager->Get_Game_Pixmaps_Directory() / utf8_to_path("alex/ghost"), ".png", false, false);
-
-    image_files.insert(image_files.end(), player_small_images.begin(), player_small_images.end());
-    image_files.insert(image_files.end(), player_big_images.begin(), player_big_images.end());
-    image_files.insert(image_files.end(), player_fire_images.begin(), player_fire_images.end());
-    image_files.insert(image_files.end(), player_ice_images.begin(), player_ice_images.end());
-    image_files.insert(image_files.end(), player_ghost_images.begin(), player_ghost_images.end());
-
-    // Mushrooms
-    image_files.push_back(utf8_to_path("game/items/mushroom_red.png"));
-    image_files.push_back(utf8_to_path("game/items/mushroom_green.png"));
-    image_files.push_back(utf8_to_path("game/items/mushroom_blue.png"));
-    image_files.push_back(utf8_to_path("game/items/mushroom_ghost.png"));
-    // Fireberry
-    image_files.push_back(utf8_to_path("game/items/fireberry_1.png"));
-    image_files.push_back(utf8_to_path("game/items/fireberry_2.png"));
-    image_files.push_back(utf8_to_path("game/items/fireberry_3.png"));
-    // Star
-    image_files.push_back(utf8_to_path("game/items/lemon_1.png"));
-    // Feather
-    //image_files.push_back( "game/items/feather_1.png" );
-    // Yellow Goldpiece
-    image_files.push_back(utf8_to_path("game/items/goldpiece/yellow/1.png"));
-    image_files.push_back(utf8_to_path("game/items/goldpiece/yellow/2.png"));
-    image_files.push_back(utf8_to_path("game/items/goldpiece/yellow/3.png"));
-    image_files.push_back(utf8_to_path("game/items/goldpiece/yellow/4.png"));
-    image_files.push_back(utf8_to_path("game/items/goldpiece/yellow/5.png"));
-    image_files.push_back(utf8_to_path("game/items/goldpiece/yellow/6.png"));
-    image_files.push_back(utf8_to_path("game/items/goldpiece/yellow/7.png"));
-    image_files.push_back(utf8_to_path("game/items/goldpiece/yellow/8.png"));
-    image_files.push_back(utf8_to_path("game/items/goldpiece/yellow/9.png"));
-    image_files.push_back(utf8_to_path("game/items/goldpiece/yellow/10.png"));
-    image_files.push_back(utf8_to_path("game/items/goldpiece/yellow/1_falling.png"));
-    image_files.push_back(utf8_to_path("game/items/goldpiece/yellow/2_falling.png"));
-    image_files.push_back(utf8_to_path("game/items/goldpiece/yellow/3_falling.png"));
-    image_files.push_back(utf8_to_path("game/items/goldpiece/yellow/4_falling.png"));
-    image_files.push_back(utf8_to_path("game/items/goldpiece/yellow/5_falling.png"));
-    image_files.push_back(utf8_to_path("game/items/goldpiece/yellow/6_falling.png"));
-    image_files.push_back(utf8_to_path("game/items/goldpiece/yellow/7_falling.png"));
-    image_files.push_back(utf8_to_path("game/items/goldpiece/yellow/8_falling.png"));
-    image_files.push_back(utf8_to_path("game/items/goldpiece/yellow/9_falling.png"));
-    image_files.push_back(utf8_to_path("game/items/goldpiece/yellow/10_falling.png"));
-    // Red Goldpiece
-    image_files.push_back(utf8_to_path("game/items/goldpiece/red/1.png"));
-    image_files.push_back(utf8_to_path("game/items/goldpiece/red/2.png"));
-    image_files.push_back(utf8_to_path("game/items/goldpiece/red/3.png"));
-    image_files.push_back(utf8_to_path("game/items/goldpiece/red/4.png"));
-    image_files.push_back(utf8_to_path("game/items/goldpiece/red/5.png"));
-    image_files.push_back(utf8_to_path("game/items/goldpiece/red/6.png"));
-    image_files.push_back(utf8_to_path("game/items/goldpiece/red/7.png"));
-    image_files.push_back(utf8_to_path("game/items/goldpiece/red/8.png"));
-    image_files.push_back(utf8_to_path("game/items/goldpiece/red/9.png"));
-    image_files.push_back(utf8_to_path("game/items/goldpiece/red/10.png"));
-    image_files.push_back(utf8_to_path("game/items/goldpiece/red/1_falling.png"));
-    image_files.push_back(utf8_to_path("game/items/goldpiece/red/2_falling.png"));
-    image_files.push_back(utf8_to_path("game/items/goldpiece/red/3_falling.png"));
-    image_files.push_back(utf8_to_path("game/items/goldpiece/red/4_falling.png"));
-    image_files.push_back(utf8_to_path("game/items/goldpiece/red/5_falling.png"));
-    image_files.push_back(utf8_to_path("game/items/goldpiece/red/6_falling.png"));
-    image_files.push_back(utf8_to_path("game/items/goldpiece/red/7_falling.png"));
-    image_files.push_back(utf8_to_path("game/items/goldpiece/red/8_falling.png"));
-    image_files.push_back(utf8_to_path("game/items/goldpiece/red/9_falling.png"));
-    image_files.push_back(utf8_to_path("game/items/goldpiece/red/10_falling.png"));
-
-    // Brown Box
-    image_files.push_back(utf8_to_path("game/box/brown1_1.png"));
-
-    // Light animation
-    image_files.push_back(utf8_to_path("animation/light_1/1.png"));
-    image_files.push_back(utf8_to_path("animation/light_1/2.png"));
-    image_files.push_back(utf8_to_path("animation/light_1/3.png"));
-    // Particle animations
-    image_files.push_back(utf8_to_path("animation/particles/fire_1.png"));
-    image_files.push_back(utf8_to_path("animation/particles/fire_2.png"));
-    image_files.push_back(utf8_to_path("animation/particles/fire_3.png"));
-    image_files.push_back(utf8_to_path("animation/particles/fire_4.png"));
-    image_files.push_back(utf8_to_path("animation/particles/smoke.png"));
-    image_files.push_back(utf8_to_path("animation/particles/smoke_black.png"));
-    image_files.push_back(utf8_to_path("animation/particles/light.png"));
-    image_files.push_back(utf8_to_path("animation/particles/dirt.png"));
-    image_files.push_back(utf8_to_path("animation/particles/ice_1.png"));
-    image_files.push_back(utf8_to_path("animation/particles/cloud.png"));
-    image_files.push_back(utf8_to_path("animation/particles/axis.png"));
-
-    // Ball
-    image_files.push_back(utf8_to_path("animation/fireball/1.png"));
-    image_files.push_back(utf8_to_path("animation/iceball/1.png"));
+    for (vector<fs::path>::iterator itr = manifest.m_images.begin(); itr != manifest.m_images.end(); ++itr) {
+        // get filename
+        fs::path filename = (*itr);
+
+        // .settings file type can't be used directly
+        if (filename.extension() == fs::path(".settings")) {
+            filename.replace_extension(".png");
+        }
+
+        // pixmaps dir must be given
+        if (!filename.is_absolute()) {
+            filename = pResource_Manager->Get_Game_Pixmaps_Directory() / filename;
+        }
+
+        // already loaded
+        if (pImage_Manager->Get_Pointer(path_to_utf8(filename))) {
+            continue;
+        }
+        if (std::find(image_files.begin(), image_files.end(), filename) != image_files.end()) {
+            continue;
+        }
+
+        image_files.push_back(filename);
+    }
+
+    // decoded images
+    vector<cVideo::cSoftware_Image> software_images(image_files.size());
+    cAsset_Preloader preloader(image_files.size(), boost::bind(&Preload_Image_Job, boost::cref(image_files), boost::ref(software_images), _1));
 
     unsigned int loaded_files = 0;
     unsigned int file_count = image_files.size();
+    vector<size_t> finished;
 
-    // load images
-    for (vector<fs::path>::iterator itr = image_files.begin(); itr != image_files.end(); ++itr) {
-        // get filename
-        fs::path filename = (*itr);
+    // the textures can only be created here, draw the progress once for every batch
+    while (preloader.Wait_Finished(finished, 16)) {
+        for (vector<size_t>::iterator itr = finished.begin(); itr != finished.end(); ++itr) {
+            cGL_Surface* image = pVideo->Create_GL_Surface(image_files[*itr], software_images[*itr]);
 
-        // preload image
-        pVideo->Get_Surface(filename);
+            // add new image
+            if (image) {
+                pImage_Manager->Add(image);
+            }
 
-        // count files
-        loaded_files++;
+            // count files
+            loaded_files++;
+        }
+
+        finished.clear();
 
         if (draw_gui) {
             // update progress
@@ -480,6 +433,19 @@ void Preload_Images(bool draw_gui /* = 0 */)
     }
 }
 
+// Decode a sound on a worker thread of Preload_Sounds()
+static void Preload_Sound_Job(const vector<fs::path>& sound_files, vector<cSound*>& sounds, size_t index)
+{
+    cSound* sound = new cSound();
+
+    if (sound->Load(sound_files[index])) {
+        sounds[index] = sound;
+    }
+    else {
+        delete sound;
+    }
+}
+
 void Preload_Sounds(bool draw_gui /* = 0 */)
 {
     // skip caching if disabled
@@ -498,106 +464,50 @@ void Preload_Sounds(bool draw_gui /* = 0 */)
         Loading_Screen_Draw_Text(_("Loading Sounds"));
     }
 
-    // sound files
+    cPreload_Manifest manifest;
+    manifest.Load();
+
+    // sounds not loaded yet
+    vector<Sound_Handle> sound_handles;
     vector<fs::path> sound_files;
 
-    // player
-    sound_files.push_back(utf8_to_path("wall_hit.wav"));
-    sound_files.push_back(utf8_to_path("player/dead.ogg"));
-    sound_files.push_back(utf8_to_path("itembox_get.ogg"));
-    sound_files.push_back(utf8_to_path("itembox_set.ogg"));
-    sound_files.push_back(utf8_to_path("player/pickup_item.wav"));
-    sound_files.push_back(utf8_to_path("player/jump_small.ogg"));
-    sound_files.push_back(utf8_to_path("player/jump_small_power.ogg"));
-    sound_files.push_back(utf8_to_path("player/jump_big.ogg"));
-    sound_files.push_back(utf8_to_path("player/jump_big_power.ogg"));
-    sound_files.push_back(utf8_to_path("player/jump_ghost.ogg"));
-    // todo : create again
-    //sound_files.push_back( utf8_to_path( "player/alex_au.ogg" ) );
-    sound_files.push_back(utf8_to_path("player/powerdown.ogg"));
-    sound_files.push_back(utf8_to_path("player/ghost_end.ogg"));
-    sound_files.push_back(utf8_to_path("player/run_stop.ogg"));
-    sound_files.push_back(utf8_to_path("enter_pipe.ogg"));
-    sound_files.push_back(utf8_to_path("leave_pipe.ogg"));
-
-    // items
-    sound_files.push_back(utf8_to_path("item/star_kill.ogg"));
-    sound_files.push_back(utf8_to_path("item/fireball.ogg"));
-    sound_files.push_back(utf8_to_path("item/iceball.wav"));
-    sound_files.push_back(utf8_to_path("item/ice_kill.wav"));
-    sound_files.push_back(utf8_to_path("item/fireball_explode.wav"));
-    sound_files.push_back(utf8_to_path("item/fireball_repelled.wav"));
-    sound_files.push_back(utf8_to_path("item/fireball_explosion.wav"));
-    sound_files.push_back(utf8_to_path("item/iceball_explosion.wav"));
-    sound_files.push_back(utf8_to_path("item/fireplant.ogg"));
-    sound_files.push_back(utf8_to_path("item/jewel_1.ogg"));
-    sound_files.push_back(utf8_to_path("item/jewel_2.ogg"));
-    sound_files.push_back(utf8_to_path("item/live_up.ogg"));
-    sound_files.push_back(utf8_to_path("item/live_up_2.ogg"));
-    sound_files.push_back(utf8_to_path("item/mushroom.ogg"));
-    sound_files.push_back(utf8_to_path("item/mushroom_ghost.ogg"));
-    sound_files.push_back(utf8_to_path("item/mushroom_blue.wav"));
-    sound_files.push_back(utf8_to_path("item/moon.ogg"));
-
-    // box
-    sound_files.push_back(utf8_to_path("item/empty_box.wav"));
-
-    // enemies
-    // eato
-    sound_files.push_back(utf8_to_path("enemy/eato/die.ogg"));
-    // gee
-    sound_files.push_back(utf8_to_path("enemy/gee/die.ogg"));
-    // furball
-    sound_files.push_back(utf8_to_path("enemy/furball/die.ogg"));
-    // furball boss
-    sound_files.push_back(utf8_to_path("enemy/boss/furball/hit.wav"));
-    sound_files.push_back(utf8_to_path("enemy/boss/furball/hit_failed.wav"));
-    // flyon
-    sound_files.push_back(utf8_to_path("enemy/flyon/die.ogg"));
-    // krush
-    sound_files.push_back(utf8_to_path("enemy/krush/die.ogg"));
-    // rokko
-    sound_files.push_back(utf8_to_path("enemy/rokko/activate.wav"));
-    sound_files.push_back(utf8_to_path("enemy/rokko/hit.wav"));
-    // spika
-    sound_files.push_back(utf8_to_path("enemy/spika/move.ogg"));
-    // thromp
-    sound_files.push_back(utf8_to_path("enemy/thromp/hit.ogg"));
-    sound_files.push_back(utf8_to_path("enemy/thromp/die.ogg"));
-    // army
-    sound_files.push_back(utf8_to_path("enemy/army/hit.ogg"));
-    sound_files.push_back(utf8_to_path("enemy/army/shell/hit.ogg"));
-    sound_files.push_back(utf8_to_path("enemy/army/stand_up.wav"));
-    // turtle boss
-    sound_files.push_back(utf8_to_path("enemy/boss/turtle/big_hit.ogg"));
-    sound_files.push_back(utf8_to_path("enemy/boss/turtle/shell_attack.ogg"));
-    sound_files.push_back(utf8_to_path("enemy/boss/turtle/power_up.ogg"));
-
-    // default
-    sound_files.push_back(utf8_to_path("sprout_1.ogg"));
-    sound_files.push_back(utf8_to_path("stomp_1.ogg"));
-    sound_files.push_back(utf8_to_path("stomp_4.ogg"));
-
-    // savegame
-    sound_files.push_back(utf8_to_path("savegame_load.ogg"));
-    sound_files.push_back(utf8_to_path("savegame_save.ogg"));
-
-    // overworld
-    sound_files.push_back(utf8_to_path("waypoint_reached.ogg"));
+    for (vector<fs::path>::iterator itr = manifest.m_sounds.begin(); itr != manifest.m_sounds.end(); ++itr) {
+        Sound_Handle handle = pSound_Manager->Get_Handle(*itr);
+
+        // not found or already loaded
+        if (!handle || pSound_Manager->Get_Handle_Sound(handle)) {
+            continue;
+        }
+        if (std::find(sound_handles.begin(), sound_handles.end(), handle) != sound_handles.end()) {
+            continue;
+        }
+
+        sound_handles.push_back(handle);
+        sound_files.push_back(pSound_Manager->Get_Handle_Filename(handle));
+    }
+
+    // decoded sounds
+    vector<cSound*> sounds(sound_files.size(), NULL);
+    cAsset_Preloader preloader(sound_files.size(), boost::bind(&Preload_Sound_Job, boost::cref(sound_files), boost::ref(sounds), _1));
 
     unsigned int loaded_files = 0;
     unsigned int file_count = sound_files.size();
+    vector<size_t> finished;
 
-    // load images
-    for (vector<fs::path>::iterator itr = sound_files.begin(); itr != sound_files.end(); ++itr) {
-        // get filename
-        fs::path filename = (*itr);
+    while (preloader.Wait_Finished(finished, 16)) {
+        for (vector<size_t>::iterator itr = finished.begin(); itr != finished.end(); ++itr) {
+            if (sounds[*itr]) {
+                pSound_Manager->Add(sounds[*itr], sound_handles[*itr]);
+            }
+            else {
+                cerr << "Warning: Could not load sound file '" << path_to_utf8(sound_files[*itr]) << "'" << endl;
+            }
 
-        // preload it
-        pAudio->Get_Sound_File(filename);
+            // count files
+            loaded_files++;
+        }
 
-        // count files
-        loaded_files++;
+        finished.clear();
 
         if (draw_gui) {
             // update progress
@@ -180,6 +180,7 @@ namespace TSC {
 #define USER_WORLD_DIR "worlds"
 #define USER_CAMPAIGN_DIR "campaigns"
 #define USER_IMGCACHE_DIR "images"
+#define USER_BYTECODE_CACHE_DIR "bytecode"
 #define USER_SCRIPTING_DIR "scripting"
 
     /* *** *** *** *** *** *** *** forward declarations *** *** *** *** *** *** *** *** *** *** */
@@ -189,6 +190,8 @@ namespace TSC {
 
     /* *** speedfactor framerate *** */
     static const int speedfactor_fps = 32;
+    /* *** fixed simulation steps per second *** */
+    static const int simulation_fps = 64;
 
     /* *** level engine version *** */
     static const int level_engine_version = 48;
@@ -403,7 +406,14 @@ namespace TSC {
         // rendering
         PERF_RENDER_GAME = 13,
         PERF_RENDER_GUI = 20,
-        PERF_RENDER_BUFFER = 21
+        PERF_RENDER_BUFFER = 21,
+        // waiting for the render thread
+        PERF_RENDER_WAIT = 25,
+        // measured in the render thread
+        PERF_RENDER_THREAD = 24,
+        // scripting
+        PERF_SCRIPTING_INTERPRETER = 26,
+        PERF_SCRIPTING_BYTECODE = 27
     };
 
     /* *** Classes *** */
@@ -431,9 +441,11 @@ namespace TSC {
     class cRect_Request;
     class cSave_Level_Object;
     class cSaved_Texture;
+    class cScreenshot_Capture;
     class cSize_Float;
     class cSize_Int;
     class cSprite_Manager;
+    class cSprite_Shader;
     class cSurface_Request;
     class cSprite;
     class cBackground_Manager;
@@ -37,10 +37,15 @@
 #include "../input/mouse.hpp"
 #include "../user/savegame/savegame.hpp"
 #include "../input/keyboard.hpp"
+#include "../input/input_recorder.hpp"
 #include "../video/renderer.hpp"
 #include "../video/loading_screen.hpp"
 #include "../video/img_settings.hpp"
 #include "../video/img_manager.hpp"
+#include "../video/img_set.hpp"
+#include "../video/screenshot.hpp"
+#include "../scripting/bytecode_cache.hpp"
+#include "../core/filesystem/async_file_writer.hpp"
 #include "../core/i18n.hpp"
 #include "../gui/generic.hpp"
 #include "../gui/game_console.hpp"
@@ -95,6 +100,11 @@ int main(int argc, char** argv)
 
     // convert arguments to a vector string
     vector<std::string> arguments(argv, argv + argc);
+    // input recording files
+    std::string record_filename;
+    std::string replay_filename;
+    // continuous capture frame interval
+    unsigned int capture_interval = 0;
 
     if (argc >= 2) {
         for (unsigned int i = 1; i < arguments.size(); i++) {
@@ -107,6 +117,9 @@ int main(int argc, char** argv)
                 cout << "-d, --debug\tEnable debug modes with the options : game performance" << endl;
                 cout << "-l, --level\tLoad the given level" << endl;
                 cout << "-w, --world\tLoad the given world" << endl;
+                cout << "--record\tRecord the input to the given file" << endl;
+                cout << "--replay\tReplay the input of the given file and compare the game state" << endl;
+                cout << "--capture\tSave every given number of frames to the capture directory" << endl;
                 return EXIT_SUCCESS;
             }
             // version
@@ -148,6 +161,37 @@ int main(int argc, char** argv)
                     }
                 }
             }
+            // input recording
+            else if (arguments[i] == "--record" || arguments[i] == "--replay") {
+                // no value
+                if (i + 1 >= arguments.size()) {
+                    cerr << arguments[i] << " requires a value" << endl;
+                    return EXIT_FAILURE;
+                }
+
+                if (arguments[i] == "--record") {
+                    record_filename = arguments[i + 1];
+                }
+                else {
+                    replay_filename = arguments[i + 1];
+                }
+
+                // skip value
+                i++;
+            }
+            // continuous screen capture
+            else if (arguments[i] == "--capture") {
+                // no value
+                if (i + 1 >= arguments.size() || string_to_int(arguments[i + 1]) <= 0) {
+                    cerr << arguments[i] << " requires a frame interval" << endl;
+                    return EXIT_FAILURE;
+                }
+
+                capture_interval = string_to_int(arguments[i + 1]);
+
+                // skip value
+                i++;
+            }
             // level loading is handled later
             else if (arguments[i] == "--level" || arguments[i] == "-l") {
                 // skip
@@ -164,6 +208,31 @@ int main(int argc, char** argv)
         }
     }
 
+    // command line level
+    std::string level_name;
+
+    if (argc > 2 && (arguments[1] == "--level" || arguments[1] == "-l")) {
+        level_name = arguments[2];
+    }
+
+    pInput_Recorder = new cInput_Recorder();
+
+    if (!replay_filename.empty()) {
+        if (!pInput_Recorder->Start_Replay(utf8_to_path(replay_filename))) {
+            delete pInput_Recorder;
+            return EXIT_FAILURE;
+        }
+
+        // replay in the recorded level
+        level_name = pInput_Recorder->m_level;
+    }
+    else if (!record_filename.empty()) {
+        if (!pInput_Recorder->Start_Recording(utf8_to_path(record_filename), static_cast<unsigned int>(time(NULL)), level_name)) {
+            delete pInput_Recorder;
+            return EXIT_FAILURE;
+        }
+    }
+
     do {
         game_reset = false;
         game_exit = false;
@@ -171,11 +240,15 @@ int main(int argc, char** argv)
         // initialize everything
         Init_Game();
 
+        if (capture_interval) {
+            pVideo->mp_screenshot_capture->Set_Continuous(capture_interval);
+        }
+
         // command line level entering
-        if (argc > 2 && (arguments[1] == "--level" || arguments[1] == "-l") && !arguments[2].empty()) {
+        if (!level_name.empty()) {
             Game_Action = GA_ENTER_LEVEL;
             Game_Mode_Type = MODE_TYPE_LEVEL_CUSTOM;
-            Game_Action_Data_Middle.add("load_level", arguments[2]);
+            Game_Action_Data_Middle.add("load_level", level_name);
         }
         // command line world entering
         else if (argc > 2 && (arguments[1] == "--world" || arguments[1] == "-w") && !arguments[2].empty()) {
@@ -204,11 +277,7 @@ int main(int argc, char** argv)
                 Draw_Game();
 
                 // render
-#ifdef TSC_RENDER_THREAD_TEST
-                pVideo->Render(1);
-#else
-                pVideo->Render();
-#endif
+                pVideo->Render(pPreferences->m_video_render_thread);
 
                 // update speedfactor
                 pFramerate->Update();
@@ -234,8 +303,13 @@ int main(int argc, char** argv)
 
         // reset should start fresh, so reset level and world
         argc = 0;
+        level_name.clear();
 
     } while (game_reset);
+
+    delete pInput_Recorder;
+    pInput_Recorder = NULL;
+
     return EXIT_SUCCESS;
 }
 
@@ -244,8 +318,13 @@ namespace TSC {
 
 void Init_Game(void)
 {
-    // init random number generator
-    srand(static_cast<unsigned int>(time(NULL)));
+    // init random number generator, recorded input needs the same random numbers
+    if (pInput_Recorder->Is_Recording() || pInput_Recorder->Is_Replaying()) {
+        srand(pInput_Recorder->m_seed);
+    }
+    else {
+        srand(static_cast<unsigned int>(time(NULL)));
+    }
 
     // Init Stage 1 - core classes
     debug_print("Initializing resource manager and core classes\n");
@@ -258,6 +337,8 @@ void Init_Game(void)
     pImage_Manager = new cImage_Manager();
     pSound_Manager = new cSound_Manager();
     pSettingsParser = new cImage_Settings_Parser();
+    pImageSet_Cache = new cImageSet_Cache();
+    pAsync_File_Writer = new cAsync_File_Writer();
 
     // Init Stage 2 - set preferences and init audio and the video screen
 
@@ -271,6 +352,8 @@ void Init_Game(void)
     I18N_Init();
     // init user dir directory
     pResource_Manager->Init_User_Directory();
+    // compiled scripts
+    Scripting::pBytecode_Cache = new Scripting::cBytecode_Cache(pResource_Manager->Get_User_Bytecode_Cache_Directory());
     // framerate init
     pFramerate->Init();
     // audio init
@@ -341,10 +424,20 @@ void Init_Game(void)
 // global try/catch construct's catch{} clause.
 void Exit_Game(void)
 {
+    // the render thread may still render the last frame
+    if (pVideo) {
+        pVideo->Render_Finish();
+    }
+
     if (pPreferences) {
         pPreferences->Save();
     }
 
+    // hash the game state before the level is gone
+    if (pInput_Recorder) {
+        pInput_Recorder->Finish();
+    }
+
     pLevel_Manager->Unload();
     pMenuCore->m_handler->m_level->Unload();
 
@@ -458,6 +551,22 @@ void Exit_Game(void)
         pImage_Manager = NULL;
     }
 
+    if (pImageSet_Cache) {
+        delete pImageSet_Cache;
+        pImageSet_Cache = NULL;
+    }
+
+    if (Scripting::pBytecode_Cache) {
+        delete Scripting::pBytecode_Cache;
+        Scripting::pBytecode_Cache = NULL;
+    }
+
+    // waits for pending writes
+    if (pAsync_File_Writer) {
+        delete pAsync_File_Writer;
+        pAsync_File_Writer = NULL;
+    }
+
     if (pSettingsParser) {
         delete pSettingsParser;
         pSettingsParser = NULL;
@@ -591,13 +700,42 @@ void Update_Game(void)
     Handle_Game_Events();
 
     // ## input
+    // recorded before the input as handling it may start blocking loops
+    pInput_Recorder->Record_Frame(pFramerate->m_speed_factor);
+
+    if (pInput_Recorder->Is_Replaying()) {
+        if (!pInput_Recorder->Replay_Frame()) {
+            game_exit = 1;
+            return;
+        }
+
+        pFramerate->m_speed_factor = pInput_Recorder->m_frame_speed_factor;
+    }
+
     // Actually `input_event' is a global variable that is also queried elsewhere
     // in the code (uaaah, poor design).
     while (pVideo->PollEvent(input_event)) {
+        if (cInput_Recorder::Is_Input_Event(input_event)) {
+            // the replay provides the input
+            if (pInput_Recorder->Is_Replaying()) {
+                continue;
+            }
+
+            pInput_Recorder->Set_Dispatched();
+        }
+
         // handle
         Handle_Input_Global(input_event);
     }
 
+    // replayed input
+    while (pInput_Recorder->Replay_Event(input_event)) {
+        // would wait for the focus
+        if (input_event.type != sf::Event::LostFocus) {
+            Handle_Input_Global(input_event);
+        }
+    }
+
     pMouseCursor->Update();
 
     // ## audio
@@ -607,8 +745,8 @@ void Update_Game(void)
     // performance measuring
     pFramerate->m_perf_last_ticks = TSC_GetTicks();
 
-    // ## hud
-    gp_hud->Update();
+    // ## background saves
+    pSavegame->Update();
 
     // ## game console
     gp_game_console->Update();
@@ -616,6 +754,38 @@ void Update_Game(void)
     // ## debug window
     gp_debug_window->Update();
 
+    /* ## simulation
+     * in fixed steps independent of the framerate, the frame speed factor
+     * is kept for everything else like screen effects
+    */
+    const float frame_speed_factor = pFramerate->m_speed_factor;
+    unsigned int steps = pFramerate->Get_Simulation_Steps();
+
+    if (pInput_Recorder->Is_Replaying()) {
+        steps = pInput_Recorder->m_frame_steps;
+    }
+
+    // exiting ends the steps early in the same way when replayed
+    pInput_Recorder->Record_Steps(steps);
+
+    for (unsigned int i = 0; i < steps && !game_exit && Game_Action == GA_NONE; i++) {
+        // set every step as blocking animations may have changed it
+        pFramerate->m_speed_factor = cFramerate::Get_Step_Speed_Factor();
+
+        Update_Game_Step();
+    }
+
+    pFramerate->m_speed_factor = frame_speed_factor;
+
+    // gui
+    Gui_Handle_Time();
+}
+
+void Update_Game_Step(void)
+{
+    // ## hud
+    gp_hud->Update();
+
     // ## update
     if (Game_Mode == MODE_LEVEL) {
         pLevel_Manager->Update();
@@ -632,9 +802,6 @@ void Update_Game(void)
     else if (Game_Mode == MODE_SCENE) {
         pActive_Scene->Update();
     }
-
-    // gui
-    Gui_Handle_Time();
 }
 
 void Draw_Game(void)
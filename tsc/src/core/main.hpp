@@ -39,6 +39,11 @@ namespace TSC {
     */
     void Update_Game(void);
 
+    /* Update the game state by one fixed simulation step
+     * Called by Update_Game() as often as the elapsed time requires.
+    */
+    void Update_Game_Step(void);
+
     /* Draw current game state
      * Should be called continuously from Game Loop.
     */
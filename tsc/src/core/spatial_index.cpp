@@ -0,0 +1,231 @@
+/***************************************************************************
+ * spatial_index.cpp - grid of static sprites for visibility queries
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../core/spatial_index.hpp"
+#include "../core/global_basic.hpp"
+
+using namespace std;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** *** cSpatial_Index *** *** *** *** *** *** *** *** *** *** */
+
+const float cSpatial_Index::m_cell_size = 512.0f;
+const float cSpatial_Index::m_query_margin = 64.0f;
+
+cSpatial_Index::cSpatial_Index(void)
+{
+    m_built = 0;
+    m_indexed_count = 0;
+    m_grid_x = 0.0f;
+    m_grid_y = 0.0f;
+    m_columns = 0;
+    m_rows = 0;
+    m_max_w = 0.0f;
+    m_max_h = 0.0f;
+}
+
+cSpatial_Index::~cSpatial_Index(void)
+{
+    Clear();
+}
+
+bool cSpatial_Index::Is_Indexable(const cSprite* sprite)
+{
+    // only basic sprites use the default drawing rules and never move by themselves
+    if (sprite->m_type != TYPE_UNDEFINED) {
+        return 0;
+    }
+
+    // drawn relative to the screen
+    if (sprite->m_no_camera || sprite->m_auto_destroy) {
+        return 0;
+    }
+
+    return 1;
+}
+
+void cSpatial_Index::Build(const cSprite_List& objects)
+{
+    Clear();
+
+    cSprite_List indexed;
+
+    for (cSprite_List::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+        cSprite* obj = (*itr);
+
+        if (!Is_Indexable(obj)) {
+            m_dynamic.push_back(obj);
+            continue;
+        }
+
+        // grid bounds
+        if (indexed.empty()) {
+            m_grid_x = obj->m_rect.m_x;
+            m_grid_y = obj->m_rect.m_y;
+        }
+        else {
+            m_grid_x = std::min(m_grid_x, obj->m_rect.m_x);
+            m_grid_y = std::min(m_grid_y, obj->m_rect.m_y);
+        }
+
+        m_max_w = std::max(m_max_w, obj->m_rect.m_w);
+        m_max_h = std::max(m_max_h, obj->m_rect.m_h);
+
+        indexed.push_back(obj);
+    }
+
+    m_built = 1;
+
+    if (indexed.empty()) {
+        return;
+    }
+
+    float grid_right = m_grid_x;
+    float grid_bottom = m_grid_y;
+
+    for (cSprite_List::iterator itr = indexed.begin(); itr != indexed.end(); ++itr) {
+        grid_right = std::max(grid_right, (*itr)->m_rect.m_x);
+        grid_bottom = std::max(grid_bottom, (*itr)->m_rect.m_y);
+    }
+
+    m_columns = static_cast<unsigned int>((grid_right - m_grid_x) / m_cell_size) + 1;
+    m_rows = static_cast<unsigned int>((grid_bottom - m_grid_y) / m_cell_size) + 1;
+    m_cells.resize(m_columns * m_rows);
+
+    for (cSprite_List::iterator itr = indexed.begin(); itr != indexed.end(); ++itr) {
+        cSprite* obj = (*itr);
+        const unsigned int cell = Get_Cell(obj->m_rect.m_x, obj->m_rect.m_y);
+
+        m_cells[cell].push_back(obj);
+        m_sprite_cell[obj] = cell;
+        obj->m_spatial_indexed = 1;
+    }
+
+    m_indexed_count = indexed.size();
+
+    debug_print("Indexed %u sprites in %ux%u cells, %u dynamic\n", m_indexed_count, m_columns, m_rows, static_cast<unsigned int>(m_dynamic.size()));
+}
+
+void cSpatial_Index::Clear(void)
+{
+    for (vector<cSprite_List>::iterator itr = m_cells.begin(); itr != m_cells.end(); ++itr) {
+        for (cSprite_List::iterator obj_itr = itr->begin(); obj_itr != itr->end(); ++obj_itr) {
+            (*obj_itr)->m_spatial_indexed = 0;
+        }
+    }
+
+    m_cells.clear();
+    m_sprite_cell.clear();
+    m_dynamic.clear();
+
+    m_built = 0;
+    m_indexed_count = 0;
+    m_columns = 0;
+    m_rows = 0;
+    m_max_w = 0.0f;
+    m_max_h = 0.0f;
+}
+
+void cSpatial_Index::Add(cSprite* sprite)
+{
+    if (!m_built) {
+        return;
+    }
+
+    m_dynamic.push_back(sprite);
+}
+
+void cSpatial_Index::Remove(cSprite* sprite)
+{
+    if (!m_built) {
+        return;
+    }
+
+    if (sprite->m_spatial_indexed) {
+        std::unordered_map<cSprite*, unsigned int>::iterator cell_itr = m_sprite_cell.find(sprite);
+
+        if (cell_itr != m_sprite_cell.end()) {
+            cSprite_List& cell = m_cells[cell_itr->second];
+            cell.erase(std::find(cell.begin(), cell.end(), sprite));
+            m_sprite_cell.erase(cell_itr);
+            m_indexed_count--;
+        }
+
+        sprite->m_spatial_indexed = 0;
+        return;
+    }
+
+    cSprite_List::iterator itr = std::find(m_dynamic.begin(), m_dynamic.end(), sprite);
+
+    if (itr != m_dynamic.end()) {
+        m_dynamic.erase(itr);
+    }
+}
+
+void cSpatial_Index::Changed(cSprite* sprite)
+{
+    // it may move again
+    Remove(sprite);
+    Add(sprite);
+}
+
+void cSpatial_Index::Get_Visible(cSprite_List& objects, const GL_rect& rect) const
+{
+    objects.insert(objects.end(), m_dynamic.begin(), m_dynamic.end());
+
+    if (m_cells.empty()) {
+        return;
+    }
+
+    /* sprites are sorted in by their top left corner
+     * so the biggest image can reach in from the left and top
+    */
+    const float left = rect.m_x - m_max_w - m_query_margin;
+    const float top = rect.m_y - m_max_h - m_query_margin;
+    const float right = rect.m_x + rect.m_w + m_query_margin;
+    const float bottom = rect.m_y + rect.m_h + m_query_margin;
+
+    // completely outside of the grid
+    if (right < m_grid_x || bottom < m_grid_y ||
+            left > m_grid_x + (m_columns * m_cell_size) || top > m_grid_y + (m_rows * m_cell_size)) {
+        return;
+    }
+
+    const unsigned int first_cell = Get_Cell(left, top);
+    const unsigned int last_cell = Get_Cell(right, bottom);
+
+    for (unsigned int row = first_cell / m_columns; row <= last_cell / m_columns; row++) {
+        for (unsigned int column = first_cell % m_columns; column <= last_cell % m_columns; column++) {
+            const cSprite_List& cell = m_cells[(row * m_columns) + column];
+            objects.insert(objects.end(), cell.begin(), cell.end());
+        }
+    }
+}
+
+unsigned int cSpatial_Index::Get_Cell(float x, float y) const
+{
+    int column = static_cast<int>((x - m_grid_x) / m_cell_size);
+    int row = static_cast<int>((y - m_grid_y) / m_cell_size);
+
+    column = Clamp(column, 0, static_cast<int>(m_columns) - 1);
+    row = Clamp(row, 0, static_cast<int>(m_rows) - 1);
+
+    return (row * m_columns) + column;
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
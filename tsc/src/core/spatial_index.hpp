@@ -0,0 +1,97 @@
+/***************************************************************************
+ * spatial_index.hpp - grid of static sprites for visibility queries
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_SPATIAL_INDEX_HPP
+#define TSC_SPATIAL_INDEX_HPP
+
+#include "../core/global_game.hpp"
+#include "../core/math/rect.hpp"
+#include "../objects/sprite.hpp"
+
+namespace TSC {
+
+    /* *** *** *** *** *** *** *** cSpatial_Index *** *** *** *** *** *** *** *** *** *** */
+
+    /* Sorts the basic sprites of a level into a grid of cells by
+     * the top left corner of their image rect. A visibility query
+     * then only has to look at the cells around the camera and at
+     * the short list of sprites that can move or have their own
+     * drawing rules, instead of at every sprite of the level.
+     *
+     * The query only preselects, the sprites still decide with
+     * Is_Draw_Valid() if they are drawn. An indexed sprite that
+     * changes its position or size is moved to the dynamic list.
+    */
+    class cSpatial_Index {
+    public:
+        cSpatial_Index(void);
+        ~cSpatial_Index(void);
+
+        // Index the given sprites
+        void Build(const cSprite_List& objects);
+        // Remove all sprites and disable the index
+        void Clear(void);
+
+        // Add a new sprite to the dynamic list
+        void Add(cSprite* sprite);
+        // Remove the given sprite
+        void Remove(cSprite* sprite);
+        // The given indexed sprite moved or changed its size
+        void Changed(cSprite* sprite);
+
+        /* Add all dynamic sprites and the indexed sprites
+         * which could be visible in the given rect
+        */
+        void Get_Visible(cSprite_List& objects, const GL_rect& rect) const;
+
+        // Returns true if the given sprite can be indexed
+        static bool Is_Indexable(const cSprite* sprite);
+
+        // if set the index is in use
+        bool m_built;
+        // sprites not in the grid
+        cSprite_List m_dynamic;
+        // amount of indexed sprites
+        unsigned int m_indexed_count;
+
+        // grid cell size
+        static const float m_cell_size;
+        // extra space around queries for shadows and rotations
+        static const float m_query_margin;
+    private:
+        // Returns the cell of the given position, clamped to the grid
+        unsigned int Get_Cell(float x, float y) const;
+
+        // indexed sprites of each cell
+        vector<cSprite_List> m_cells;
+        // cell of each indexed sprite
+        std::unordered_map<cSprite*, unsigned int> m_sprite_cell;
+
+        // top left grid position
+        float m_grid_x;
+        float m_grid_y;
+        // grid size in cells
+        unsigned int m_columns;
+        unsigned int m_rows;
+        // biggest indexed image size
+        float m_max_w;
+        float m_max_h;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
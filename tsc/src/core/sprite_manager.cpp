@@ -20,6 +20,7 @@
 #include "../input/mouse.hpp"
 #include "../overworld/world_player.hpp"
 #include "../enemies/enemy.hpp"
+#include "../core/math/utilities.hpp"
 #include "../core/global_basic.hpp"
 
 using namespace std;
@@ -28,14 +29,21 @@ namespace TSC {
 
 /* *** *** *** *** *** *** cSprite_Manager *** *** *** *** *** *** *** *** *** *** *** */
 
+const float cSprite_Manager::m_max_interpolation_distance = 100.0f;
+
 cSprite_Manager::cSprite_Manager(unsigned int reserve_items /* = 2000 */, unsigned int zpos_items /* = 100 */)
     : cObject_Manager<cSprite>()
 {
     objects.reserve(reserve_items);
 
     m_max_uid_mark = 1; // UID 0 is reserved for the player
+    m_first_order = 0;
+    m_last_order = 0;
     m_z_pos_data.assign(zpos_items, 0.0f);
     m_z_pos_data_editor.assign(zpos_items,0.0f);
+
+    m_drawn_count = 0;
+    m_culled_count = 0;
 }
 
 cSprite_Manager::~cSprite_Manager(void)
@@ -87,10 +95,18 @@ void cSprite_Manager::Add(cSprite* sprite)
         if (obj->m_auto_destroy) {
             // set new object
             *itr = sprite;
+            sprite->m_manager_order = obj->m_manager_order;
 
             // Release old sprite’s UID by putting it back into the UID pool
             m_uid_pool.insert(obj->m_uid);
 
+            m_static_collision.Remove(obj);
+            m_static_render_cache.Remove(obj);
+            m_spatial_index.Remove(obj);
+            m_spatial_index.Add(sprite);
+            Unregister_Type(obj);
+            Register_Type(sprite);
+
             // delete old
             delete obj;
 
@@ -98,7 +114,10 @@ void cSprite_Manager::Add(cSprite* sprite)
         }
     }
 
+    sprite->m_manager_order = ++m_last_order;
     cObject_Manager<cSprite>::Add(sprite);
+    m_spatial_index.Add(sprite);
+    Register_Type(sprite);
 }
 
 cSprite* cSprite_Manager::Copy(unsigned int identifier)
@@ -182,6 +201,7 @@ void cSprite_Manager::Move_To_Front(cSprite* sprite)
     objects.erase(itr);
     objects.front() = sprite;
     objects.insert(objects.begin() + 1, first);
+    sprite->m_manager_order = --m_first_order;
 
     // make it the first z position
     sprite->m_pos_z = Get_First(sprite->m_type)->m_pos_z - cSprite::m_pos_z_delta;
@@ -213,13 +233,40 @@ void cSprite_Manager::Move_To_Back(cSprite* sprite)
     objects.erase(itr);
     objects.back() = sprite;
     objects.insert(objects.end() - 1, last);
+    sprite->m_manager_order = ++m_last_order;
 
     // make it the last z position
     Ensure_Different_Z(sprite);
 }
 
+bool cSprite_Manager::Delete(size_t array_num, bool delete_data /* = 1 */)
+{
+    if (array_num < objects.size()) {
+        m_static_collision.Remove(objects[array_num]);
+        m_static_render_cache.Remove(objects[array_num]);
+        m_spatial_index.Remove(objects[array_num]);
+        Unregister_Type(objects[array_num]);
+    }
+
+    return cObject_Manager<cSprite>::Delete(array_num, delete_data);
+}
+
+bool cSprite_Manager::Delete(cSprite* obj, bool delete_data /* = 1 */)
+{
+    if (obj) {
+        m_static_collision.Remove(obj);
+        m_static_render_cache.Remove(obj);
+        m_spatial_index.Remove(obj);
+        Unregister_Type(obj);
+    }
+
+    return cObject_Manager<cSprite>::Delete(obj, delete_data);
+}
+
 void cSprite_Manager::Delete_All(bool delayed /* = 0 */)
 {
+    Clear_Static_Data();
+
     // delayed
     if (delayed) {
         for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
@@ -237,6 +284,8 @@ void cSprite_Manager::Delete_All(bool delayed /* = 0 */)
             cSprite* obj = (*itr);
 
             if (obj->m_disallow_managed_delete) {
+                obj->m_registered_type = -1;
+                obj->m_registered_array = -1;
                 itr = objects.erase(itr);
             }
             // increment
@@ -246,6 +295,16 @@ void cSprite_Manager::Delete_All(bool delayed /* = 0 */)
         }
 
         cObject_Manager<cSprite>::Delete_All();
+
+        for (Type_Registry::iterator itr = m_type_objects.begin(); itr != m_type_objects.end(); ++itr) {
+            itr->clear();
+        }
+        for (Type_Registry::iterator itr = m_array_objects.begin(); itr != m_array_objects.end(); ++itr) {
+            itr->clear();
+        }
+
+        m_first_order = 0;
+        m_last_order = 0;
     }
 
     // Empty the UID pool, we have no sprites anymore
@@ -256,11 +315,244 @@ void cSprite_Manager::Delete_All(bool delayed /* = 0 */)
     std::fill(m_z_pos_data_editor.begin(), m_z_pos_data_editor.end(), 0.0f);
 }
 
+void cSprite_Manager::Build_Static_Data(const std::string& script_code /* = "" */)
+{
+    m_static_collision.Build(objects, script_code);
+    m_static_render_cache.Build(objects, script_code);
+    // the indexed sprites are only saved again when they moved
+    Save_Positions();
+    m_spatial_index.Build(objects);
+}
+
+void cSprite_Manager::Clear_Static_Data(void)
+{
+    m_static_collision.Clear();
+    m_static_render_cache.Clear();
+    m_spatial_index.Clear();
+}
+
+void cSprite_Manager::Update_Items_Valid_Draw(void)
+{
+    // no index
+    if (!m_spatial_index.m_built) {
+        for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+            (*itr)->Update_Valid_Draw();
+        }
+
+        return;
+    }
+
+    /* sprites outside of the query keep their old state
+     * but are not drawn by Draw_Items()
+    */
+    m_visible_objects.clear();
+    m_spatial_index.Get_Visible(m_visible_objects, GL_rect(pActive_Camera->m_x, pActive_Camera->m_y, static_cast<float>(game_res_w), static_cast<float>(game_res_h)));
+
+    for (cSprite_List::iterator itr = m_visible_objects.begin(); itr != m_visible_objects.end(); ++itr) {
+        (*itr)->Update_Valid_Draw();
+    }
+}
+
+void cSprite_Manager::Draw_Items(void)
+{
+    m_static_render_cache.Draw();
+
+    cSprite_List* draw_objects = &objects;
+
+    if (m_spatial_index.m_built) {
+        m_visible_objects.clear();
+        m_spatial_index.Get_Visible(m_visible_objects, GL_rect(pActive_Camera->m_x, pActive_Camera->m_y, static_cast<float>(game_res_w), static_cast<float>(game_res_h)));
+        draw_objects = &m_visible_objects;
+    }
+
+    m_drawn_count = 0;
+    m_culled_count = objects.size() - draw_objects->size();
+
+    for (cSprite_List::iterator itr = draw_objects->begin(); itr != draw_objects->end(); ++itr) {
+        cSprite* obj = (*itr);
+
+        if (obj->m_valid_draw) {
+            m_drawn_count++;
+        }
+
+        obj->Draw();
+    }
+}
+
+void cSprite_Manager::Save_Positions(bool with_player /* = 0 */)
+{
+    // indexed sprites did not move since their position was saved in Build_Static_Data()
+    cSprite_List& moving_objects = m_spatial_index.m_built ? m_spatial_index.m_dynamic : objects;
+
+    for (cSprite_List::iterator itr = moving_objects.begin(); itr != moving_objects.end(); ++itr) {
+        cSprite* obj = (*itr);
+
+        obj->m_prev_pos_x = obj->m_pos_x;
+        obj->m_prev_pos_y = obj->m_pos_y;
+    }
+
+    if (with_player) {
+        pActive_Player->m_prev_pos_x = pActive_Player->m_pos_x;
+        pActive_Player->m_prev_pos_y = pActive_Player->m_pos_y;
+    }
+}
+
+void cSprite_Manager::Interpolate_Positions(float alpha, bool with_player /* = 0 */)
+{
+    Restore_Positions();
+
+    cSprite_List& moving_objects = m_spatial_index.m_built ? m_spatial_index.m_dynamic : objects;
+
+    for (cSprite_List::iterator itr = moving_objects.begin(); itr != moving_objects.end(); ++itr) {
+        Interpolate_Position(*itr, alpha);
+    }
+
+    if (with_player) {
+        Interpolate_Position(pActive_Player, alpha);
+    }
+}
+
+void cSprite_Manager::Restore_Positions(void)
+{
+    for (vector<Interpolated_Sprite>::iterator itr = m_interpolated.begin(); itr != m_interpolated.end(); ++itr) {
+        itr->m_sprite->m_pos_x = itr->m_pos_x;
+        itr->m_sprite->m_pos_y = itr->m_pos_y;
+    }
+
+    m_interpolated.clear();
+}
+
+void cSprite_Manager::Interpolate_Position(cSprite* sprite, float alpha)
+{
+    const float diff_x = sprite->m_pos_x - sprite->m_prev_pos_x;
+    const float diff_y = sprite->m_pos_y - sprite->m_prev_pos_y;
+
+    // not moved
+    if (Is_Float_Equal(diff_x, 0.0f) && Is_Float_Equal(diff_y, 0.0f)) {
+        return;
+    }
+    // jumped like when spawned or warped
+    if (fabs(diff_x) > m_max_interpolation_distance || fabs(diff_y) > m_max_interpolation_distance) {
+        return;
+    }
+
+    Interpolated_Sprite interpolated;
+    interpolated.m_sprite = sprite;
+    interpolated.m_pos_x = sprite->m_pos_x;
+    interpolated.m_pos_y = sprite->m_pos_y;
+    m_interpolated.push_back(interpolated);
+
+    // only the drawing position, the rects stay at the simulated position
+    sprite->m_pos_x = sprite->m_prev_pos_x + (diff_x * alpha);
+    sprite->m_pos_y = sprite->m_prev_pos_y + (diff_y * alpha);
+}
+
+void cSprite_Manager::Register_Type(cSprite* sprite)
+{
+    if (static_cast<size_t>(sprite->m_type) >= m_type_objects.size()) {
+        m_type_objects.resize(sprite->m_type + 1);
+    }
+    if (static_cast<size_t>(sprite->m_sprite_array) >= m_array_objects.size()) {
+        m_array_objects.resize(sprite->m_sprite_array + 1);
+    }
+
+    cSprite_List& type_list = m_type_objects[sprite->m_type];
+    cSprite_List& array_list = m_array_objects[sprite->m_sprite_array];
+
+    sprite->m_registered_type = sprite->m_type;
+    sprite->m_type_slot = type_list.size();
+    type_list.push_back(sprite);
+    sprite->m_registered_array = sprite->m_sprite_array;
+    sprite->m_array_slot = array_list.size();
+    array_list.push_back(sprite);
+}
+
+// check if the sprite is registered at the given slot of this registry
+static bool Is_Registered_In(const vector<cSprite_List>& registry, int num, unsigned int slot, const cSprite* sprite)
+{
+    return num >= 0 && static_cast<size_t>(num) < registry.size() && slot < registry[num].size() && registry[num][slot] == sprite;
+}
+
+// remove the slot by moving the last sprite of the list into it
+static void Unregister_From(cSprite_List& list, unsigned int slot, unsigned int cSprite::* slot_member)
+{
+    cSprite* last = list.back();
+    list[slot] = last;
+    last->*slot_member = slot;
+    list.pop_back();
+}
+
+void cSprite_Manager::Unregister_Type(cSprite* sprite)
+{
+    if (Is_Registered_In(m_type_objects, sprite->m_registered_type, sprite->m_type_slot, sprite)) {
+        Unregister_From(m_type_objects[sprite->m_registered_type], sprite->m_type_slot, &cSprite::m_type_slot);
+    }
+    if (Is_Registered_In(m_array_objects, sprite->m_registered_array, sprite->m_array_slot, sprite)) {
+        Unregister_From(m_array_objects[sprite->m_registered_array], sprite->m_array_slot, &cSprite::m_array_slot);
+    }
+
+    sprite->m_registered_type = -1;
+    sprite->m_registered_array = -1;
+}
+
+void cSprite_Manager::Type_Changed(cSprite* sprite)
+{
+    if (sprite->m_registered_type == sprite->m_type && sprite->m_registered_array == sprite->m_sprite_array) {
+        return;
+    }
+
+    // not added yet or registered with another manager
+    if (!Is_Registered_In(m_type_objects, sprite->m_registered_type, sprite->m_type_slot, sprite)) {
+        return;
+    }
+
+    Unregister_Type(sprite);
+    Register_Type(sprite);
+}
+
+void cSprite_Manager::Get_Objects_by_Type(const SpriteType type, cSprite_List& type_objects) const
+{
+    if (static_cast<size_t>(type) >= m_type_objects.size()) {
+        return;
+    }
+
+    const cSprite_List& list = m_type_objects[type];
+
+    for (cSprite_List::const_iterator itr = list.begin(); itr != list.end(); ++itr) {
+        // skip objects with a directly changed type
+        if ((*itr)->m_type == type) {
+            type_objects.push_back(*itr);
+        }
+    }
+}
+
+void cSprite_Manager::Get_Objects_by_Array(const ArrayType sprite_array, cSprite_List& array_objects) const
+{
+    if (static_cast<size_t>(sprite_array) >= m_array_objects.size()) {
+        return;
+    }
+
+    const cSprite_List& list = m_array_objects[sprite_array];
+
+    for (cSprite_List::const_iterator itr = list.begin(); itr != list.end(); ++itr) {
+        // skip objects with a directly changed sprite array
+        if ((*itr)->m_sprite_array == sprite_array) {
+            array_objects.push_back(*itr);
+        }
+    }
+}
+
 cSprite* cSprite_Manager::Get_First(const SpriteType type) const
 {
     cSprite* first = NULL;
 
-    for (cSprite_List::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+    if (static_cast<size_t>(type) >= m_type_objects.size()) {
+        return NULL;
+    }
+
+    const cSprite_List& list = m_type_objects[type];
+
+    for (cSprite_List::const_iterator itr = list.begin(); itr != list.end(); ++itr) {
         // get object pointer
         cSprite* obj = (*itr);
 
@@ -277,7 +569,13 @@ cSprite* cSprite_Manager::Get_Last(const SpriteType type) const
 {
     cSprite* last = NULL;
 
-    for (cSprite_List::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+    if (static_cast<size_t>(type) >= m_type_objects.size()) {
+        return NULL;
+    }
+
+    const cSprite_List& list = m_type_objects[type];
+
+    for (cSprite_List::const_iterator itr = list.begin(); itr != list.end(); ++itr) {
         // get object pointer
         cSprite* obj = (*itr);
 
@@ -350,12 +648,52 @@ void cSprite_Manager::Get_Objects_sorted(cSprite_List& new_objects, bool editor_
 void cSprite_Manager::Get_Colliding_Objects(cSprite_List& col_objects, const GL_rect& rect, bool with_player /* = 0 */, const cSprite* exclude_sprite /* = NULL */) const
 {
     // Check objects
-    for (cSprite_List::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+    Get_Touching_Objects(col_objects, rect, exclude_sprite);
+
+    if (with_player && pActive_Player != exclude_sprite) {
+        if (rect.Intersects(pActive_Player->m_col_rect)) {
+            col_objects.push_back(pActive_Player);
+        }
+    }
+}
+
+void cSprite_Manager::Get_Touching_Objects(cSprite_List& col_objects, const GL_rect& rect, const cSprite* exclude_sprite /* = NULL */) const
+{
+    // no index
+    if (!m_spatial_index.m_built) {
+        for (cSprite_List::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+            // get object pointer
+            cSprite* obj = (*itr);
+
+            // if destroyed object
+            if (obj == exclude_sprite || obj->m_auto_destroy) {
+                continue;
+            }
+
+            // if rects don't touch
+            if (!rect.Intersects(obj->m_col_rect)) {
+                continue;
+            }
+
+            col_objects.push_back(obj);
+        }
+
+        return;
+    }
+
+    const size_t first = col_objects.size();
+
+    /* only the sprites near the rect are checked, the query margin
+     * covers collision rects reaching out of the image rect */
+    cSprite_List near_objects;
+    m_spatial_index.Get_Visible(near_objects, rect);
+
+    for (cSprite_List::const_iterator itr = near_objects.begin(); itr != near_objects.end(); ++itr) {
         // get object pointer
         cSprite* obj = (*itr);
 
-        // if destroyed object
-        if (obj == exclude_sprite || obj->m_auto_destroy) {
+        // if destroyed object or checked through the static collision shapes
+        if (obj == exclude_sprite || obj->m_auto_destroy || obj->m_collision_baked) {
             continue;
         }
 
@@ -367,22 +705,28 @@ void cSprite_Manager::Get_Colliding_Objects(cSprite_List& col_objects, const GL_
         col_objects.push_back(obj);
     }
 
-    if (with_player && pActive_Player != exclude_sprite) {
-        if (rect.Intersects(pActive_Player->m_col_rect)) {
-            col_objects.push_back(pActive_Player);
-        }
-    }
+    m_static_collision.Get_Colliding_Objects(col_objects, rect, exclude_sprite);
+
+    // same order as checking all objects
+    Sort_by_Order(col_objects.begin() + first, col_objects.end());
+}
+
+void cSprite_Manager::Sort_by_Order(cSprite_List::iterator first, cSprite_List::iterator last) const
+{
+    std::sort(first, last, order_sort());
 }
 
 void cSprite_Manager::Get_Colliding_Objects(cSprite_List& col_objects, const GL_Circle& circle, bool with_player /* = 0 */, const cSprite* exclude_sprite /* = NULL */) const
 {
+    const size_t first = col_objects.size();
+
     // Check objects
     for (cSprite_List::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
         // get object pointer
         cSprite* obj = (*itr);
 
-        // if destroyed object
-        if (obj == exclude_sprite || obj->m_auto_destroy) {
+        // if destroyed object or checked through the static collision shapes
+        if (obj == exclude_sprite || obj->m_auto_destroy || obj->m_collision_baked) {
             continue;
         }
 
@@ -394,6 +738,12 @@ void cSprite_Manager::Get_Colliding_Objects(cSprite_List& col_objects, const GL_
         col_objects.push_back(obj);
     }
 
+    // merged sprites are sorted in as if all objects were checked
+    if (!m_static_collision.m_shapes.empty()) {
+        m_static_collision.Get_Colliding_Objects(col_objects, circle, exclude_sprite);
+        Sort_by_Order(col_objects.begin() + first, col_objects.end());
+    }
+
     if (with_player && pActive_Player != exclude_sprite) {
         if (circle.Intersects(pActive_Player->m_col_rect)) {
             col_objects.push_back(pActive_Player);
@@ -425,9 +775,14 @@ void cSprite_Manager::Handle_Collision_Items(void)
 
 unsigned int cSprite_Manager::Get_Size_Array(const ArrayType sprite_array)
 {
+    if (static_cast<size_t>(sprite_array) >= m_array_objects.size()) {
+        return 0;
+    }
+
     unsigned int count = 0;
+    const cSprite_List& list = m_array_objects[sprite_array];
 
-    for (cSprite_List::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+    for (cSprite_List::const_iterator itr = list.begin(); itr != list.end(); ++itr) {
         if ((*itr)->m_sprite_array == sprite_array) {
             count++;
         }
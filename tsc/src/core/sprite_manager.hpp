@@ -20,6 +20,9 @@
 #include "../core/global_game.hpp"
 #include "../core/obj_manager.hpp"
 #include "../objects/movingsprite.hpp"
+#include "../core/static_collision.hpp"
+#include "../video/static_render_cache.hpp"
+#include "../core/spatial_index.hpp"
 
 namespace TSC {
 
@@ -50,11 +53,31 @@ namespace TSC {
         */
         void Move_To_Back(cSprite* sprite);
 
+        // Delete the object from given array number
+        virtual bool Delete(size_t array_num, bool delete_data = 1);
+        // Delete the given object
+        virtual bool Delete(cSprite* obj, bool delete_data = 1);
         /* Delete all objects
          * if delayed is set deletion will only occur if replaced
          */
         virtual void Delete_All(bool delayed = 0);
 
+        /* Merge static massive sprites into coarse collision shapes,
+         * compile static sprites into render chunks and index them for culling
+         * script_code : sprites referenced by UID in it are left alone
+         */
+        void Build_Static_Data(const std::string& script_code = "");
+        // Undo Build_Static_Data()
+        void Clear_Static_Data(void);
+
+        /* Add all objects with the given type or sprite array to the list
+         * only looks at the objects registered for it, the registries are unordered
+        */
+        void Get_Objects_by_Type(const SpriteType type, cSprite_List& type_objects) const;
+        void Get_Objects_by_Array(const ArrayType sprite_array, cSprite_List& array_objects) const;
+        // The type or sprite array of the given object changed
+        void Type_Changed(cSprite* sprite);
+
         // Return the first z position object from the given type
         cSprite* Get_First(const SpriteType type) const;
         // Return the last z position object from the given type
@@ -80,14 +103,16 @@ namespace TSC {
         */
         void Get_Colliding_Objects(cSprite_List& col_objects, const GL_rect& rect, bool with_player = 0, const cSprite* exclude_sprite = NULL) const;
         void Get_Colliding_Objects(cSprite_List& col_objects, const GL_Circle& circle, bool with_player = 0, const cSprite* exclude_sprite = NULL) const;
+        /* Add the objects with a collision rect touching the given rect in array order
+         * uses the spatial index and the static collision shapes if they are built
+         * exclude_sprite : exclude the given sprite from check
+        */
+        void Get_Touching_Objects(cSprite_List& col_objects, const GL_rect& rect, const cSprite* exclude_sprite = NULL) const;
+        // Sort the given objects by their array position
+        void Sort_by_Order(cSprite_List::iterator first, cSprite_List::iterator last) const;
 
         // Update items drawing validation
-        inline void Update_Items_Valid_Draw(void)
-        {
-            for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
-                (*itr)->Update_Valid_Draw();
-            }
-        }
+        void Update_Items_Valid_Draw(void);
         // Update items
         inline void Update_Items(void)
         {
@@ -103,12 +128,24 @@ namespace TSC {
             }
         }
         // Draw items
-        inline void Draw_Items(void)
-        {
-            for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
-                (*itr)->Draw();
-            }
-        }
+        void Draw_Items(void);
+
+        /* Remember the current positions before a simulation step
+         * only the sprites which can move if the spatial index is built
+         * with_player : include the player
+        */
+        void Save_Positions(bool with_player = 0);
+        /* Move the items between their position before and after the last
+         * simulation step for drawing. Must be followed by Restore_Positions().
+         * alpha : 0.0 is the previous and 1.0 the current position
+         * with_player : include the player
+        */
+        void Interpolate_Positions(float alpha, bool with_player = 0);
+        // Move the interpolated items back to their simulated position
+        void Restore_Positions(void);
+
+        // items moving further in one step are not interpolated because they jumped
+        static const float m_max_interpolation_distance;
 
         // Create Collision data and Handle the collisions
         void Handle_Collision_Items(void);
@@ -136,6 +173,18 @@ namespace TSC {
         // if `new_max_uid_mark' is smaller than the current max mark.
         void Allocate_UIDs(long new_max_uid_mark);
 
+        // merged collision shapes of static sprites
+        cStatic_Collision_Map m_static_collision;
+        // compiled render chunks of static sprites
+        cStatic_Render_Cache m_static_render_cache;
+        // grid of static sprites for drawing
+        cSpatial_Index m_spatial_index;
+
+        // sprites drawn in the last Draw_Items()
+        unsigned int m_drawn_count;
+        // sprites skipped by the spatial index in the last Draw_Items()
+        unsigned int m_culled_count;
+
         typedef vector<float> ZposList;
         // biggest type z position
         ZposList m_z_pos_data;
@@ -147,6 +196,9 @@ namespace TSC {
         // The UID pool is filled as needed. This is always the first
         // non-yet allocated UID.
         int m_max_uid_mark;
+        // smallest and biggest sprite m_manager_order in use
+        int m_first_order;
+        int m_last_order;
 
         // Z position sort
         struct zpos_sort {
@@ -156,6 +208,14 @@ namespace TSC {
             }
         };
 
+        // array position sort
+        struct order_sort {
+            bool operator()(const cSprite* a, const cSprite* b) const
+            {
+                return a->m_manager_order < b->m_manager_order;
+            }
+        };
+
         // Editor Z position sort
         struct editor_zpos_sort {
             bool operator()(const cSprite* a, const cSprite* b) const
@@ -182,6 +242,19 @@ namespace TSC {
         };
 
     private:
+        struct Interpolated_Sprite {
+            cSprite* m_sprite;
+            // simulated position
+            float m_pos_x;
+            float m_pos_y;
+        };
+
+        // Interpolate the given sprite if it moved
+        void Interpolate_Position(cSprite* sprite, float alpha);
+
+        // items moved by Interpolate_Positions()
+        vector<Interpolated_Sprite> m_interpolated;
+
         /* When multiple sprites of the same massivity are placed
          * on the same place (think two hills before one another,
          * where one may be higher than the other), they would
@@ -193,6 +266,22 @@ namespace TSC {
          * are ensured to be placed in front of older ones.
          */
         void Ensure_Different_Z(cSprite* sprite);
+
+        // Add the object to the type and sprite array registries
+        void Register_Type(cSprite* sprite);
+        /* Remove the object from the type and sprite array registries
+         * uses the registry slots stored in the sprite
+        */
+        void Unregister_Type(cSprite* sprite);
+
+        // sprites returned by the spatial index, kept to reuse the memory
+        cSprite_List m_visible_objects;
+
+        typedef vector<cSprite_List> Type_Registry;
+        // objects by type
+        Type_Registry m_type_objects;
+        // objects by sprite array
+        Type_Registry m_array_objects;
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
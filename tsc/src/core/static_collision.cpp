@@ -0,0 +1,328 @@
+/***************************************************************************
+ * static_collision.cpp - merged collision shapes for static level geometry
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../core/static_collision.hpp"
+#include "../core/game_core.hpp"
+#include "../video/renderer.hpp"
+#include "../core/global_basic.hpp"
+
+using namespace std;
+
+namespace TSC {
+
+/* Tiles are placed on whole pixels, this only absorbs
+ * floating point noise from the position calculations. */
+static const float static_collision_tolerance = 0.01f;
+
+void Get_Script_UIDs(const std::string& script_code, std::set<int>& uids)
+{
+    std::string::size_type pos = script_code.find("UIDS[");
+
+    while (pos != std::string::npos) {
+        pos += 5;
+
+        // skip whitespace
+        while (pos < script_code.size() && isspace(static_cast<unsigned char>(script_code[pos]))) {
+            pos++;
+        }
+
+        if (pos < script_code.size() && isdigit(static_cast<unsigned char>(script_code[pos]))) {
+            uids.insert(atoi(script_code.c_str() + pos));
+        }
+
+        pos = script_code.find("UIDS[", pos);
+    }
+}
+
+// sort by massivity and row, then from left to right
+struct static_row_sort {
+    bool operator()(const cStatic_Collision_Shape& a, const cStatic_Collision_Shape& b) const
+    {
+        if (a.m_massive_type != b.m_massive_type) {
+            return a.m_massive_type < b.m_massive_type;
+        }
+        if (!Is_Float_Equal(a.m_rect.m_y, b.m_rect.m_y, static_collision_tolerance)) {
+            return a.m_rect.m_y < b.m_rect.m_y;
+        }
+        if (!Is_Float_Equal(a.m_rect.m_h, b.m_rect.m_h, static_collision_tolerance)) {
+            return a.m_rect.m_h < b.m_rect.m_h;
+        }
+
+        return a.m_rect.m_x < b.m_rect.m_x;
+    }
+};
+
+// sort by massivity and column, then from top to bottom
+struct static_column_sort {
+    bool operator()(const cStatic_Collision_Shape& a, const cStatic_Collision_Shape& b) const
+    {
+        if (a.m_massive_type != b.m_massive_type) {
+            return a.m_massive_type < b.m_massive_type;
+        }
+        if (!Is_Float_Equal(a.m_rect.m_x, b.m_rect.m_x, static_collision_tolerance)) {
+            return a.m_rect.m_x < b.m_rect.m_x;
+        }
+        if (!Is_Float_Equal(a.m_rect.m_w, b.m_rect.m_w, static_collision_tolerance)) {
+            return a.m_rect.m_w < b.m_rect.m_w;
+        }
+
+        return a.m_rect.m_y < b.m_rect.m_y;
+    }
+};
+
+/* *** *** *** *** *** *** *** cStatic_Collision_Map *** *** *** *** *** *** *** *** *** *** */
+
+cStatic_Collision_Map::cStatic_Collision_Map(void)
+{
+    m_member_count = 0;
+}
+
+cStatic_Collision_Map::~cStatic_Collision_Map(void)
+{
+    //
+}
+
+bool cStatic_Collision_Map::Is_Static(const cSprite* sprite)
+{
+    // only basic sprites never move by themselves
+    if (sprite->m_type != TYPE_UNDEFINED) {
+        return 0;
+    }
+
+    // only blocking terrain
+    if (sprite->m_massive_type != MASS_MASSIVE && sprite->m_massive_type != MASS_HALFMASSIVE) {
+        return 0;
+    }
+
+    if (!sprite->m_active || sprite->m_auto_destroy || sprite->m_spawned || !sprite->m_image) {
+        return 0;
+    }
+
+    // no collision rect
+    if (sprite->m_col_rect.m_w <= 0.0f || sprite->m_col_rect.m_h <= 0.0f) {
+        return 0;
+    }
+
+    // scripted
+    if (sprite->has_event_handlers()) {
+        return 0;
+    }
+
+    return 1;
+}
+
+void cStatic_Collision_Map::Build(const cSprite_List& objects, const std::string& script_code /* = "" */)
+{
+    Clear();
+
+    std::set<int> script_uids;
+    Get_Script_UIDs(script_code, script_uids);
+
+    // every suitable sprite starts as its own shape
+    cStatic_Collision_Shape_List tiles;
+
+    for (cSprite_List::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+        cSprite* obj = (*itr);
+
+        if (!Is_Static(obj) || script_uids.count(obj->m_uid)) {
+            continue;
+        }
+
+        cStatic_Collision_Shape shape;
+        shape.m_rect = obj->m_col_rect;
+        shape.m_massive_type = obj->m_massive_type;
+        shape.m_members.push_back(obj);
+        tiles.push_back(shape);
+    }
+
+    Merge_Tiles(tiles, m_shapes);
+
+    // mark the members
+    for (cStatic_Collision_Shape_List::iterator itr = m_shapes.begin(); itr != m_shapes.end(); ++itr) {
+        for (cSprite_List::iterator member_itr = itr->m_members.begin(); member_itr != itr->m_members.end(); ++member_itr) {
+            (*member_itr)->m_collision_baked = 1;
+        }
+
+        m_member_count += itr->m_members.size();
+    }
+
+    debug_print("Merged %u static sprites into %u collision shapes\n", m_member_count, static_cast<unsigned int>(m_shapes.size()));
+}
+
+void cStatic_Collision_Map::Merge_Tiles(cStatic_Collision_Shape_List& tiles, cStatic_Collision_Shape_List& shapes)
+{
+    if (tiles.empty()) {
+        return;
+    }
+
+    // merge horizontal runs of tiles with the same row and height
+    std::sort(tiles.begin(), tiles.end(), static_row_sort());
+
+    cStatic_Collision_Shape_List rows;
+    rows.push_back(tiles.front());
+
+    for (cStatic_Collision_Shape_List::iterator itr = tiles.begin() + 1; itr != tiles.end(); ++itr) {
+        cStatic_Collision_Shape& last = rows.back();
+
+        if (itr->m_massive_type == last.m_massive_type &&
+                Is_Float_Equal(itr->m_rect.m_y, last.m_rect.m_y, static_collision_tolerance) &&
+                Is_Float_Equal(itr->m_rect.m_h, last.m_rect.m_h, static_collision_tolerance) &&
+                itr->m_rect.m_x <= last.m_rect.m_x + last.m_rect.m_w + static_collision_tolerance) {
+            float right = std::max(last.m_rect.m_x + last.m_rect.m_w, itr->m_rect.m_x + itr->m_rect.m_w);
+            last.m_rect.m_w = right - last.m_rect.m_x;
+            last.m_members.insert(last.m_members.end(), itr->m_members.begin(), itr->m_members.end());
+        }
+        else {
+            rows.push_back(*itr);
+        }
+    }
+
+    // merge vertical stacks of runs with the same column and width
+    std::sort(rows.begin(), rows.end(), static_column_sort());
+
+    shapes.push_back(rows.front());
+
+    for (cStatic_Collision_Shape_List::iterator itr = rows.begin() + 1; itr != rows.end(); ++itr) {
+        cStatic_Collision_Shape& last = shapes.back();
+
+        if (itr->m_massive_type == last.m_massive_type &&
+                Is_Float_Equal(itr->m_rect.m_x, last.m_rect.m_x, static_collision_tolerance) &&
+                Is_Float_Equal(itr->m_rect.m_w, last.m_rect.m_w, static_collision_tolerance) &&
+                itr->m_rect.m_y <= last.m_rect.m_y + last.m_rect.m_h + static_collision_tolerance) {
+            float bottom = std::max(last.m_rect.m_y + last.m_rect.m_h, itr->m_rect.m_y + itr->m_rect.m_h);
+            last.m_rect.m_h = bottom - last.m_rect.m_y;
+            last.m_members.insert(last.m_members.end(), itr->m_members.begin(), itr->m_members.end());
+        }
+        else {
+            shapes.push_back(*itr);
+        }
+    }
+}
+
+void cStatic_Collision_Map::Clear(void)
+{
+    for (cStatic_Collision_Shape_List::iterator itr = m_shapes.begin(); itr != m_shapes.end(); ++itr) {
+        for (cSprite_List::iterator member_itr = itr->m_members.begin(); member_itr != itr->m_members.end(); ++member_itr) {
+            (*member_itr)->m_collision_baked = 0;
+        }
+    }
+
+    m_shapes.clear();
+    m_member_count = 0;
+}
+
+void cStatic_Collision_Map::Remove(cSprite* sprite)
+{
+    if (!sprite->m_collision_baked) {
+        return;
+    }
+
+    for (cStatic_Collision_Shape_List::iterator itr = m_shapes.begin(); itr != m_shapes.end(); ++itr) {
+        cSprite_List::iterator member_itr = std::find(itr->m_members.begin(), itr->m_members.end(), sprite);
+
+        if (member_itr == itr->m_members.end()) {
+            continue;
+        }
+
+        itr->m_members.erase(member_itr);
+        m_member_count--;
+
+        // split the remaining members again as the sprite may have left a gap
+        cStatic_Collision_Shape_List tiles;
+
+        for (member_itr = itr->m_members.begin(); member_itr != itr->m_members.end(); ++member_itr) {
+            cStatic_Collision_Shape tile;
+            tile.m_rect = (*member_itr)->m_col_rect;
+            tile.m_massive_type = itr->m_massive_type;
+            tile.m_members.push_back(*member_itr);
+            tiles.push_back(tile);
+        }
+
+        m_shapes.erase(itr);
+        Merge_Tiles(tiles, m_shapes);
+
+        break;
+    }
+
+    sprite->m_collision_baked = 0;
+}
+
+void cStatic_Collision_Map::Get_Colliding_Objects(cSprite_List& col_objects, const GL_rect& rect, const cSprite* exclude_sprite /* = NULL */) const
+{
+    for (cStatic_Collision_Shape_List::const_iterator itr = m_shapes.begin(); itr != m_shapes.end(); ++itr) {
+        // if rects don't touch
+        if (!rect.Intersects(itr->m_rect)) {
+            continue;
+        }
+
+        for (cSprite_List::const_iterator member_itr = itr->m_members.begin(); member_itr != itr->m_members.end(); ++member_itr) {
+            cSprite* obj = (*member_itr);
+
+            if (obj == exclude_sprite || obj->m_auto_destroy) {
+                continue;
+            }
+
+            if (!rect.Intersects(obj->m_col_rect)) {
+                continue;
+            }
+
+            col_objects.push_back(obj);
+        }
+    }
+}
+
+void cStatic_Collision_Map::Get_Colliding_Objects(cSprite_List& col_objects, const GL_Circle& circle, const cSprite* exclude_sprite /* = NULL */) const
+{
+    for (cStatic_Collision_Shape_List::const_iterator itr = m_shapes.begin(); itr != m_shapes.end(); ++itr) {
+        // if circle doesn't touch
+        if (!circle.Intersects(itr->m_rect)) {
+            continue;
+        }
+
+        for (cSprite_List::const_iterator member_itr = itr->m_members.begin(); member_itr != itr->m_members.end(); ++member_itr) {
+            cSprite* obj = (*member_itr);
+
+            if (obj == exclude_sprite || obj->m_auto_destroy) {
+                continue;
+            }
+
+            if (!circle.Intersects(obj->m_col_rect)) {
+                continue;
+            }
+
+            col_objects.push_back(obj);
+        }
+    }
+}
+
+void cStatic_Collision_Map::Draw_Debug(void) const
+{
+    for (cStatic_Collision_Shape_List::const_iterator itr = m_shapes.begin(); itr != m_shapes.end(); ++itr) {
+        // single tiles are already shown by the sprite debug rects
+        if (itr->m_members.size() <= 1) {
+            continue;
+        }
+
+        cRect_Request* rect_request = new cRect_Request();
+        pVideo->Draw_Rect(&itr->m_rect, 0.12f, itr->m_massive_type == MASS_MASSIVE ? &lightred : &lightblue, rect_request);
+        rect_request->m_filled = 0;
+        rect_request->m_line_width = 2.0f;
+        pRenderer->Add(rect_request);
+    }
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
@@ -0,0 +1,99 @@
+/***************************************************************************
+ * static_collision.hpp - merged collision shapes for static level geometry
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_STATIC_COLLISION_HPP
+#define TSC_STATIC_COLLISION_HPP
+
+#include "../core/global_game.hpp"
+#include "../core/math/rect.hpp"
+#include "../core/math/circle.hpp"
+#include "../objects/sprite.hpp"
+
+namespace TSC {
+
+    /* Collect the UIDs the level script refers to as UIDS[<number>].
+     * These sprites may be moved or hooked by the script and must not
+     * be treated as static.
+    */
+    void Get_Script_UIDs(const std::string& script_code, std::set<int>& uids);
+
+    /* *** *** *** *** *** *** *** cStatic_Collision_Shape *** *** *** *** *** *** *** *** *** *** */
+
+    /* A rectangle covering a contiguous group of static sprites
+     * of the same massivity.
+    */
+    struct cStatic_Collision_Shape {
+        // bounding collision rect of all members
+        GL_rect m_rect;
+        // massivity of all members
+        MassiveType m_massive_type;
+        // the merged sprites
+        cSprite_List m_members;
+    };
+
+    typedef vector<cStatic_Collision_Shape> cStatic_Collision_Shape_List;
+
+    /* *** *** *** *** *** *** *** cStatic_Collision_Map *** *** *** *** *** *** *** *** *** *** */
+
+    /* Levels are mostly built from 32 or 64 pixel tiles placed
+     * side by side. This merges runs of such tiles that never move
+     * into larger collision rectangles, which are tested first so
+     * that collision checks only have to look at the single tiles
+     * of a shape that is actually touched.
+     *
+     * The merged sprites stay in the sprite manager and are still
+     * drawn and reported as collision objects one by one, only the
+     * broad search over all objects is replaced. Merged sprites
+     * have cSprite::m_collision_baked set.
+    */
+    class cStatic_Collision_Map {
+    public:
+        cStatic_Collision_Map(void);
+        ~cStatic_Collision_Map(void);
+
+        /* Merge the suitable sprites of the given list
+         * script_code : level script, sprites referenced by UID in it are excluded
+        */
+        void Build(const cSprite_List& objects, const std::string& script_code = "");
+        // Unmerge all sprites
+        void Clear(void);
+        // Remove the given sprite from its shape
+        void Remove(cSprite* sprite);
+
+        // Add the merged sprites colliding with the given rect/circle
+        void Get_Colliding_Objects(cSprite_List& col_objects, const GL_rect& rect, const cSprite* exclude_sprite = NULL) const;
+        void Get_Colliding_Objects(cSprite_List& col_objects, const GL_Circle& circle, const cSprite* exclude_sprite = NULL) const;
+
+        // Draw the merged shapes for debugging
+        void Draw_Debug(void) const;
+
+        // Returns true if the given sprite can be merged
+        static bool Is_Static(const cSprite* sprite);
+        /* Merge the given single sprite shapes and add the results to shapes
+         * tiles : is sorted
+        */
+        static void Merge_Tiles(cStatic_Collision_Shape_List& tiles, cStatic_Collision_Shape_List& shapes);
+
+        // merged shapes
+        cStatic_Collision_Shape_List m_shapes;
+        // amount of merged sprites
+        unsigned int m_member_count;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
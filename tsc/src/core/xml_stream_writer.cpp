@@ -0,0 +1,229 @@
+/***************************************************************************
+ * xml_stream_writer.cpp - write XML files without building a document
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../core/xml_stream_writer.hpp"
+
+using namespace std;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** *** cXml_Stream_Writer *** *** *** *** *** *** *** *** *** *** */
+
+cXml_Stream_Writer::cXml_Stream_Writer(std::ostream& stream)
+    : m_stream(stream)
+{
+    m_start_tag_open = 0;
+
+    m_stream << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+}
+
+cXml_Stream_Writer::~cXml_Stream_Writer(void)
+{
+    while (!m_elements.empty()) {
+        End_Element();
+    }
+}
+
+void cXml_Stream_Writer::Start_Element(const std::string& name)
+{
+    if (!m_elements.empty()) {
+        Close_Start_Tag();
+
+        Open_Element& parent = m_elements.back();
+        parent.m_has_children = 1;
+
+        if (!parent.m_has_text) {
+            Indent(m_elements.size());
+        }
+    }
+
+    m_stream << '<' << name;
+    m_start_tag_open = 1;
+
+    Open_Element element;
+    element.m_name = name;
+    element.m_has_children = 0;
+    element.m_has_text = 0;
+    m_elements.push_back(element);
+}
+
+void cXml_Stream_Writer::End_Element(void)
+{
+    if (m_elements.empty()) {
+        return;
+    }
+
+    const Open_Element& element = m_elements.back();
+
+    // empty
+    if (m_start_tag_open) {
+        m_stream << "/>";
+        m_start_tag_open = 0;
+    }
+    else {
+        if (element.m_has_children && !element.m_has_text) {
+            Indent(m_elements.size() - 1);
+        }
+
+        m_stream << "</" << element.m_name << '>';
+    }
+
+    m_elements.pop_back();
+
+    // root node finished
+    if (m_elements.empty()) {
+        m_stream << '\n';
+    }
+}
+
+void cXml_Stream_Writer::Add_Property(const std::string& name, const std::string& value)
+{
+    Start_Element("property");
+    Add_Attribute("name", name);
+    Add_Attribute("value", value);
+    End_Element();
+}
+
+void cXml_Stream_Writer::Add_Text(const std::string& text)
+{
+    if (m_elements.empty() || text.empty()) {
+        return;
+    }
+
+    Close_Start_Tag();
+    m_elements.back().m_has_text = 1;
+
+    m_stream << Escape(text, 0);
+}
+
+void cXml_Stream_Writer::Add_Node(xmlpp::Element* p_element)
+{
+    Start_Element(p_element->get_name());
+
+    const xmlpp::Element::AttributeList attributes = p_element->get_attributes();
+
+    for (xmlpp::Element::AttributeList::const_iterator itr = attributes.begin(); itr != attributes.end(); ++itr) {
+        Add_Attribute((*itr)->get_name(), (*itr)->get_value());
+    }
+
+    const xmlpp::Node::NodeList children = p_element->get_children();
+
+    for (xmlpp::Node::NodeList::const_iterator itr = children.begin(); itr != children.end(); ++itr) {
+        xmlpp::Element* p_child = dynamic_cast<xmlpp::Element*>(*itr);
+
+        if (p_child) {
+            Add_Node(p_child);
+            continue;
+        }
+
+        xmlpp::TextNode* p_text = dynamic_cast<xmlpp::TextNode*>(*itr);
+
+        if (p_text) {
+            Add_Text(p_text->get_content());
+        }
+    }
+
+    End_Element();
+}
+
+void cXml_Stream_Writer::Add_Child_Nodes(xmlpp::Element* p_parent)
+{
+    xmlpp::Node::NodeList children = p_parent->get_children();
+
+    for (xmlpp::Node::NodeList::iterator itr = children.begin(); itr != children.end(); ++itr) {
+        xmlpp::Element* p_element = dynamic_cast<xmlpp::Element*>(*itr);
+
+        if (p_element) {
+            Add_Node(p_element);
+        }
+
+#ifdef USE_LIBXMLPP3
+        xmlpp::Node::remove_node(*itr);
+#else
+        p_parent->remove_child(*itr);
+#endif
+    }
+}
+
+std::string cXml_Stream_Writer::Escape(const std::string& str, bool attribute)
+{
+    std::string result;
+    result.reserve(str.size());
+
+    for (std::string::const_iterator itr = str.begin(); itr != str.end(); ++itr) {
+        switch (*itr) {
+        case '&':
+            result += "&amp;";
+            break;
+        case '<':
+            result += "&lt;";
+            break;
+        case '>':
+            result += "&gt;";
+            break;
+        case '\r':
+            result += "&#13;";
+            break;
+        /* quotes end attribute values and whitespace in them
+         * is normalized by the parser */
+        case '"':
+            result += attribute ? "&quot;" : "\"";
+            break;
+        case '\n':
+            result += attribute ? "&#10;" : "\n";
+            break;
+        case '\t':
+            result += attribute ? "&#9;" : "\t";
+            break;
+        default:
+            result += *itr;
+            break;
+        }
+    }
+
+    return result;
+}
+
+void cXml_Stream_Writer::Add_Attribute(const std::string& name, const std::string& value)
+{
+    if (!m_start_tag_open) {
+        return;
+    }
+
+    m_stream << ' ' << name << "=\"" << Escape(value, 1) << '"';
+}
+
+void cXml_Stream_Writer::Close_Start_Tag(void)
+{
+    if (!m_start_tag_open) {
+        return;
+    }
+
+    m_stream << '>';
+    m_start_tag_open = 0;
+}
+
+void cXml_Stream_Writer::Indent(size_t depth)
+{
+    m_stream << '\n';
+
+    for (size_t i = 0; i < depth; i++) {
+        m_stream << "  ";
+    }
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
@@ -0,0 +1,117 @@
+/***************************************************************************
+ * xml_stream_writer.hpp - write XML files without building a document
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_XML_STREAM_WRITER_HPP
+#define TSC_XML_STREAM_WRITER_HPP
+
+#include "../core/global_basic.hpp"
+#include "../core/property_helper.hpp"
+
+namespace TSC {
+
+    /* *** *** *** *** *** *** *** cXml_Stream_Writer *** *** *** *** *** *** *** *** *** *** */
+
+    /* Writes XML directly to a stream in the same layout as
+     * xmlpp::Document::write_to_file_formatted(). Elements are
+     * opened and closed in order and only the names of the
+     * currently open elements are kept in memory.
+     *
+     * Objects which only know how to save themselves to a libxml++
+     * element can still be written with Add_Node(). The caller
+     * only has to keep a small temporary document for them.
+    */
+    class cXml_Stream_Writer {
+    public:
+        // Writes the XML declaration to the given stream
+        cXml_Stream_Writer(std::ostream& stream);
+        // Closes all open elements
+        ~cXml_Stream_Writer(void);
+
+        // Open a new child element of the current element
+        void Start_Element(const std::string& name);
+        // Close the current element
+        void End_Element(void);
+
+        // Add a <property name="" value=""/> element like Add_Property()
+        void Add_Property(const std::string& name, const std::string& value);
+        inline void Add_Property(const std::string& name, const char* value)
+        {
+            Add_Property(name, std::string(value));
+        }
+        inline void Add_Property(const std::string& name, int value)
+        {
+            Add_Property(name, int_to_string(value));
+        }
+        inline void Add_Property(const std::string& name, uint64_t value)
+        {
+            Add_Property(name, int64_to_string(value));
+        }
+        inline void Add_Property(const std::string& name, long value)
+        {
+            Add_Property(name, long_to_string(value));
+        }
+        inline void Add_Property(const std::string& name, float value)
+        {
+            Add_Property(name, float_to_string(value));
+        }
+        inline void Add_Property(const std::string& name, bool value)
+        {
+            Add_Property(name, bool_to_string(value));
+        }
+        inline void Add_Property(const std::string& name, unsigned int value)
+        {
+            Add_Property(name, uint_to_string(value));
+        }
+        // Add an attribute to the start tag of the current element
+        void Add_Attribute(const std::string& name, const std::string& value);
+
+        // Add text content to the current element
+        void Add_Text(const std::string& text);
+        // Write the given element with all its attributes and children
+        void Add_Node(xmlpp::Element* p_element);
+        /* Write all child elements of the given temporary element
+         * and remove them from it again
+        */
+        void Add_Child_Nodes(xmlpp::Element* p_parent);
+
+        // Returns the given string escaped for attribute values or text
+        static std::string Escape(const std::string& str, bool attribute);
+    private:
+        struct Open_Element {
+            std::string m_name;
+            // contains child elements
+            bool m_has_children;
+            // contains text, its children are not indented
+            bool m_has_text;
+        };
+
+        // Finish the start tag of the current element if still open
+        void Close_Start_Tag(void);
+        // Write a line break and the indentation of the given depth
+        void Indent(size_t depth);
+
+        std::ostream& m_stream;
+
+        // the open elements
+        vector<Open_Element> m_elements;
+        // the start tag of the current element is not yet closed
+        bool m_start_tag_open;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
@@ -82,7 +82,7 @@ namespace TSC {
 
         Set_Direction(DIR_RIGHT, 1);
 
-        m_kill_sound = "stomp_4.ogg";
+        Set_Kill_Sound("stomp_4.ogg");
     }
 
     cArmy* cArmy::Copy(void) const
@@ -435,7 +435,7 @@ namespace TSC {
 
         delete col_list;
 
-        pAudio->Play_Sound("enemy/army/stand_up.wav");
+        pAudio->Play_Sound(SOUND_ENEMY_ARMY_STAND_UP);
         Col_Move(0.0f, move_y, 1, 1);
         Set_Army_Moving_State(ARMY_WALK);
     }
@@ -472,7 +472,7 @@ namespace TSC {
         }
 
         // hit enemy
-        pAudio->Play_Sound(enemy->m_kill_sound);
+        pAudio->Play_Sound(enemy->Get_Kill_Sound_Handle());
         gp_hud->Add_Points(enemy->m_kill_points, m_pos_x + m_image->m_w / 3, m_pos_y - 5.0f, "", static_cast<uint8_t>(255), 1);
         enemy->DownGrade(1);
         pLevel_Player->Add_Kill_Multiplier();
@@ -649,15 +649,15 @@ namespace TSC {
         if (collision->m_direction == DIR_TOP && pLevel_Player->m_state != STA_FLY) {
             if (m_army_state == ARMY_WALK) {
                 gp_hud->Add_Points(25, m_pos_x, m_pos_y - 5.0f);
-                pAudio->Play_Sound("enemy/army/hit.ogg");
+                pAudio->Play_Sound(SOUND_ENEMY_ARMY_HIT);
             }
             else if (m_army_state == ARMY_SHELL_STAND) {
                 gp_hud->Add_Points(10, m_pos_x, m_pos_y - 5.0f);
-                pAudio->Play_Sound("enemy/army/shell/hit.ogg");
+                pAudio->Play_Sound(SOUND_ENEMY_ARMY_SHELL_HIT);
             }
             else if (m_army_state == ARMY_SHELL_RUN) {
                 gp_hud->Add_Points(5, m_pos_x, m_pos_y - 5.0f);
-                pAudio->Play_Sound("enemy/army/shell/hit.ogg");
+                pAudio->Play_Sound(SOUND_ENEMY_ARMY_SHELL_HIT);
             }
 
             // animation
@@ -695,7 +695,7 @@ namespace TSC {
                 }
             }
             else if (m_army_state == ARMY_SHELL_STAND) {
-                pAudio->Play_Sound("enemy/army/shell/hit.ogg");
+                pAudio->Play_Sound(SOUND_ENEMY_ARMY_SHELL_HIT);
                 DownGrade();
 
                 cParticle_Emitter* anim = new cParticle_Emitter(m_sprite_manager);
@@ -909,7 +909,7 @@ void cArmy::Handle_Collision_Massive(cObjectCollision* collision)
 
 void cArmy::Handle_Collision_Box(ObjectDirection cdirection, GL_rect* r2)
 {
-    pAudio->Play_Sound(m_kill_sound);
+    pAudio->Play_Sound(Get_Kill_Sound_Handle());
     gp_hud->Add_Points(m_kill_points, m_pos_x, m_pos_y - 5.0f, "", static_cast<uint8_t>(255), 1);
     pLevel_Player->Add_Kill_Multiplier();
     DownGrade(true);
@@ -77,7 +77,7 @@ void cBeetle::Init()
     Set_Direction(DIR_LEFT);
 
     // TODO: Own die sound
-    m_kill_sound = "enemy/gee/die.ogg";
+    Set_Kill_Sound("enemy/gee/die.ogg");
     m_kill_points = 100;
 }
 
@@ -198,7 +198,7 @@ void cBeetle::Handle_Collision_Player(cObjectCollision* p_collision)
 
     // We will die only when hit from the top
     if (p_collision->m_direction == DIR_TOP && pLevel_Player->m_state != STA_FLY) {
-        pAudio->Play_Sound(m_kill_sound);
+        pAudio->Play_Sound(Get_Kill_Sound_Handle());
         DownGrade();
         pLevel_Player->Action_Jump(true);
         gp_hud->Add_Points(m_kill_points, m_pos_x, m_pos_y - 5.0f, "", static_cast<uint8_t>(255), 1);
@@ -79,7 +79,7 @@ void cBeetleBarrage::Init()
     Set_Direction(DIR_UP);
 
     // TODO: Own die sound
-    m_kill_sound = "enemy/eato/die.ogg";
+    Set_Kill_Sound("enemy/eato/die.ogg");
     m_kill_points = 100;
 }
 
@@ -88,7 +88,7 @@ void cTurtleBoss::Init(void)
     m_player_counter = 0.0f;
     m_fire_resistant = 1;
     m_ice_resistance = 1.0f;
-    m_kill_sound = "stomp_4.ogg";
+    Set_Kill_Sound("stomp_4.ogg");
 
     m_hits = 0;
     m_downgrade_count = 0;
@@ -316,7 +316,7 @@ void cTurtleBoss::Update_Normal_Dying()
         // finished scale out animation
         if (m_scale_x <= 0.1f) {
             // sound
-            pAudio->Play_Sound("enemy/turtle/shell/hit.ogg");
+            pAudio->Play_Sound(SOUND_ENEMY_TURTLE_SHELL_HIT);
 
             // star explosion animation
             Generate_Stars(30);
@@ -526,7 +526,7 @@ void cTurtleBoss::Update(void)
         if (m_counter > 60.0f) {
             m_counter = 0.0f;
             // shell attack sound
-            pAudio->Play_Sound("enemy/boss/turtle/shell_attack.ogg");
+            pAudio->Play_Sound(SOUND_ENEMY_BOSS_TURTLE_SHELL_ATTACK, -1, -1, false, SOUND_PRIORITY_HIGH);
 
             Set_Turtle_Moving_State(TURTLEBOSS_SHELL_RUN);
             if(m_walk_start >= 0 && m_shell_stand_start >= 0)
@@ -564,7 +564,7 @@ void cTurtleBoss::Stand_Up(void)
 
     delete col_list;
 
-    pAudio->Play_Sound("enemy/boss/turtle/power_up.ogg");
+    pAudio->Play_Sound(SOUND_ENEMY_BOSS_TURTLE_POWER_UP, -1, -1, false, SOUND_PRIORITY_HIGH);
     Col_Move(0.0f, move_y, 1, 1);
     Set_Turtle_Moving_State(TURTLEBOSS_WALK);
 }
@@ -582,7 +582,7 @@ bool cTurtleBoss::Hit_Enemy(cEnemy* enemy) const
     }
 
     // hit enemy
-    pAudio->Play_Sound(enemy->m_kill_sound);
+    pAudio->Play_Sound(enemy->Get_Kill_Sound_Handle());
     gp_hud->Add_Points(enemy->m_kill_points, m_pos_x + m_image->m_w / 3, m_pos_y - 5.0f, "", static_cast<uint8_t>(255), 1);
     enemy->DownGrade(1);
     pLevel_Player->Add_Kill_Multiplier();
@@ -772,19 +772,19 @@ void cTurtleBoss::Handle_Collision_Player(cObjectCollision* collision)
             gp_hud->Add_Points(250, pLevel_Player->m_pos_x, pLevel_Player->m_pos_y);
 
             if (m_hits + 1 == m_max_hits) {
-                pAudio->Play_Sound("enemy/boss/turtle/big_hit.ogg");
+                pAudio->Play_Sound(SOUND_ENEMY_BOSS_TURTLE_BIG_HIT, -1, -1, false, SOUND_PRIORITY_HIGH);
             }
             else {
-                pAudio->Play_Sound("enemy/boss/turtle/hit.ogg");
+                pAudio->Play_Sound(SOUND_ENEMY_BOSS_TURTLE_HIT, -1, -1, false, SOUND_PRIORITY_HIGH);
             }
         }
         else if (m_turtle_state == TURTLEBOSS_SHELL_STAND) {
             gp_hud->Add_Points(100, pLevel_Player->m_pos_x, pLevel_Player->m_pos_y);
-            pAudio->Play_Sound("enemy/turtle/shell/hit.ogg");
+            pAudio->Play_Sound(SOUND_ENEMY_TURTLE_SHELL_HIT);
         }
         else if (m_turtle_state == TURTLEBOSS_SHELL_RUN) {
             gp_hud->Add_Points(50, pLevel_Player->m_pos_x, pLevel_Player->m_pos_y);
-            pAudio->Play_Sound("enemy/turtle/shell/hit.ogg");
+            pAudio->Play_Sound(SOUND_ENEMY_TURTLE_SHELL_HIT);
         }
 
         // animation
@@ -821,7 +821,7 @@ void cTurtleBoss::Handle_Collision_Player(cObjectCollision* collision)
             Turn_Around(collision->m_direction);
         }
         else if (m_turtle_state == TURTLEBOSS_SHELL_STAND) {
-            pAudio->Play_Sound("enemy/turtle/shell/hit.ogg");
+            pAudio->Play_Sound(SOUND_ENEMY_TURTLE_SHELL_HIT);
             DownGrade();
 
             cParticle_Emitter* anim = new cParticle_Emitter(m_sprite_manager);
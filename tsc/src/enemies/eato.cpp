@@ -78,7 +78,7 @@ void cEato::Init(void)
     Set_Image_Dir(utf8_to_path("enemy/eato/brown/"));
     Set_Direction(DIR_UP_LEFT);
 
-    m_kill_sound = "enemy/eato/die.ogg";
+    Set_Kill_Sound("enemy/eato/die.ogg");
     m_kill_points = 150;
 }
 
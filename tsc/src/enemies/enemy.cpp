@@ -47,7 +47,8 @@ cEnemy::cEnemy(cSprite_Manager* sprite_manager)
     m_dying_counter = 0.0f;
     m_color = COL_DEFAULT;
 
-    m_kill_sound = "enemy/furball/die.ogg";
+    m_kill_sound_handle = 0;
+    Set_Kill_Sound("enemy/furball/die.ogg");
     m_kill_points = 10;
 
     m_velx_max = 0.0f;
@@ -298,7 +299,7 @@ void cEnemy::Handle_Ball_Hit(const cBall& ball, const cObjectCollision* p_collis
     Ball_Destroy_Animation(ball);
 
     // play enemy kill sound
-    pAudio->Play_Sound(m_kill_sound);
+    pAudio->Play_Sound(Get_Kill_Sound_Handle());
 
     if (ball.m_ball_type == FIREBALL_DEFAULT) {
         // get points
@@ -316,6 +317,22 @@ void cEnemy::Handle_Ball_Hit(const cBall& ball, const cObjectCollision* p_collis
     }
 }
 
+void cEnemy::Set_Kill_Sound(const std::string& filename)
+{
+    m_kill_sound = filename;
+    m_kill_sound_resolved = 0;
+}
+
+Sound_Handle cEnemy::Get_Kill_Sound_Handle(void)
+{
+    if (!m_kill_sound_resolved) {
+        m_kill_sound_handle = pAudio->Get_Sound_Handle(utf8_to_path(m_kill_sound));
+        m_kill_sound_resolved = 1;
+    }
+
+    return m_kill_sound_handle;
+}
+
 xmlpp::Element* cEnemy::Save_To_XML_Node(xmlpp::Element* p_element)
 {
     return cMovingSprite::Save_To_XML_Node(p_element);
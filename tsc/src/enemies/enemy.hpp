@@ -83,6 +83,11 @@ namespace TSC {
         // Handle hit by ball
         virtual void Handle_Ball_Hit(const cBall& ball, const cObjectCollision* p_collision);
 
+        // Set the sound filename played if got killed
+        void Set_Kill_Sound(const std::string& filename);
+        // Returns the handle of the kill sound, it is only resolved once
+        Sound_Handle Get_Kill_Sound_Handle(void);
+
         // Save to XML node
         virtual xmlpp::Element* Save_To_XML_Node(xmlpp::Element* p_element);
 
@@ -94,8 +99,12 @@ namespace TSC {
         // default counter for animations
         float m_counter;
 
-        // sound filename if got killed
+        // sound filename if got killed, set with Set_Kill_Sound()
         std::string m_kill_sound;
+        // handle of the kill sound
+        Sound_Handle m_kill_sound_handle;
+        // if set the kill sound handle is resolved
+        bool m_kill_sound_resolved;
         // points if enemy got killed
         unsigned int m_kill_points;
 
@@ -90,7 +90,7 @@ void cFlyon::Init(void)
     Set_Max_Distance(200);
     Set_Speed(5.8f);
 
-    m_kill_sound = "enemy/flyon/die.ogg";
+    Set_Kill_Sound("enemy/flyon/die.ogg");
     m_kill_points = 100;
 
     m_wait_time = Get_Random_Float(0.0f, 70.0f);
@@ -322,7 +322,7 @@ void cFurball::Update_Normal_Dying()
             // finished scale out animation
             if (m_scale_x <= 0.1f) {
                 // sound
-                pAudio->Play_Sound(m_kill_sound);
+                pAudio->Play_Sound(Get_Kill_Sound_Handle());
 
                 // star explosion animation
                 Generate_Smoke(30);
@@ -650,14 +650,14 @@ void cFurball::Handle_Collision_Player(cObjectCollision* collision)
     if (collision->m_direction == DIR_TOP && pLevel_Player->m_state != STA_FLY) {
         if (m_type == TYPE_FURBALL_BOSS) {
             if (m_state == STA_STAY || m_state == STA_RUN) {
-                pAudio->Play_Sound("enemy/boss/furball/hit_failed.wav");
+                pAudio->Play_Sound(SOUND_ENEMY_BOSS_FURBALL_HIT_FAILED, -1, -1, false, SOUND_PRIORITY_HIGH);
             }
             else {
-                pAudio->Play_Sound("enemy/boss/furball/hit.wav");
+                pAudio->Play_Sound(SOUND_ENEMY_BOSS_FURBALL_HIT, -1, -1, false, SOUND_PRIORITY_HIGH);
             }
         }
         else {
-            pAudio->Play_Sound(m_kill_sound);
+            pAudio->Play_Sound(Get_Kill_Sound_Handle());
         }
 
         DownGrade();
@@ -728,7 +728,7 @@ void cFurball::Handle_Collision_Massive(cObjectCollision* collision)
 
 void cFurball::Handle_Collision_Box(ObjectDirection cdirection, GL_rect* r2)
 {
-    pAudio->Play_Sound(m_kill_sound);
+    pAudio->Play_Sound(Get_Kill_Sound_Handle());
     gp_hud->Add_Points(m_kill_points, m_pos_x, m_pos_y - 5.0f, "", static_cast<uint8_t>(255), 1 );
     pLevel_Player->Add_Kill_Multiplier();
     DownGrade(true);
@@ -89,7 +89,7 @@ void cGee::Init(void)
     m_color_type = COL_DEFAULT;
     Set_Color(COL_YELLOW);
 
-    m_kill_sound = "enemy/gee/die.ogg";
+    Set_Kill_Sound("enemy/gee/die.ogg");
     m_name = "Gee";
 
     m_wait_time_counter = 0.0f;
@@ -511,7 +511,7 @@ void cGee::Handle_Collision_Player(cObjectCollision* collision)
     }
 
     if (collision->m_direction == DIR_TOP && pLevel_Player->m_state != STA_FLY) {
-        pAudio->Play_Sound(m_kill_sound);
+        pAudio->Play_Sound(Get_Kill_Sound_Handle());
 
         DownGrade();
         pLevel_Player->Action_Jump(1);
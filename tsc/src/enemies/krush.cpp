@@ -73,7 +73,7 @@ void cKrush::Init(void)
     Set_Moving_State(STA_WALK);
     Set_Direction(DIR_RIGHT);
 
-    m_kill_sound = "enemy/krush/die.ogg";
+    Set_Kill_Sound("enemy/krush/die.ogg");
 }
 
 cKrush* cKrush::Copy(void) const
@@ -291,7 +291,7 @@ void cKrush::Handle_Collision_Player(cObjectCollision* collision)
 
     if (collision->m_direction == DIR_TOP && pLevel_Player->m_state != STA_FLY) {
         gp_hud->Add_Points(m_kill_points, m_pos_x, m_pos_y - 5.0f, "", static_cast<uint8_t>(255), 1);
-        pAudio->Play_Sound(m_kill_sound);
+        pAudio->Play_Sound(Get_Kill_Sound_Handle());
 
         // big walking
         if (m_state == STA_WALK) {
@@ -362,7 +362,7 @@ void cKrush::Handle_Collision_Massive(cObjectCollision* collision)
 
 void cKrush::Handle_Collision_Box(ObjectDirection cdirection, GL_rect* r2)
 {
-    pAudio->Play_Sound(m_kill_sound);
+    pAudio->Play_Sound(Get_Kill_Sound_Handle());
     gp_hud->Add_Points(m_kill_points, m_pos_x, m_pos_y - 5.0f, "", static_cast<uint8_t>(255), 1 );
     pLevel_Player->Add_Kill_Multiplier();
     DownGrade(true);
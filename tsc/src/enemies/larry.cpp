@@ -65,7 +65,7 @@ void cLarry::Init()
     m_ice_resistance = 1.0f;
     m_can_be_hit_from_shell = true;
     m_explosion_counter = 0.0f;
-    m_kill_sound = "ambient/thunder_1.ogg";
+    Set_Kill_Sound("ambient/thunder_1.ogg");
 
     Add_Image_Set("walk", "enemy/larry/grey/walk.imgset");
     Add_Image_Set("walk_turn", "enemy/larry/grey/walk_turn.imgset", 0, &m_walk_turn_start, &m_walk_turn_end);
@@ -112,7 +112,7 @@ void cLarry::DownGrade(bool force /* = false */)
         m_velx = 0.0f;
         m_vely = 0.0f;
 
-        pAudio->Play_Sound(m_kill_sound);
+        pAudio->Play_Sound(Get_Kill_Sound_Handle());
         Explosion_Animation();
     }
     else if (m_state == STA_WALK) {
@@ -74,7 +74,7 @@ void cPip::Init()
     Set_Direction(DIR_RIGHT);
 
     // FIXME: Own die sound
-    m_kill_sound = "enemy/krush/die.ogg";
+    Set_Kill_Sound("enemy/krush/die.ogg");
 }
 
 cPip* cPip::Copy() const
@@ -286,13 +286,13 @@ void cPip::Handle_Collision_Player(cObjectCollision* p_collision)
     // Hit from the top. Downgrade if Alex is not small.
     if (p_collision->m_direction == DIR_TOP && pLevel_Player->m_state != STA_FLY) {
         if (pLevel_Player->m_alex_type == ALEX_SMALL) {
-            pAudio->Play_Sound("wall_hit.wav");
+            pAudio->Play_Sound(SOUND_WALL_HIT);
             pLevel_Player->Action_Jump(true);
             return;
         }
 
         gp_hud->Add_Points(m_kill_points, m_pos_x, m_pos_y - 5.0f, "", static_cast<uint8_t>(255), true);
-        pAudio->Play_Sound(m_kill_sound);
+        pAudio->Play_Sound(Get_Kill_Sound_Handle());
 
         // big walking
         if (m_state == STA_WALK) {
@@ -313,7 +313,7 @@ void cPip::Handle_Collision_Player(cObjectCollision* p_collision)
             pLevel_Player->Add_Kill_Multiplier();
             // Whoooohooooo!  Shoot the player up high!
             pLevel_Player->m_vely = -60.0f;
-            pAudio->Play_Sound("player/jump_big_power.ogg");
+            pAudio->Play_Sound(SOUND_PLAYER_JUMP_BIG_POWER);
         }
     }
     else { // Otherwise downgrade Alex
@@ -93,7 +93,7 @@ void cRokko::Init(void)
 
     m_smoke_counter = 0;
 
-    m_kill_sound = "enemy/rokko/hit.wav";
+    Set_Kill_Sound("enemy/rokko/hit.wav");
     m_kill_points = 250;
 
     Add_Image_Set("fly", "enemy/rokko/yellow/fly.imgset");
@@ -209,7 +209,7 @@ void cRokko::Set_Max_Distance_Sides(float distance)
 void cRokko::Activate(bool with_sound /* = 1 */)
 {
     if (with_sound) {
-        pAudio->Play_Sound("enemy/rokko/activate.wav");
+        pAudio->Play_Sound(SOUND_ENEMY_ROKKO_ACTIVATE);
     }
 
     m_state = STA_FLY;
@@ -417,10 +417,8 @@ GL_rect cRokko::Get_Final_Distance_Rect(void) const
 
 void cRokko::Generate_Smoke(unsigned int amount /* = 10 */) const
 {
-    cParticle_Emitter* anim = NULL;
-
     // moving smoke particle animation
-    anim = new cParticle_Emitter(m_sprite_manager);
+    cParticle_Emitter* anim = pActive_Animation_Manager->Get_Effect(EFFECT_SMOKE_BIG, m_sprite_manager);
 
     // not dead
     if (!m_dead) {
@@ -453,13 +451,7 @@ void cRokko::Generate_Smoke(unsigned int amount /* = 10 */) const
 
     // - m_pos_z_delta caused a weird graphical z pos bug with an ATI card
     anim->Set_Pos_Z(m_pos_z - m_corrected_pos_z_delta);
-    anim->Set_Image(pVideo->Get_Surface("animation/particles/smoke_grey_big.png"));
     anim->Set_Quota(amount);
-    anim->Set_Time_to_Live(0.8f, 0.8f);
-    anim->Set_Speed(1.0f, 0.2f);
-    anim->Set_Const_Rotation_Z(-1, 2);
-    anim->Set_Color(Color(static_cast<uint8_t>(155), 150, 130));
-    anim->Set_Fading_Alpha(1);
 
     anim->Emit();
     pActive_Animation_Manager->Add(anim);
@@ -468,17 +460,10 @@ void cRokko::Generate_Smoke(unsigned int amount /* = 10 */) const
 void cRokko::Generate_Sparks(unsigned int amount /* = 5 */) const
 {
     // animation
-    cParticle_Emitter* anim = new cParticle_Emitter(m_sprite_manager);
+    cParticle_Emitter* anim = pActive_Animation_Manager->Get_Effect(EFFECT_SPARKS, m_sprite_manager);
     anim->Set_Emitter_Rect(m_pos_x + m_col_rect.m_w * 0.2f, m_pos_y + m_rect.m_h * 0.2f, m_col_rect.m_w * 0.6f, m_rect.m_h * 0.6f);
     anim->Set_Pos_Z(m_pos_z + m_corrected_pos_z_delta);
     anim->Set_Quota(amount);
-    anim->Set_Time_to_Live(0.2f, 0.1f);
-    anim->Set_Speed(1.2f, 1.1f);
-    anim->Set_Image(pVideo->Get_Surface("animation/particles/light.png"));
-    anim->Set_Color(Color(static_cast<uint8_t>(250), 250, 200), Color(static_cast<uint8_t>(5), 5, 0, 0));
-    anim->Set_Scale(0.3f, 0.3f);
-    anim->Set_Fading_Size(1);
-    anim->Set_Fading_Alpha(0);
     anim->Emit();
     pActive_Animation_Manager->Add(anim);
 }
@@ -534,7 +519,7 @@ void cRokko::Handle_Collision_Player(cObjectCollision* collision)
 
         if (collision->m_direction == DIR_TOP && pLevel_Player->m_state != STA_FLY) {
             gp_hud->Add_Points(m_kill_points, m_pos_x + m_rect.m_w / 3, m_pos_y - 10.0f, "", static_cast<uint8_t>(255), 1);
-            pAudio->Play_Sound(m_kill_sound);
+            pAudio->Play_Sound(Get_Kill_Sound_Handle());
             pLevel_Player->Action_Jump(1);
 
             pLevel_Player->Add_Kill_Multiplier();
@@ -547,7 +532,7 @@ void cRokko::Handle_Collision_Player(cObjectCollision* collision)
     else if (m_direction == DIR_UP || m_direction == DIR_DOWN) {
         if ((collision->m_direction == DIR_LEFT || collision->m_direction == DIR_LEFT) && pLevel_Player->m_state == STA_FLY) {
             gp_hud->Add_Points(m_kill_points, m_pos_x, m_pos_y - 5.0f, "", static_cast<uint8_t>(255), 1);
-            pAudio->Play_Sound(m_kill_sound);
+            pAudio->Play_Sound(Get_Kill_Sound_Handle());
 
             pLevel_Player->Add_Kill_Multiplier();
             DownGrade();
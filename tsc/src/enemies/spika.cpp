@@ -236,7 +236,7 @@ void cSpika::Update(void)
 
     // play walking sound based on speed
     if (m_walk_count < m_rot_z - 30.0f || m_walk_count > m_rot_z + 30.0f) {
-        pAudio->Play_Sound("enemy/spika/move.ogg");
+        pAudio->Play_Sound(SOUND_ENEMY_SPIKA_MOVE);
 
         m_walk_count = m_rot_z;
     }
@@ -376,7 +376,7 @@ void cSpika::Handle_Collision_Enemy(cObjectCollision* collision)
             return;
         }
 
-        pAudio->Play_Sound(enemy->m_kill_sound);
+        pAudio->Play_Sound(enemy->Get_Kill_Sound_Handle());
         gp_hud->Add_Points(enemy->m_kill_points, enemy->m_pos_x, enemy->m_pos_y - 5.0f, "", static_cast<uint8_t>(255), 1);
         enemy->DownGrade(1);
     }
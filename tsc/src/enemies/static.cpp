@@ -58,9 +58,9 @@ cStaticEnemy::cStaticEnemy(XmlAttributes& attributes, cSprite_Manager* sprite_ma
     Set_Rotation_Speed(string_to_float(attributes.fetch("rotation_speed", "-7.5")));
 
     // image
-    m_image_filename = attributes.fetch("image", m_image_filename); // Init sets m_image_filename default
+    Set_Image_Filename(attributes.fetch("image", Get_Image_Filename())); // Init sets the image filename default
     Clear_Images();
-    Add_Image_Set("main", utf8_to_path(m_image_filename));
+    Add_Image_Set("main", utf8_to_path(Get_Image_Filename()));
     Set_Image_Set("main", true);
 
     // path
@@ -92,9 +92,9 @@ void cStaticEnemy::Init(void)
     Set_Rotation_Speed(0.0f);
     Set_Speed(0.0f);
 
-    m_image_filename = "enemy/static/blocks/spike_1/2_grey.png";
+    Set_Image_Filename("enemy/static/blocks/spike_1/2_grey.png");
     Clear_Images();
-    Add_Image_Set("main", utf8_to_path(m_image_filename));
+    Add_Image_Set("main", utf8_to_path(Get_Image_Filename()));
     Set_Image_Set("main", true);
 }
 
@@ -109,8 +109,8 @@ cStaticEnemy* cStaticEnemy::Copy(void) const
     cStaticEnemy* static_enemy = new cStaticEnemy(m_sprite_manager);
     static_enemy->Set_Pos(m_start_pos_x, m_start_pos_y, 1);
     static_enemy->Clear_Images();
-    static_enemy->m_image_filename = m_image_filename;
-    static_enemy->Add_Image_Set("main", utf8_to_path(m_image_filename));
+    static_enemy->Set_Image_Filename(Get_Image_Filename());
+    static_enemy->Add_Image_Set("main", utf8_to_path(Get_Image_Filename()));
     static_enemy->Set_Image_Set("main", true);
     static_enemy->Set_Rotation_Speed(m_rotation_speed);
     static_enemy->Set_Path_Identifier(m_path_state.m_path_identifier);
@@ -129,7 +129,7 @@ xmlpp::Element* cStaticEnemy::Save_To_XML_Node(xmlpp::Element* p_element)
 {
     xmlpp::Element* p_node = cEnemy::Save_To_XML_Node(p_element);
 
-    Replace_Property(p_node, "image", m_image_filename);
+    Replace_Property(p_node, "image", Get_Image_Filename());
     Add_Property(p_node, "rotation_speed", m_rotation_speed);
     Add_Property(p_node, "path", m_path_state.m_path_identifier);
     Add_Property(p_node, "speed", m_speed);
@@ -300,7 +300,7 @@ void cStaticEnemy::Handle_Collision_Enemy(cObjectCollision* collision)
     }
 
     // kill enemy
-    pAudio->Play_Sound(enemy->m_kill_sound);
+    pAudio->Play_Sound(enemy->Get_Kill_Sound_Handle());
     gp_hud->Add_Points(enemy->m_kill_points, m_pos_x, m_pos_y - 5.0f, "", static_cast<uint8_t>(255), 1);
     enemy->DownGrade(1);
 }
@@ -314,7 +314,7 @@ void cStaticEnemy::Editor_Activate(void)
     CEGUI::Editbox* editbox = static_cast<CEGUI::Editbox*>(wmgr.createWindow("TSCLook256/Editbox", "editor_static_enemy_image"));
     pLevel_Editor->Add_Config_Widget(UTF8_("Image"), UTF8_("Image filename"), editbox);
 
-    editbox->setText(m_image_filename.c_str());
+    editbox->setText(Get_Image_Filename().c_str());
     editbox->subscribeEvent(CEGUI::Editbox::EventTextChanged, CEGUI::Event::Subscriber(&cStaticEnemy::Editor_Image_Text_Changed, this));
 
     // rotation speed
@@ -374,8 +374,8 @@ bool cStaticEnemy::Editor_Image_Text_Changed(const CEGUI::EventArgs& event)
     std::string str_text = static_cast<CEGUI::Editbox*>(windowEventArgs.window)->getText().c_str();
 
     Clear_Images();
-    m_image_filename = str_text;
-    Add_Image_Set("main", utf8_to_path(m_image_filename));
+    Set_Image_Filename(str_text);
+    Add_Image_Set("main", utf8_to_path(str_text));
     Set_Image_Set("main", true);
 
     return 1;
@@ -94,7 +94,7 @@ void cThromp::Init(void)
     Set_Speed(7);
     Set_Max_Distance(200);
 
-    m_kill_sound = "enemy/thromp/die.ogg";
+    Set_Kill_Sound("enemy/thromp/die.ogg");
     m_kill_points = 200;
 }
 
@@ -518,16 +518,10 @@ void cThromp::Generate_Smoke(unsigned int amount /* = 20 */) const
     }
 
     // animation
-    cParticle_Emitter* anim = new cParticle_Emitter(m_sprite_manager);
+    cParticle_Emitter* anim = pActive_Animation_Manager->Get_Effect(EFFECT_SMOKE, m_sprite_manager);
     anim->Set_Emitter_Rect(smoke_x, smoke_y, smoke_width, smoke_height);
-    anim->Set_Image(pVideo->Get_Surface("animation/particles/smoke.png"));
     anim->Set_Quota(amount);
     anim->Set_Pos_Z(m_pos_z + m_pos_z_delta);
-    anim->Set_Time_to_Live(1, 1);
-    anim->Set_Direction_Range(180, 180);
-    anim->Set_Speed(0.05f, 0.4f);
-    anim->Set_Fading_Alpha(1);
-    anim->Set_Const_Rotation_Z(-2, 4);
     anim->Emit();
     pActive_Animation_Manager->Add(anim);
 }
@@ -597,7 +591,7 @@ void cThromp::Handle_Collision_Player(cObjectCollision* collision)
         pLevel_Player->DownGrade_Player();
 
         if (Move_Back()) {
-            pAudio->Play_Sound("enemy/thromp/hit.ogg");
+            pAudio->Play_Sound(SOUND_ENEMY_THROMP_HIT);
             Generate_Smoke();
         }
     }
@@ -622,7 +616,7 @@ void cThromp::Handle_Collision_Enemy(cObjectCollision* collision)
             }
             // kill enemy
             else {
-                pAudio->Play_Sound(enemy->m_kill_sound);
+                pAudio->Play_Sound(enemy->Get_Kill_Sound_Handle());
                 gp_hud->Add_Points(enemy->m_kill_points, m_pos_x + m_image->m_w / 3, m_pos_y - 5, "", static_cast<uint8_t>(255), 1);
                 enemy->DownGrade(1);
 
@@ -655,7 +649,7 @@ void cThromp::Handle_Collision_Massive(cObjectCollision* collision)
     }
 
     if (Move_Back()) {
-        pAudio->Play_Sound("enemy/thromp/hit.ogg");
+        pAudio->Play_Sound(SOUND_ENEMY_THROMP_HIT);
         Generate_Smoke();
     }
 }
@@ -663,7 +657,7 @@ void cThromp::Handle_Collision_Massive(cObjectCollision* collision)
 void cThromp::Handle_out_of_Level(ObjectDirection dir)
 {
     if (Move_Back()) {
-        pAudio->Play_Sound("enemy/thromp/hit.ogg");
+        pAudio->Play_Sound(SOUND_ENEMY_THROMP_HIT);
         Generate_Smoke();
     }
 }
@@ -24,6 +24,9 @@
 #include "../overworld/overworld.hpp"
 #include "../objects/bonusbox.hpp"
 #include "../scene/scene.hpp"
+#include "../audio/audio.hpp"
+#include "../video/img_manager.hpp"
+#include "../video/renderer.hpp"
 #include "debug_window.hpp"
 
 // extern
@@ -214,4 +217,52 @@ void cDebug_Window::Update()
              _("Game Mode: %d"),
              Game_Mode);
     mp_debugwin_root->getChild("game_mode")->setText(reinterpret_cast<const CEGUI::utf8*>(buf));
+
+    // Per-object footprint, to keep an eye on the hot sprite data size
+    snprintf(buf,
+             4096,
+             _("Sprite size: %lu B Moving: %lu B"),
+             static_cast<unsigned long>(sizeof(cSprite)),
+             static_cast<unsigned long>(sizeof(cMovingSprite)));
+    mp_debugwin_root->getChild("memory")->setText(reinterpret_cast<const CEGUI::utf8*>(buf));
+
+    snprintf(buf,
+             4096,
+             _("Drawn: %u Culled: %u Indexed: %u"),
+             mp_sprite_manager->m_drawn_count,
+             mp_sprite_manager->m_culled_count,
+             mp_sprite_manager->m_spatial_index.m_indexed_count);
+    mp_debugwin_root->getChild("culling")->setText(reinterpret_cast<const CEGUI::utf8*>(buf));
+
+    // milliseconds per 100 frames
+    snprintf(buf,
+             4096,
+             _("Render: %.2f ms Thread: %.2f ms Wait: %.2f ms GL calls: %u Skipped: %u"),
+             pFramerate->m_perf_timer[PERF_RENDER_GAME]->ms / 100.0f,
+             pFramerate->m_perf_timer[PERF_RENDER_THREAD]->ms / 100.0f,
+             pFramerate->m_perf_timer[PERF_RENDER_WAIT]->ms / 100.0f,
+             pRenderer->m_gl_calls_issued,
+             pRenderer->m_gl_calls_skipped);
+    mp_debugwin_root->getChild("render")->setText(reinterpret_cast<const CEGUI::utf8*>(buf));
+
+    snprintf(buf,
+             4096,
+             _("Voices: %u/%u Stolen: %u Dropped: %u Culled: %u"),
+             pAudio->Get_Playing_Voice_Count(),
+             pAudio->m_max_sounds,
+             pAudio->m_voices_stolen,
+             pAudio->m_voices_dropped,
+             pAudio->m_voices_culled);
+    mp_debugwin_root->getChild("sound")->setText(reinterpret_cast<const CEGUI::utf8*>(buf));
+
+    snprintf(buf,
+             4096,
+             _("Textures: %u MB Unpadded: -%u KB Evicted: %u/%u Reloaded: %u Pinned: %u"),
+             static_cast<unsigned int>(pImage_Manager->Get_Texture_Memory() / (1024 * 1024)),
+             static_cast<unsigned int>(pImage_Manager->Get_Padding_Saved() / 1024),
+             pImage_Manager->Get_Evicted_Count(),
+             pImage_Manager->m_eviction_count,
+             pImage_Manager->m_reload_count,
+             pImage_Manager->Get_Pinned_Count());
+    mp_debugwin_root->getChild("textures")->setText(reinterpret_cast<const CEGUI::utf8*>(buf));
 }
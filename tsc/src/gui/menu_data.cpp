@@ -3218,8 +3218,10 @@ bool cMenu_Savegames::Button_Save_Clicked(const CEGUI::EventArgs& event)
 
     pAudio->Play_Sound("savegame_save.ogg");
 
-    // save
-    pSavegame->Save_Game(slot, description);
+    // save, the HUD shows the result when it is written
+    if (!pSavegame->Save_Game(slot, description)) {
+        gp_hud->Set_Text(_("Couldn't save savegame ") + description);
+    }
 
     Game_Action = GA_ENTER_MENU;
     Game_Action_Data_Middle.add("load_menu", int_to_string(MENU_MAIN));
@@ -3553,7 +3555,7 @@ void cMenu_Credits::Update(void)
         Exit();
     }
 
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Escape) || sf::Keyboard::isKeyPressed(sf::Keyboard::Return) ||
+    if (pKeyboard->Is_Key_Down(sf::Keyboard::Escape) || pKeyboard->Is_Key_Down(sf::Keyboard::Return) ||
             pJoystick->Button(pPreferences->m_joy_button_action) || pJoystick->Button(pPreferences->m_joy_button_exit)) {
         Exit();
     }
@@ -0,0 +1,634 @@
+/***************************************************************************
+ * input_recorder.cpp - record and replay play sessions
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../input/input_recorder.hpp"
+#include "../core/game_core.hpp"
+#include "../core/property_helper.hpp"
+#include "../core/sprite_manager.hpp"
+#include "../level/level.hpp"
+#include "../level/level_player.hpp"
+#include "../gui/hud.hpp"
+#include "../input/keyboard.hpp"
+#include "../input/joystick.hpp"
+#include "../video/video.hpp"
+#include "../core/framerate.hpp"
+
+using namespace std;
+
+namespace fs = boost::filesystem;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** *** cInput_Recorder *** *** *** *** *** *** *** *** *** *** */
+
+const char cInput_Recorder::m_magic[6] = {'T', 'S', 'C', 'R', 'E', 'C'};
+const uint8_t cInput_Recorder::m_version = 2;
+
+// FNV-1a
+static void Hash_Data(uint64_t& hash, const void* data, size_t size)
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+}
+
+template<class T> static void Hash_Value(uint64_t& hash, const T& value)
+{
+    Hash_Data(hash, &value, sizeof(T));
+}
+
+cInput_Recorder::cInput_Recorder(void)
+{
+    m_seed = 0;
+    m_frame_steps = 0;
+    m_frame_speed_factor = 1.0f;
+    m_mode = MODE_NONE;
+    m_has_pending_event = 0;
+    m_next_item = 0;
+    m_has_next_item = 0;
+    m_recorded_hash = 0;
+    m_frame_count = 0;
+    m_start_ticks = 0;
+    m_last_ticks = 0;
+    m_frame_ms_min = 0;
+    m_frame_ms_max = 0;
+}
+
+cInput_Recorder::~cInput_Recorder(void)
+{
+    Finish();
+}
+
+template<class T> void cInput_Recorder::Write_Value(const T& value)
+{
+    m_output.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<class T> bool cInput_Recorder::Read_Value(T& value)
+{
+    m_input.read(reinterpret_cast<char*>(&value), sizeof(T));
+
+    return !m_input.fail();
+}
+
+bool cInput_Recorder::Start_Recording(const fs::path& filename, unsigned int seed, const std::string& level)
+{
+    Finish();
+
+    m_output.open(filename, ios::out | ios::binary | ios::trunc);
+
+    if (!m_output.is_open()) {
+        cerr << "Error: Could not open '" << path_to_utf8(filename) << "' for recording" << endl;
+        return 0;
+    }
+
+    m_filename = filename;
+    m_seed = seed;
+    m_level = level;
+
+    m_output.write(m_magic, sizeof(m_magic));
+    Write_Value(m_version);
+    Write_Value(static_cast<uint32_t>(m_seed));
+    Write_Value(static_cast<uint16_t>(m_level.size()));
+    m_output.write(m_level.data(), m_level.size());
+
+    m_mode = MODE_RECORD;
+    m_has_pending_event = 0;
+    m_frame_count = 0;
+
+    cout << "Recording input to " << path_to_utf8(filename) << endl;
+
+    return 1;
+}
+
+bool cInput_Recorder::Start_Replay(const fs::path& filename)
+{
+    Finish();
+
+    m_input.open(filename, ios::in | ios::binary);
+
+    if (!m_input.is_open()) {
+        cerr << "Error: Could not open recording '" << path_to_utf8(filename) << "'" << endl;
+        return 0;
+    }
+
+    char magic[sizeof(m_magic)];
+    uint8_t version = 0;
+    uint32_t seed = 0;
+    uint16_t level_length = 0;
+
+    m_input.read(magic, sizeof(magic));
+
+    if (!m_input || !std::equal(magic, magic + sizeof(magic), m_magic) || !Read_Value(version) || version != m_version) {
+        cerr << "Error: '" << path_to_utf8(filename) << "' is not a supported recording" << endl;
+        m_input.close();
+        return 0;
+    }
+
+    if (!Read_Value(seed) || !Read_Value(level_length)) {
+        cerr << "Error: Recording '" << path_to_utf8(filename) << "' is truncated" << endl;
+        m_input.close();
+        return 0;
+    }
+
+    m_level.resize(level_length);
+
+    if (level_length) {
+        m_input.read(&m_level[0], level_length);
+    }
+
+    m_filename = filename;
+    m_seed = seed;
+    m_mode = MODE_REPLAY;
+    m_recorded_hash = 0;
+    m_has_next_item = 0;
+    m_frame_count = 0;
+    m_frame_ms_min = UINT_MAX;
+    m_frame_ms_max = 0;
+    m_start_ticks = m_last_ticks = TSC_GetTicks();
+
+    cout << "Replaying input from " << path_to_utf8(filename) << endl;
+
+    return 1;
+}
+
+bool cInput_Recorder::Is_Input_Event(const sf::Event& evt)
+{
+    switch (evt.type) {
+    case sf::Event::KeyPressed:
+    case sf::Event::KeyReleased:
+    case sf::Event::TextEntered:
+    case sf::Event::JoystickButtonPressed:
+    case sf::Event::JoystickButtonReleased:
+    case sf::Event::JoystickMoved:
+    // resets the input states
+    case sf::Event::LostFocus:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+void cInput_Recorder::Update_Input_States(const sf::Event& evt)
+{
+    switch (evt.type) {
+    case sf::Event::KeyPressed:
+    case sf::Event::KeyReleased:
+        pKeyboard->Update_Key_State(evt);
+        break;
+    case sf::Event::JoystickButtonPressed:
+    case sf::Event::JoystickButtonReleased:
+        pJoystick->Update_Button_State(evt);
+        break;
+    case sf::Event::LostFocus:
+        // releases are not reported while unfocused
+        pKeyboard->Reset_Keys();
+        pJoystick->Reset_keys();
+        break;
+    default:
+        break;
+    }
+}
+
+void cInput_Recorder::Record_Event(const sf::Event& evt)
+{
+    if (m_mode != MODE_RECORD || !Is_Input_Event(evt)) {
+        return;
+    }
+
+    Write_Pending_Event();
+
+    m_pending_event.m_event = evt;
+    m_pending_event.m_dispatched = 0;
+    m_has_pending_event = 1;
+}
+
+void cInput_Recorder::Set_Dispatched(void)
+{
+    if (m_mode != MODE_RECORD || !m_has_pending_event) {
+        return;
+    }
+
+    m_pending_event.m_dispatched = 1;
+}
+
+void cInput_Recorder::Record_Frame(float speed_factor)
+{
+    if (m_mode != MODE_RECORD) {
+        return;
+    }
+
+    Write_Pending_Event();
+
+    Write_Value(static_cast<uint8_t>(ITEM_FRAME));
+    Write_Value(speed_factor);
+
+    m_frame_count++;
+}
+
+void cInput_Recorder::Record_Steps(unsigned int steps)
+{
+    if (m_mode != MODE_RECORD) {
+        return;
+    }
+
+    Write_Pending_Event();
+
+    Write_Value(static_cast<uint8_t>(ITEM_STEPS));
+    Write_Value(static_cast<uint8_t>(std::min<unsigned int>(steps, UCHAR_MAX)));
+}
+
+bool cInput_Recorder::Replay_Frame(void)
+{
+    if (m_mode != MODE_REPLAY) {
+        return 0;
+    }
+
+    // frame timing of the previous frame
+    const uint32_t ticks = TSC_GetTicks();
+
+    if (m_frame_count) {
+        const uint32_t frame_ms = ticks - m_last_ticks;
+
+        m_frame_ms_min = std::min(m_frame_ms_min, frame_ms);
+        m_frame_ms_max = std::max(m_frame_ms_max, frame_ms);
+    }
+
+    m_last_ticks = ticks;
+
+    // events polled outside of the replayed loops only change the key states
+    sf::Event evt;
+
+    while (Replay_Next_Event(evt)) {
+        //
+    }
+
+    uint8_t item = 0;
+
+    if (!Peek_Item(item)) {
+        cerr << "Warning: Recording '" << path_to_utf8(m_filename) << "' ends without state hash" << endl;
+        return 0;
+    }
+
+    m_has_next_item = 0;
+
+    if (item == ITEM_END) {
+        Read_Value(m_recorded_hash);
+        return 0;
+    }
+
+    if (item != ITEM_FRAME) {
+        cerr << "Warning: Replay of '" << path_to_utf8(m_filename) << "' diverged, a blocking loop did not run" << endl;
+        return 0;
+    }
+
+    if (!Read_Value(m_frame_speed_factor)) {
+        cerr << "Warning: Recording '" << path_to_utf8(m_filename) << "' is truncated" << endl;
+        return 0;
+    }
+
+    m_frame_steps = 0;
+    m_frame_count++;
+
+    return 1;
+}
+
+bool cInput_Recorder::Replay_Event(sf::Event& evt)
+{
+    if (m_mode != MODE_REPLAY) {
+        return 0;
+    }
+
+    if (Replay_Next_Event(evt)) {
+        return 1;
+    }
+
+    uint8_t item = 0;
+    uint8_t steps = 0;
+
+    // anything else is noticed by the next Replay_Frame()
+    if (Peek_Item(item) && item == ITEM_STEPS) {
+        m_has_next_item = 0;
+
+        if (Read_Value(steps)) {
+            m_frame_steps = steps;
+        }
+    }
+
+    return 0;
+}
+
+bool cInput_Recorder::Poll_Event(sf::Event& evt)
+{
+    if (m_mode != MODE_REPLAY) {
+        if (!pVideo->PollEvent(evt)) {
+            return 0;
+        }
+
+        if (Is_Input_Event(evt)) {
+            Set_Dispatched();
+        }
+
+        return 1;
+    }
+
+    // window events stay live
+    while (pVideo->PollEvent(evt)) {
+        if (!Is_Input_Event(evt)) {
+            return 1;
+        }
+    }
+
+    return Replay_Next_Event(evt);
+}
+
+void cInput_Recorder::Blocking_Frame(void)
+{
+    if (m_mode == MODE_RECORD) {
+        Write_Pending_Event();
+
+        Write_Value(static_cast<uint8_t>(ITEM_BLOCKING_FRAME));
+        Write_Value(pFramerate->m_speed_factor);
+    }
+    else if (m_mode == MODE_REPLAY) {
+        // events the loop did not poll anymore
+        sf::Event evt;
+
+        while (Replay_Next_Event(evt)) {
+            //
+        }
+
+        uint8_t item = 0;
+
+        // anything else is noticed by the next Replay_Frame()
+        if (Peek_Item(item) && item == ITEM_BLOCKING_FRAME) {
+            m_has_next_item = 0;
+            Read_Value(pFramerate->m_speed_factor);
+        }
+    }
+}
+
+void cInput_Recorder::Write_Pending_Event(void)
+{
+    if (!m_has_pending_event) {
+        return;
+    }
+
+    Write_Value(static_cast<uint8_t>(ITEM_EVENT));
+    Write_Event(m_pending_event);
+
+    m_has_pending_event = 0;
+}
+
+bool cInput_Recorder::Peek_Item(uint8_t& item)
+{
+    if (!m_has_next_item) {
+        if (!Read_Value(m_next_item)) {
+            return 0;
+        }
+
+        m_has_next_item = 1;
+    }
+
+    item = m_next_item;
+
+    return 1;
+}
+
+bool cInput_Recorder::Replay_Next_Event(sf::Event& evt)
+{
+    uint8_t item = 0;
+
+    while (Peek_Item(item) && item == ITEM_EVENT) {
+        m_has_next_item = 0;
+
+        Recorded_Event recorded;
+
+        if (!Read_Event(recorded)) {
+            cerr << "Warning: Recording '" << path_to_utf8(m_filename) << "' is truncated" << endl;
+            return 0;
+        }
+
+        evt = recorded.m_event;
+        Update_Input_States(evt);
+
+        if (recorded.m_dispatched) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+void cInput_Recorder::Finish(void)
+{
+    if (m_mode == MODE_RECORD) {
+        Write_Pending_Event();
+        Write_Value(static_cast<uint8_t>(ITEM_END));
+        Write_Value(Get_State_Hash());
+        m_output.close();
+
+        if (m_output.fail()) {
+            cerr << "Error: Could not write recording '" << path_to_utf8(m_filename) << "'" << endl;
+        }
+        else {
+            cout << "Recorded " << m_frame_count << " frames to " << path_to_utf8(m_filename) << endl;
+        }
+    }
+    else if (m_mode == MODE_REPLAY) {
+        const uint32_t total_ms = m_last_ticks - m_start_ticks;
+        const uint64_t hash = Get_State_Hash();
+
+        cout << "Replayed " << m_frame_count << " frames of " << path_to_utf8(m_filename) << " in " << total_ms << " ms" << endl;
+
+        if (m_frame_count > 1) {
+            cout << "Frame time average " << static_cast<float>(total_ms) / (m_frame_count - 1) << " ms, minimum " << m_frame_ms_min << " ms, maximum " << m_frame_ms_max << " ms" << endl;
+        }
+
+        if (!m_recorded_hash) {
+            cout << "Game state unknown, the recording did not end properly" << endl;
+        }
+        else if (hash == m_recorded_hash) {
+            cout << "Game state matches the recording" << endl;
+        }
+        else {
+            cerr << "Warning: Game state diverged from the recording" << endl;
+        }
+
+        m_input.close();
+    }
+
+    m_mode = MODE_NONE;
+    m_has_pending_event = 0;
+    m_has_next_item = 0;
+}
+
+uint64_t cInput_Recorder::Get_State_Hash(void)
+{
+    uint64_t hash = 14695981039346656037ULL;
+
+    Hash_Value(hash, Game_Mode);
+
+    // the hud time uses the wall clock and is left out
+    if (gp_hud) {
+        Hash_Value(hash, gp_hud->Get_Points());
+    }
+
+    if (pLevel_Player) {
+        Hash_Value(hash, pLevel_Player->m_pos_x);
+        Hash_Value(hash, pLevel_Player->m_pos_y);
+        Hash_Value(hash, pLevel_Player->m_velx);
+        Hash_Value(hash, pLevel_Player->m_vely);
+        Hash_Value(hash, pLevel_Player->m_alex_type);
+    }
+
+    if (pActive_Level && pActive_Level->m_sprite_manager) {
+        for (cSprite_List::const_iterator itr = pActive_Level->m_sprite_manager->objects.begin(); itr != pActive_Level->m_sprite_manager->objects.end(); ++itr) {
+            const cSprite* obj = (*itr);
+
+            Hash_Value(hash, obj->m_type);
+            Hash_Value(hash, obj->m_active);
+            Hash_Value(hash, obj->m_pos_x);
+            Hash_Value(hash, obj->m_pos_y);
+        }
+    }
+
+    return hash;
+}
+
+void cInput_Recorder::Write_Event(const Recorded_Event& recorded)
+{
+    const sf::Event& evt = recorded.m_event;
+
+    Write_Value(static_cast<uint8_t>(evt.type));
+    Write_Value(static_cast<uint8_t>(recorded.m_dispatched));
+
+    switch (evt.type) {
+    case sf::Event::KeyPressed:
+    case sf::Event::KeyReleased: {
+        const uint8_t modifiers = (evt.key.alt ? 1 : 0) | (evt.key.control ? 2 : 0) | (evt.key.shift ? 4 : 0) | (evt.key.system ? 8 : 0);
+
+        Write_Value(static_cast<int32_t>(evt.key.code));
+        Write_Value(modifiers);
+        break;
+    }
+    case sf::Event::TextEntered: {
+        Write_Value(static_cast<uint32_t>(evt.text.unicode));
+        break;
+    }
+    case sf::Event::JoystickButtonPressed:
+    case sf::Event::JoystickButtonReleased: {
+        Write_Value(static_cast<uint32_t>(evt.joystickButton.joystickId));
+        Write_Value(static_cast<uint32_t>(evt.joystickButton.button));
+        break;
+    }
+    case sf::Event::JoystickMoved: {
+        Write_Value(static_cast<uint32_t>(evt.joystickMove.joystickId));
+        Write_Value(static_cast<uint8_t>(evt.joystickMove.axis));
+        Write_Value(evt.joystickMove.position);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+bool cInput_Recorder::Read_Event(Recorded_Event& recorded)
+{
+    sf::Event& evt = recorded.m_event;
+    uint8_t type = 0;
+    uint8_t dispatched = 0;
+
+    if (!Read_Value(type) || !Read_Value(dispatched)) {
+        return 0;
+    }
+
+    evt.type = static_cast<sf::Event::EventType>(type);
+    recorded.m_dispatched = dispatched != 0;
+
+    switch (evt.type) {
+    case sf::Event::KeyPressed:
+    case sf::Event::KeyReleased: {
+        int32_t code = 0;
+        uint8_t modifiers = 0;
+
+        if (!Read_Value(code) || !Read_Value(modifiers)) {
+            return 0;
+        }
+
+        evt.key.code = static_cast<sf::Keyboard::Key>(code);
+        evt.key.alt = (modifiers & 1) != 0;
+        evt.key.control = (modifiers & 2) != 0;
+        evt.key.shift = (modifiers & 4) != 0;
+        evt.key.system = (modifiers & 8) != 0;
+        break;
+    }
+    case sf::Event::TextEntered: {
+        uint32_t unicode = 0;
+
+        if (!Read_Value(unicode)) {
+            return 0;
+        }
+
+        evt.text.unicode = unicode;
+        break;
+    }
+    case sf::Event::JoystickButtonPressed:
+    case sf::Event::JoystickButtonReleased: {
+        uint32_t id = 0;
+        uint32_t button = 0;
+
+        if (!Read_Value(id) || !Read_Value(button)) {
+            return 0;
+        }
+
+        evt.joystickButton.joystickId = id;
+        evt.joystickButton.button = button;
+        break;
+    }
+    case sf::Event::JoystickMoved: {
+        uint32_t id = 0;
+        uint8_t axis = 0;
+        float position = 0.0f;
+
+        if (!Read_Value(id) || !Read_Value(axis) || !Read_Value(position)) {
+            return 0;
+        }
+
+        evt.joystickMove.joystickId = id;
+        evt.joystickMove.axis = static_cast<sf::Joystick::Axis>(axis);
+        evt.joystickMove.position = position;
+        break;
+    }
+    case sf::Event::LostFocus:
+        break;
+    default:
+        // unknown event type
+        return 0;
+    }
+
+    return 1;
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+cInput_Recorder* pInput_Recorder = NULL;
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
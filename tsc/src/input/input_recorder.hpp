@@ -0,0 +1,207 @@
+/***************************************************************************
+ * input_recorder.hpp - record and replay play sessions
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_INPUT_RECORDER_HPP
+#define TSC_INPUT_RECORDER_HPP
+
+#include "../core/global_basic.hpp"
+
+namespace TSC {
+
+    /* *** *** *** *** *** *** *** cInput_Recorder *** *** *** *** *** *** *** *** *** *** */
+
+    /* Records the input events of every frame together with the
+     * amount of simulation steps and the frame speed factor, and
+     * feeds them back in a later run instead of the live input.
+     *
+     * The game only sees the keyboard and joystick through events
+     * (see cKeyboard::Is_Key_Down()), so with the same random seed,
+     * start level and preferences a replay runs through exactly the
+     * same game states. At the end the state of the game is hashed,
+     * which shows if a replay diverged from the recording.
+     *
+     * Everything is written in the order it happens, so the blocking
+     * loops of animations and the text box get their events from the
+     * recording through Poll_Event() and Blocking_Frame() while the
+     * main loop is inside a frame. Other blocking loops, like menus
+     * and dialogs, and the mouse still use the live input, their
+     * recorded events only update the key states in a replay.
+     *
+     * File format, all values in host byte order:
+     * header : "TSCREC" version(u8) seed(u32) start level length(u16) start level
+     * items : ITEM_FRAME speed factor(f32)
+     *         ITEM_EVENT type(u8) dispatched(u8) type dependent data
+     *         ITEM_STEPS steps(u8)
+     *         ITEM_BLOCKING_FRAME speed factor(f32)
+     *         ITEM_END state hash(u64)
+    */
+    class cInput_Recorder {
+    public:
+        cInput_Recorder(void);
+        // Finishes the recording
+        ~cInput_Recorder(void);
+
+        /* Start recording to the given file
+         * seed : random seed used for this run
+         * level : level given on the command line or empty
+         * Returns false if the file could not be created
+        */
+        bool Start_Recording(const boost::filesystem::path& filename, unsigned int seed, const std::string& level);
+        /* Start replaying the given file
+         * Returns false if the file could not be read
+        */
+        bool Start_Replay(const boost::filesystem::path& filename);
+
+        // Returns true if recording
+        inline bool Is_Recording(void) const
+        {
+            return m_mode == MODE_RECORD;
+        }
+        // Returns true if replaying
+        inline bool Is_Replaying(void) const
+        {
+            return m_mode == MODE_REPLAY;
+        }
+
+        // Returns true if the event is input that gets recorded
+        static bool Is_Input_Event(const sf::Event& evt);
+        // Update the keyboard and joystick states from an input event
+        static void Update_Input_States(const sf::Event& evt);
+
+        struct Recorded_Event {
+            sf::Event m_event;
+            // if set the event was handled by a loop, otherwise it only changed the key states
+            bool m_dispatched;
+        };
+
+        // Add a polled input event to the recording
+        void Record_Event(const sf::Event& evt);
+        // Mark the last recorded event as handled by the polling loop
+        void Set_Dispatched(void);
+        /* Start a frame of the recording before its input is handled
+         * speed_factor : speed factor of this frame
+        */
+        void Record_Frame(float speed_factor);
+        /* Record the simulation steps of the current frame
+         * Written before the steps run as they may start blocking loops.
+        */
+        void Record_Steps(unsigned int steps);
+
+        /* Read the start of the next frame of the replay into m_frame_speed_factor
+         * Returns false if the replay is finished
+        */
+        bool Replay_Frame(void);
+        /* Read the next input event handled by the main loop in the replayed frame
+         * Returns false when the events are finished and m_frame_steps is set.
+        */
+        bool Replay_Event(sf::Event& evt);
+
+        /* Poll an input event in a blocking loop
+         * Returns the live event or, in a replay, the recorded one.
+         * Window events are always live.
+        */
+        bool Poll_Event(sf::Event& evt);
+        /* Finish an iteration of a blocking loop after pFramerate->Update()
+         * A replay sets the recorded speed factor.
+        */
+        void Blocking_Frame(void);
+
+        /* Finish recording or replaying
+         * Writes or compares the state hash and prints the frame timings.
+         * Must be called before the level is unloaded.
+        */
+        void Finish(void);
+
+        // Returns a hash of the current game state
+        static uint64_t Get_State_Hash(void);
+
+        // random seed of the recording
+        unsigned int m_seed;
+        // level given on the command line when recorded
+        std::string m_level;
+
+        // simulation steps of the replayed frame
+        unsigned int m_frame_steps;
+        // speed factor of the replayed frame
+        float m_frame_speed_factor;
+    private:
+        enum Recorder_Mode {
+            MODE_NONE,
+            MODE_RECORD,
+            MODE_REPLAY
+        };
+
+        enum Record_Item {
+            ITEM_FRAME = 1,
+            ITEM_EVENT = 2,
+            ITEM_STEPS = 3,
+            ITEM_BLOCKING_FRAME = 4,
+            ITEM_END = 0xFF
+        };
+
+        // Write or read a plain value
+        template<class T> void Write_Value(const T& value);
+        template<class T> bool Read_Value(T& value);
+
+        // Write or read an input event
+        void Write_Event(const Recorded_Event& evt);
+        bool Read_Event(Recorded_Event& evt);
+        // Write the last recorded event
+        void Write_Pending_Event(void);
+
+        /* Return the type of the next replayed item without reading it
+         * Returns false at the end of the file
+        */
+        bool Peek_Item(uint8_t& item);
+        /* Read the next replayed input event handled by a loop
+         * Events that only changed the key states are applied and skipped.
+         * Returns false if the next item is not an event.
+        */
+        bool Replay_Next_Event(sf::Event& evt);
+
+        Recorder_Mode m_mode;
+        boost::filesystem::path m_filename;
+        boost::filesystem::ofstream m_output;
+        boost::filesystem::ifstream m_input;
+
+        // last recorded event, written once its dispatched state is known
+        Recorded_Event m_pending_event;
+        bool m_has_pending_event;
+        // next replayed item type if already read
+        uint8_t m_next_item;
+        bool m_has_next_item;
+        // state hash at the end of the replayed recording
+        uint64_t m_recorded_hash;
+
+        // frames recorded or replayed
+        unsigned int m_frame_count;
+        // frame timings in milliseconds
+        uint32_t m_start_ticks;
+        uint32_t m_last_ticks;
+        uint32_t m_frame_ms_min;
+        uint32_t m_frame_ms_max;
+
+        static const char m_magic[6];
+        static const uint8_t m_version;
+    };
+
+    // Input Recorder
+    extern cInput_Recorder* pInput_Recorder;
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
@@ -155,6 +155,24 @@ void cJoystick::Reset_keys(void)
     m_right = false;
     m_up = false;
     m_down = false;
+
+    for (unsigned int i = 0; i < sf::Joystick::ButtonCount; i++) {
+        m_buttons[i] = false;
+    }
+}
+
+void cJoystick::Update_Button_State(const sf::Event& evt)
+{
+    if (evt.joystickButton.joystickId != m_current_joystick || evt.joystickButton.button >= sf::Joystick::ButtonCount) {
+        return;
+    }
+
+    if (evt.type == sf::Event::JoystickButtonPressed) {
+        m_buttons[evt.joystickButton.button] = true;
+    }
+    else if (evt.type == sf::Event::JoystickButtonReleased) {
+        m_buttons[evt.joystickButton.button] = false;
+    }
 }
 
 void cJoystick::Handle_Motion(const sf::Event& evt)
@@ -501,7 +519,7 @@ vector<std::string> cJoystick::Get_Names(void) const
 
 bool cJoystick::Button(unsigned int num)
 {
-    if (pPreferences->m_joy_enabled && sf::Joystick::isButtonPressed(m_current_joystick, num)) {
+    if (pPreferences->m_joy_enabled && num < sf::Joystick::ButtonCount && m_buttons[num]) {
         return 1;
     }
 
@@ -39,6 +39,9 @@ namespace TSC {
         bool m_up;
         bool m_down;
 
+        // pressed buttons of the current joystick
+        bool m_buttons[sf::Joystick::ButtonCount];
+
     public:
         cJoystick(void);
         ~cJoystick(void);
@@ -58,6 +61,11 @@ namespace TSC {
 
         // Handles the Joystick motion
         void Handle_Motion(const sf::Event& evt);
+        /* Update the button states from a button pressed or released event
+         * Like the directions the buttons are only known through events
+         * so recorded input replays the same way.
+        */
+        void Update_Button_State(const sf::Event& evt);
         // Handle Joystick Button down event
         bool Handle_Button_Down_Event(const sf::Event& evt);
         // Handle Joystick Button up event
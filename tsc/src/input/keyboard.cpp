@@ -40,7 +40,7 @@ namespace TSC {
 
 cKeyboard::cKeyboard(void)
 {
-
+    Reset_Keys();
 }
 
 cKeyboard::~cKeyboard(void)
@@ -48,6 +48,27 @@ cKeyboard::~cKeyboard(void)
 
 }
 
+void cKeyboard::Update_Key_State(const sf::Event& evt)
+{
+    if (evt.key.code < 0 || evt.key.code >= sf::Keyboard::KeyCount) {
+        return;
+    }
+
+    if (evt.type == sf::Event::KeyPressed) {
+        m_keys[evt.key.code] = 1;
+    }
+    else if (evt.type == sf::Event::KeyReleased) {
+        m_keys[evt.key.code] = 0;
+    }
+}
+
+void cKeyboard::Reset_Keys(void)
+{
+    for (int i = 0; i < sf::Keyboard::KeyCount; i++) {
+        m_keys[i] = 0;
+    }
+}
+
 bool cKeyboard::CEGUI_Handle_Key_Up(sf::Keyboard::Key key) const
 {
     // inject the scancode directly
@@ -39,9 +39,22 @@ namespace TSC {
             return mrb_obj_value(Data_Wrap_Struct(p_state, mrb_class_get(p_state, "InputClass"), &Scripting::rtTSC_Scriptable, this));
         }
 
+        /* Check if the given key is pressed
+         * Uses the key states from the events instead of polling the
+         * keyboard, so recorded input replays the same way.
+        */
+        inline bool Is_Key_Down(sf::Keyboard::Key key) const
+        {
+            return key >= 0 && key < sf::Keyboard::KeyCount && m_keys[key];
+        }
         // Check the state of the Shift and Ctrl keys.
-        inline bool Is_Shift_Down(){ return sf::Keyboard::isKeyPressed(sf::Keyboard::LShift) || sf::Keyboard::isKeyPressed(sf::Keyboard::RShift); }
-        inline bool Is_Ctrl_Down(){ return sf::Keyboard::isKeyPressed(sf::Keyboard::LControl) || sf::Keyboard::isKeyPressed(sf::Keyboard::RControl); }
+        inline bool Is_Shift_Down() const { return Is_Key_Down(sf::Keyboard::LShift) || Is_Key_Down(sf::Keyboard::RShift); }
+        inline bool Is_Ctrl_Down() const { return Is_Key_Down(sf::Keyboard::LControl) || Is_Key_Down(sf::Keyboard::RControl); }
+
+        // Update the key states from a key pressed or released event
+        void Update_Key_State(const sf::Event& evt);
+        // Set all keys as released
+        void Reset_Keys(void);
 
         /* CEGUI Key Up handler
          * returns true if CEGUI processed the given key up event
@@ -75,6 +88,9 @@ namespace TSC {
 
         // Translate a SFMLKey to the proper CEGUI::Key
         CEGUI::Key::Scan SFMLKey_to_CEGUIKey(const sf::Keyboard::Key key) const;
+    private:
+        // pressed keys
+        bool m_keys[sf::Keyboard::KeyCount];
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
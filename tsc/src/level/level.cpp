@@ -20,10 +20,13 @@
 #include "../level/level_editor.hpp"
 #include "level_loader.hpp"
 #include "../core/game_core.hpp"
+#include "../core/xml_stream_writer.hpp"
+#include "../core/filesystem/async_file_writer.hpp"
 #include "../gui/menu.hpp"
 #include "../gui/game_console.hpp"
 #include "../gui/debug_window.hpp"
 #include "../user/preferences.hpp"
+#include "../video/img_manager.hpp"
 #include "../audio/audio.hpp"
 #include "../level/level_player.hpp"
 #include "../objects/goldpiece.hpp"
@@ -102,6 +105,7 @@ cLevel::cLevel(void)
     Reset_Settings();
 
     m_delayed_unload = 0;
+    m_save_job = 0;
     m_cheat_counter = 0.0f;
 
     m_mruby = NULL; // Initialized in Init()
@@ -209,22 +213,29 @@ cLevel* cLevel::Load_From_File(fs::path filename)
         throw (InvalidLevelError(msg));
     }
 
-    // This is our loader
-    cLevelLoader loader;
-
     // supported level format
-    if (filename.extension() == fs::path(".tsclvl")  || filename.extension() == fs::path(".smclvl")) {
-        loader.parse_file(filename);
-    }
-    else { // old, unsupported level format
+    if (filename.extension() != fs::path(".tsclvl") && filename.extension() != fs::path(".smclvl")) { // old, unsupported level format
         gp_hud->Set_Text(_("Unsupported Level format : ") + (const std::string)path_to_utf8(filename));
         return NULL;
     }
 
+    cLevel_File_Data data;
+    cLevelLoader reader;
+    reader.Read_File(filename, data);
+
+    return Load_From_Data(data);
+}
+
+cLevel* cLevel::Load_From_Data(const cLevel_File_Data& data)
+{
+    // This is our loader
+    cLevelLoader loader;
+    loader.Build_Level(data);
+
     // Our level
     cLevel* p_level = loader.Get_Level();
 
-    // FIXME: Move this into cLevelLoader::on_end_document()
+    // FIXME: Move this into cLevelLoader::Build_Level()
     /* late initialization
      * needed to create links to other objects
     */
@@ -249,6 +260,14 @@ void cLevel::Unload(bool delayed /* = 0 */)
         m_delayed_unload = 0;
     }
 
+    // the file must be complete before it can be loaded again
+    if (m_save_job) {
+        pAsync_File_Writer->Wait();
+        Update_Save();
+    }
+
+    Unpin_Textures();
+
     // not loaded
     if (!Is_Loaded()) {
         return;
@@ -292,57 +311,54 @@ void cLevel::Unload(bool delayed /* = 0 */)
     m_sprite_manager->Delete_All();
 }
 
-fs::path cLevel::Save_To_File(fs::path filename /* = fs::path() */)
+void cLevel::Save_To_Stream(std::ostream& stream)
 {
-    xmlpp::Document doc;
-    xmlpp::Element* p_root = doc.create_root_node("level");
-    xmlpp::Element* p_node = NULL;
+    cXml_Stream_Writer writer(stream);
+    writer.Start_Element("level");
 
     // <information>
-#ifdef USE_LIBXMLPP3
-    p_node = p_root->add_child_element("information");
-#else
-    p_node = p_root->add_child("information");
-#endif
-    Add_Property(p_node, "game_version", int_to_string(TSC_VERSION_MAJOR) + "." + int_to_string(TSC_VERSION_MINOR) + "." + int_to_string(TSC_VERSION_PATCH));
-    Add_Property(p_node, "engine_version", level_engine_version);
-    Add_Property(p_node, "save_time", static_cast<uint64_t>(time(NULL)));
+    writer.Start_Element("information");
+    writer.Add_Property("game_version", int_to_string(TSC_VERSION_MAJOR) + "." + int_to_string(TSC_VERSION_MINOR) + "." + int_to_string(TSC_VERSION_PATCH));
+    writer.Add_Property("engine_version", level_engine_version);
+    writer.Add_Property("save_time", static_cast<uint64_t>(time(NULL)));
+    writer.End_Element();
     // </information>
 
     // <settings>
-#ifdef USE_LIBXMLPP3
-    p_node = p_root->add_child_element("settings");
-#else
-    p_node = p_root->add_child("settings");
-#endif
-    Add_Property(p_node, "lvl_author", m_author);
-    Add_Property(p_node, "lvl_version", m_version);
-    Add_Property(p_node, "lvl_music", Get_Music_Filename().generic_string());
-    Add_Property(p_node, "lvl_description", m_description);
-    Add_Property(p_node, "lvl_difficulty", static_cast<int>(m_difficulty));
-    Add_Property(p_node, "lvl_land_type", Get_Level_Land_Type_Name(m_land_type));
-    Add_Property(p_node, "cam_limit_x", static_cast<int>(m_camera_limits.m_x));
-    Add_Property(p_node, "cam_limit_y", static_cast<int>(m_camera_limits.m_y));
-    Add_Property(p_node, "cam_limit_w", static_cast<int>(m_camera_limits.m_w));
-    Add_Property(p_node, "cam_limit_h", static_cast<int>(m_camera_limits.m_h));
-    Add_Property(p_node, "cam_fixed_hor_vel", m_fixed_camera_hor_vel);
-    Add_Property(p_node, "unload_after_exit", m_unload_after_exit ? 1 : 0);
+    writer.Start_Element("settings");
+    writer.Add_Property("lvl_author", m_author);
+    writer.Add_Property("lvl_version", m_version);
+    writer.Add_Property("lvl_music", Get_Music_Filename().generic_string());
+    writer.Add_Property("lvl_description", m_description);
+    writer.Add_Property("lvl_difficulty", static_cast<int>(m_difficulty));
+    writer.Add_Property("lvl_land_type", Get_Level_Land_Type_Name(m_land_type));
+    writer.Add_Property("cam_limit_x", static_cast<int>(m_camera_limits.m_x));
+    writer.Add_Property("cam_limit_y", static_cast<int>(m_camera_limits.m_y));
+    writer.Add_Property("cam_limit_w", static_cast<int>(m_camera_limits.m_w));
+    writer.Add_Property("cam_limit_h", static_cast<int>(m_camera_limits.m_h));
+    writer.Add_Property("cam_fixed_hor_vel", m_fixed_camera_hor_vel);
+    writer.Add_Property("unload_after_exit", m_unload_after_exit ? 1 : 0);
+    writer.End_Element();
     // </settings>
 
+    /* objects only know how to save themselves to libxml++ nodes,
+     * each of them is written and removed again right away */
+    xmlpp::Document temp_doc;
+    xmlpp::Element* p_temp_root = temp_doc.create_root_node("level");
+
     // backgrounds
     vector<cBackground*>::iterator iter;
-    for (iter=m_background_manager->objects.begin(); iter != m_background_manager->objects.end(); iter++)
-        (*iter)->Save_To_XML_Node(p_root);
+    for (iter=m_background_manager->objects.begin(); iter != m_background_manager->objects.end(); iter++) {
+        (*iter)->Save_To_XML_Node(p_temp_root);
+        writer.Add_Child_Nodes(p_temp_root);
+    }
 
     // <player>
-#ifdef USE_LIBXMLPP3
-    p_node = p_root->add_child_element("player");
-#else
-    p_node = p_root->add_child("player");
-#endif
-    Add_Property(p_node, "posx", static_cast<int>(pLevel_Player->m_start_pos_x));
-    Add_Property(p_node, "posy", static_cast<int>(pLevel_Player->m_start_pos_y));
-    Add_Property(p_node, "direction", Get_Direction_Name(pLevel_Player->m_start_direction));
+    writer.Start_Element("player");
+    writer.Add_Property("posx", static_cast<int>(pLevel_Player->m_start_pos_x));
+    writer.Add_Property("posy", static_cast<int>(pLevel_Player->m_start_pos_y));
+    writer.Add_Property("direction", Get_Direction_Name(pLevel_Player->m_start_direction));
+    writer.End_Element();
     // </player>
 
     cSprite_List::iterator iter2;
@@ -354,27 +370,44 @@ fs::path cLevel::Save_To_File(fs::path filename /* = fs::path() */)
             continue;
 
         // save to XML node
-        p_obj->Save_To_XML_Node(p_root);
+        p_obj->Save_To_XML_Node(p_temp_root);
+        writer.Add_Child_Nodes(p_temp_root);
     }
 
     // MRuby script code
     // <script>
-#ifdef USE_LIBXMLPP3
-    p_node = p_root->add_child_element("script");
-    p_node->add_child_text(m_script);
-#else
-    p_node = p_root->add_child("script");
-    p_node->add_child_text(m_script);
-#endif
+    writer.Start_Element("script");
+    writer.Add_Text(m_script);
+    writer.End_Element();
     // </script>
 
+    writer.End_Element();
+}
+
+fs::path cLevel::Save_To_File(fs::path filename /* = fs::path() */)
+{
+    std::ostringstream stream;
+    Save_To_Stream(stream);
+
     // Write to file (raises xmlpp::exception on write error)
-    doc.write_to_file_formatted(Glib::filename_from_utf8(path_to_utf8(filename)));
+    std::string error;
+    if (!cAsync_File_Writer::Write_File(filename, stream.str(), error)) {
+        throw xmlpp::exception(error);
+    }
+
     debug_print("Wrote level file '%s'.\n", path_to_utf8(filename).c_str());
 
     return filename;
 }
 
+unsigned int cLevel::Save_To_File_Async(const fs::path& filename)
+{
+    std::ostringstream stream;
+    Save_To_Stream(stream);
+
+    return pAsync_File_Writer->Write(filename, stream.str());
+}
+
 // TODO: Merge Save() with Save_To_File() after ENABLE_NEW_LOADER
 // is the only variant?
 void cLevel::Save(void)
@@ -393,11 +426,33 @@ void cLevel::Save(void)
     fs::path tsc_level_filename = m_level_filename;
     tsc_level_filename.replace_extension(".tsclvl");
 
-    try {
-        Save_To_File(tsc_level_filename);
+    // finish a previous save first
+    if (m_save_job) {
+        pAsync_File_Writer->Wait();
+        Update_Save();
     }
-    catch (xmlpp::exception& e) {
-        cerr << "Error: Couldn't save level file: " << e.what() << endl;
+
+    m_save_job = Save_To_File_Async(tsc_level_filename);
+    gp_hud->Set_Text(_("Saving level ") + path_to_utf8(Trim_Filename(m_level_filename, false, false)));
+}
+
+void cLevel::Update_Save(void)
+{
+    if (!m_save_job) {
+        return;
+    }
+
+    bool success;
+    std::string error;
+
+    if (!pAsync_File_Writer->Get_Result(m_save_job, success, error)) {
+        return;
+    }
+
+    m_save_job = 0;
+
+    if (!success) {
+        cerr << "Error: Couldn't save level file: " << error << endl;
         cerr << "Is the file read-only?" << endl;
         gp_hud->Set_Text(_("Couldn't save level ") + path_to_utf8(m_level_filename));
 
@@ -405,6 +460,10 @@ void cLevel::Save(void)
         return;
     }
 
+    fs::path tsc_level_filename = m_level_filename;
+    tsc_level_filename.replace_extension(".tsclvl");
+    debug_print("Wrote level file '%s'.\n", path_to_utf8(tsc_level_filename).c_str());
+
     //If the file originally had .smclvl for the extension and if the .tsclvl save was successful, remove the old
     //.smclvl file.
     if (m_level_filename.extension().string() == ".smclvl") {
@@ -470,13 +529,12 @@ void cLevel::Init(void)
     pLevel_Player->Reset(false);
 
     // pre-update animations
-    for (cSprite_List::iterator itr = m_sprite_manager->objects.begin(); itr != m_sprite_manager->objects.end(); ++itr) {
-        cSprite* obj = (*itr);
+    cSprite_List emitters;
+    m_sprite_manager->Get_Objects_by_Type(TYPE_PARTICLE_EMITTER, emitters);
 
-        if (obj->m_type == TYPE_PARTICLE_EMITTER) {
-            cParticle_Emitter* emitter = static_cast<cParticle_Emitter*>(obj);
-            emitter->Pre_Update();
-        }
+    for (cSprite_List::iterator itr = emitters.begin(); itr != emitters.end(); ++itr) {
+        cParticle_Emitter* emitter = static_cast<cParticle_Emitter*>(*itr);
+        emitter->Pre_Update();
     }
 
     /* For unknown reasons, Init() is public. And for even more
@@ -490,6 +548,54 @@ void cLevel::Init(void)
         Reinitialize_MRuby_Interpreter();
         m_mruby_has_been_initialized = true;
     }
+
+    // Init() may be called again
+    Unpin_Textures();
+    Pin_Textures();
+
+    // merge static terrain, after the scripts registered their event handlers
+    if (!editor_level_enabled) {
+        m_sprite_manager->Build_Static_Data(m_script);
+    }
+}
+
+void cLevel::Pin_Textures(void)
+{
+    for (cSprite_List::iterator itr = m_sprite_manager->objects.begin(); itr != m_sprite_manager->objects.end(); ++itr) {
+        cSprite* obj = (*itr);
+
+        if (obj->m_start_image) {
+            m_pinned_textures.push_back(obj->m_start_image);
+        }
+        if (obj->m_image && obj->m_image != obj->m_start_image) {
+            m_pinned_textures.push_back(obj->m_image);
+        }
+
+        for (cImageSet::Surface_List::iterator image_itr = obj->m_images.begin(); image_itr != obj->m_images.end(); ++image_itr) {
+            if (image_itr->m_image) {
+                m_pinned_textures.push_back(image_itr->m_image);
+            }
+        }
+    }
+
+    for (vector<cBackground*>::iterator itr = m_background_manager->objects.begin(); itr != m_background_manager->objects.end(); ++itr) {
+        if ((*itr)->m_image_1) {
+            m_pinned_textures.push_back((*itr)->m_image_1);
+        }
+    }
+
+    for (vector<cGL_Surface*>::iterator itr = m_pinned_textures.begin(); itr != m_pinned_textures.end(); ++itr) {
+        pImage_Manager->Pin(*itr);
+    }
+}
+
+void cLevel::Unpin_Textures(void)
+{
+    for (vector<cGL_Surface*>::iterator itr = m_pinned_textures.begin(); itr != m_pinned_textures.end(); ++itr) {
+        pImage_Manager->Unpin(*itr);
+    }
+
+    m_pinned_textures.clear();
 }
 
 std::string cLevel::Get_Level_Name()
@@ -601,6 +707,8 @@ void cLevel::Leave(const GameMode next_mode /* = MODE_NOTHING */)
 
 void cLevel::Update(void)
 {
+    Update_Save();
+
     if (m_delayed_unload) {
         Unload();
         return;
@@ -632,12 +740,11 @@ void cLevel::Update(void)
     // if level-editor enabled
     else {
         // only update particle emitters
-        for (cSprite_List::iterator itr = m_sprite_manager->objects.begin(); itr != m_sprite_manager->objects.end(); ++itr) {
-            cSprite* obj = (*itr);
+        cSprite_List emitters;
+        m_sprite_manager->Get_Objects_by_Type(TYPE_PARTICLE_EMITTER, emitters);
 
-            if (obj->m_type == TYPE_PARTICLE_EMITTER) {
-                obj->Update();
-            }
+        for (cSprite_List::iterator itr = emitters.begin(); itr != emitters.end(); ++itr) {
+            (*itr)->Update();
         }
     }
 }
@@ -669,6 +776,11 @@ void cLevel::Draw_Layer_1(LevelDrawType type /* = LVL_DRAW */)
     m_sprite_manager->Draw_Items();
     // Animations
     m_animation_manager->Draw();
+
+    // merged static collision shapes
+    if (game_debug) {
+        m_sprite_manager->m_static_collision.Draw_Debug();
+    }
 }
 
 void cLevel::Draw_Layer_2(LevelDrawType type /* = LVL_DRAW */)
@@ -710,7 +822,7 @@ void cLevel::Draw_Layer_2(LevelDrawType type /* = LVL_DRAW */)
 void cLevel::Process_Input(void)
 {
     // Omega Mode
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::O) && sf::Keyboard::isKeyPressed(sf::Keyboard::M) && !editor_enabled) {
+    if (pKeyboard->Is_Key_Down(sf::Keyboard::O) && pKeyboard->Is_Key_Down(sf::Keyboard::M) && !editor_enabled) {
         if (m_cheat_counter > 50.0f) {
             if (pLevel_Player->m_omega_mode) {
                 gp_hud->Set_Text(_("Omega Mode disabled"));
@@ -727,7 +839,7 @@ void cLevel::Process_Input(void)
         }
     }
     // Set Small state
-    else if (sf::Keyboard::isKeyPressed(sf::Keyboard::K) && sf::Keyboard::isKeyPressed(sf::Keyboard::I) && sf::Keyboard::isKeyPressed(sf::Keyboard::D) && !editor_enabled) {
+    else if (pKeyboard->Is_Key_Down(sf::Keyboard::K) && pKeyboard->Is_Key_Down(sf::Keyboard::I) && pKeyboard->Is_Key_Down(sf::Keyboard::D) && !editor_enabled) {
         gp_hud->Set_Text(_("Kid cheat activated"));
         pLevel_Player->Set_Type(ALEX_SMALL, 0);
     }
@@ -1096,9 +1208,8 @@ bool cLevel::Is_Loaded(void) const
  * \remark The `exit_count` value is probably useless until
  * multiple exits (ticket #19) are implemented.
  *
- * \remark This method iterates the entire list of objects
- * in the level and is thus rather expensive to call
- * performance-wise.
+ * \remark This method only looks at the secret areas and level
+ * exits registered in the sprite manager.
  */
 void cLevel::Count_Secrets(int& area_count, int& exit_count)
 {
@@ -1109,24 +1220,21 @@ void cLevel::Count_Secrets(int& area_count, int& exit_count)
 
     // Gather a list of all secret areas and all level exits
     cSprite_List::iterator iter;
-    for(iter=m_sprite_manager->objects.begin(); iter != m_sprite_manager->objects.end(); iter++) {
-        cSprite* obj = *iter;
-
-        // skip destroyed objects
-        if (obj->m_auto_destroy)
-            continue;
+    m_sprite_manager->Get_Objects_by_Type(TYPE_SECRET_AREA, secret_areas);
+    m_sprite_manager->Get_Objects_by_Type(TYPE_LEVEL_EXIT, possible_exits);
 
-        switch(obj->m_type) {
-        case TYPE_SECRET_AREA:
-            secret_areas.push_back(obj);
-            break;
-        case TYPE_LEVEL_EXIT:
-            possible_exits.push_back(obj);
-            break;
-        default:
-            // ignore
-            break;
-        }
+    // skip destroyed objects
+    for(iter=secret_areas.begin(); iter != secret_areas.end();) {
+        if ((*iter)->m_auto_destroy)
+            iter = secret_areas.erase(iter);
+        else
+            ++iter;
+    }
+    for(iter=possible_exits.begin(); iter != possible_exits.end();) {
+        if ((*iter)->m_auto_destroy)
+            iter = possible_exits.erase(iter);
+        else
+            ++iter;
     }
 
     // Part of the result already found
@@ -28,6 +28,8 @@
 
 namespace TSC {
 
+    class cLevel_File_Data;
+
     /* *** *** *** *** *** cLevel *** *** *** *** *** *** *** *** *** *** *** *** */
 
     class cLevel {
@@ -35,6 +37,8 @@ namespace TSC {
 
         /// Loads a level from the given file.
         static cLevel* Load_From_File(boost::filesystem::path filename);
+        /// Creates a level from an already read level file.
+        static cLevel* Load_From_Data(const cLevel_File_Data& data);
 
         cLevel(void);
         virtual ~cLevel(void);
@@ -53,9 +57,18 @@ namespace TSC {
         // Save the level to a file as XML.
         // Raises xmlpp::exception on failure to write the XML file.
         boost::filesystem::path Save_To_File(boost::filesystem::path filename = boost::filesystem::path());
+        /* Save the level to a file as XML on the async file writer
+         * The level is serialized before this returns.
+         * Returns the job id of pAsync_File_Writer
+        */
+        unsigned int Save_To_File_Async(const boost::filesystem::path& filename);
+        // Write the level XML to the given stream
+        void Save_To_Stream(std::ostream& stream);
 
-        // Save the Level
+        // Save the Level in the background
         void Save(void);
+        // Finish a background save if it is written
+        void Update_Save(void);
         // Delete and unload
         void Delete(void);
         // Reset settings data
@@ -153,6 +166,11 @@ namespace TSC {
         /// Convenience method for calling Pause_All_Timers(false).
         void Continue_All_Timers();
 
+        // Pin the textures of all level sprites and backgrounds so they are never evicted
+        void Pin_Textures(void);
+        // Release the pinned textures
+        void Unpin_Textures(void);
+
         static bool Is_Level_Object_Element(const CEGUI::String& element)
         {
             if (element == "information" || element == "settings" || element == "background" || element == "music" ||
@@ -176,6 +194,8 @@ namespace TSC {
 
         // unload the level on the next update
         bool m_delayed_unload;
+        // background save job or 0
+        unsigned int m_save_job;
 
         // background manager
         cBackground_Manager* m_background_manager;
@@ -187,6 +207,8 @@ namespace TSC {
         Scripting::cMRuby_Interpreter* m_mruby;
         // Do not re-Init() on sublevel loading.
         bool m_mruby_has_been_initialized;
+        // textures kept in video memory while the level is loaded
+        std::vector<cGL_Surface*> m_pinned_textures;
 
         /* *** *** *** Settings *** *** *** *** */
 
@@ -18,6 +18,7 @@
 #include "../user/preferences.hpp"
 #include "../core/game_core.hpp"
 #include "../video/gl_surface.hpp"
+#include "../video/renderer.hpp"
 #include "../core/framerate.hpp"
 #include "../core/filesystem/resource_manager.hpp"
 #include "../core/filesystem/relative.hpp"
@@ -280,6 +281,38 @@ void cBackground::Draw(void)
             posy_final += game_res_h - m_image_1->m_h;
         }
 
+        // draw all tiles as one quad with a repeated texture
+        if (m_image_1->Is_Repeatable()) {
+            cRepeat_Surface_Request* request = new cRepeat_Surface_Request();
+            request->m_texture_id = m_image_1->Get_Texture();
+            // the wrap mode is only set once for the texture
+            request->m_set_repeat = m_image_1->m_repeat_texture != request->m_texture_id;
+            m_image_1->m_repeat_texture = request->m_texture_id;
+            request->m_pos_z = m_pos_z;
+
+            // fill the width
+            request->m_rect.m_x = 0.0f;
+            request->m_rect.m_w = static_cast<float>(game_res_w);
+            request->m_tex_x = fmod(-posx_final, m_image_1->m_w) / m_image_1->m_w;
+            request->m_tex_w = request->m_rect.m_w / m_image_1->m_w;
+
+            // fill the height
+            if (m_type == BG_IMG_ALL) {
+                request->m_rect.m_y = 0.0f;
+                request->m_rect.m_h = static_cast<float>(game_res_h);
+                request->m_tex_y = fmod(-posy_final, m_image_1->m_h) / m_image_1->m_h;
+                request->m_tex_h = request->m_rect.m_h / m_image_1->m_h;
+            }
+            // a single row
+            else {
+                request->m_rect.m_y = posy_final;
+                request->m_rect.m_h = m_image_1->m_h;
+            }
+
+            pRenderer->Add(request);
+            return;
+        }
+
         // align start position x
         // to left
         while (posx_final > 0.0f) {
@@ -77,6 +77,9 @@ void cEditor_Level::Enable(cSprite_Manager* p_sprite_manager)
     if (m_enabled)
         return;
 
+    // sprites get moved and edited freely
+    p_sprite_manager->Clear_Static_Data();
+
     cEditor::Enable(p_sprite_manager);
     mp_level->Pause_All_Timers();
     m_focused_exit = 0;
@@ -91,6 +94,8 @@ void cEditor_Level::Disable(void)
     cEditor::Disable();
     mp_level->Continue_All_Timers();
     editor_level_enabled = false;
+
+    mp_level->m_sprite_manager->Build_Static_Data(mp_level->m_script);
 }
 
 bool cEditor_Level::Key_Down(const sf::Event& evt)
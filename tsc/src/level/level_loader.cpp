@@ -60,9 +60,35 @@ using namespace TSC;
 
 using namespace std;
 
+/* *** *** *** *** *** *** *** cLevel_File_Data *** *** *** *** *** *** *** *** *** *** */
+
+cLevel_File_Data::cLevel_File_Data(void)
+{
+    m_write_time = 0;
+}
+
+size_t cLevel_File_Data::Get_Memory_Size(void) const
+{
+    size_t size = sizeof(cLevel_File_Data) + m_script.capacity();
+
+    for (std::vector<cLevel_File_Element>::const_iterator itr = m_elements.begin(); itr != m_elements.end(); ++itr) {
+        size += sizeof(cLevel_File_Element) + itr->m_name.capacity();
+
+        for (XmlAttributes::const_iterator prop_itr = itr->m_properties.begin(); prop_itr != itr->m_properties.end(); ++prop_itr) {
+            // map node overhead
+            size += 48 + prop_itr->first.capacity() + prop_itr->second.capacity();
+        }
+    }
+
+    return size;
+}
+
+/* *** *** *** *** *** *** *** cLevelLoader *** *** *** *** *** *** *** *** *** *** */
+
 cLevelLoader::cLevelLoader()
     : xmlpp::SaxParser()
 {
+    mp_data     = NULL;
     mp_level    = NULL;
     m_in_script_tag = false;
 }
@@ -72,6 +98,7 @@ cLevelLoader::~cLevelLoader()
     // Do not delete the cLevel instance — it is used by the
     // caller and deleted by him.
     mp_level = NULL;
+    mp_data = NULL;
 }
 
 cLevel* cLevelLoader::Get_Level()
@@ -79,34 +106,65 @@ cLevel* cLevelLoader::Get_Level()
     return mp_level;
 }
 
-/***************************************
- * SAX parser callbacks
- ***************************************/
-
 void cLevelLoader::parse_file(boost::filesystem::path filename)
 {
-    m_levelfile = filename;
-    xmlpp::SaxParser::parse_file(path_to_utf8(filename));
+    cLevel_File_Data data;
+    Read_File(filename, data);
+    Build_Level(data);
 }
 
-void cLevelLoader::on_start_document()
+void cLevelLoader::Read_File(boost::filesystem::path filename, cLevel_File_Data& data)
+{
+    data.m_filename = filename;
+    data.m_write_time = fs::last_write_time(filename);
+    data.m_elements.clear();
+    data.m_script.clear();
+
+    mp_data = &data;
+
+    try {
+        xmlpp::SaxParser::parse_file(path_to_utf8(filename));
+    }
+    catch (...) {
+        mp_data = NULL;
+        throw;
+    }
+
+    mp_data = NULL;
+}
+
+void cLevelLoader::Build_Level(const cLevel_File_Data& data)
 {
     if (mp_level)
         throw("Restarted XML parser after already starting it."); // FIXME: proper exception
 
     mp_level = new cLevel();
-    m_in_script_tag = false;
-}
 
-void cLevelLoader::on_end_document()
-{
-    mp_level->m_level_filename = m_levelfile;
+    for (std::vector<cLevel_File_Element>::const_iterator itr = data.m_elements.begin(); itr != data.m_elements.end(); ++itr) {
+        m_current_properties = itr->m_properties;
+        Parse_Element(itr->m_name);
+    }
+
+    m_current_properties.clear();
+
+    mp_level->m_script = data.m_script;
+    mp_level->m_level_filename = data.m_filename;
 
     // engine version entry not set
     if (mp_level->m_engine_version < 0)
         mp_level->m_engine_version = 0;
 }
 
+/***************************************
+ * SAX parser callbacks
+ ***************************************/
+
+void cLevelLoader::on_start_document()
+{
+    m_in_script_tag = false;
+    m_current_properties.clear();
+}
+
 void cLevelLoader::on_start_element(const Glib::ustring& name, const xmlpp::SaxParser::AttributeList& properties)
 {
     if (name == "property" || name == "Property") {
@@ -143,24 +201,18 @@ void cLevelLoader::on_end_element(const Glib::ustring& name)
     if (name == "property" || name == "Property")
         return;
 
-    // Now for the real, cumbersome parsing process
-    if (name == "information")
-        Parse_Tag_Information();
-    else if (name == "settings")
-        Parse_Tag_Settings();
-    else if (name == "background")
-        Parse_Tag_Background();
-    else if (name == "player")
-        Parse_Tag_Player();
-    else if (cLevel::Is_Level_Object_Element(std::string(name))) // CEGUI doesn’t like Glib::ustring
-        Parse_Level_Object_Tag(name);
-    else if (name == "level") {
-        /* Ignore the root <level> tag */
-    }
-    else if (name == "script")
+    if (name == "script") {
         m_in_script_tag = false; // Indicate the <script> tag has ended
-    else
-        cerr << "Warning: Unknown XML tag '" << name << "'on level parsing." << endl;
+    }
+    // The root <level> tag has no properties
+    else if (name != "level") {
+        /* Only remember the element, it is parsed in Build_Level()
+         * which may happen later on the main thread */
+        mp_data->m_elements.push_back(cLevel_File_Element());
+        cLevel_File_Element& element = mp_data->m_elements.back();
+        element.m_name = name;
+        element.m_properties.swap(m_current_properties);
+    }
 
     // Everything handled, so we can now safely clear the
     // collected <property> element values for the next
@@ -174,13 +226,30 @@ void cLevelLoader::on_characters(const Glib::ustring& text)
      * text (may be called multiple times for each token,
      * so append rather then set directly). */
     if (m_in_script_tag)
-        mp_level->m_script.append(text);
+        mp_data->m_script.append(text);
 }
 
 /***************************************
  * Parsers for mayor XML tags
  ***************************************/
 
+void cLevelLoader::Parse_Element(const std::string& name)
+{
+    // Now for the real, cumbersome parsing process
+    if (name == "information")
+        Parse_Tag_Information();
+    else if (name == "settings")
+        Parse_Tag_Settings();
+    else if (name == "background")
+        Parse_Tag_Background();
+    else if (name == "player")
+        Parse_Tag_Player();
+    else if (cLevel::Is_Level_Object_Element(name)) // CEGUI doesn’t like Glib::ustring
+        Parse_Level_Object_Tag(name);
+    else
+        cerr << "Warning: Unknown XML tag '" << name << "'on level parsing." << endl;
+}
+
 void cLevelLoader::Parse_Tag_Information()
 {
     // Support V1.7 and lower which used float
@@ -21,6 +21,38 @@
 
 namespace TSC {
 
+    /**
+     * One major element of a level file (like <settings> or <sprite>)
+     * with the values of its <property> children.
+     */
+    struct cLevel_File_Element {
+        std::string m_name;
+        XmlAttributes m_properties;
+    };
+
+    /**
+     * The contents of a level file as plain data. Reading a file into
+     * this does not touch OpenGL, mruby or any global manager and can
+     * therefore happen on another thread. cLevelLoader::Build_Level()
+     * creates the actual cLevel from it on the main thread.
+     */
+    class cLevel_File_Data {
+    public:
+        cLevel_File_Data(void);
+
+        // Returns the approximate memory usage in bytes
+        size_t Get_Memory_Size(void) const;
+
+        // the file that was read
+        boost::filesystem::path m_filename;
+        // modification time of the file when it was read
+        std::time_t m_write_time;
+        // major elements in file order
+        std::vector<cLevel_File_Element> m_elements;
+        // content of the <script> tag
+        std::string m_script;
+    };
+
     /**
      * This class is used to construct a level from a given XML file.
      * While technically all its code could be included in cLevel directly,
@@ -56,13 +88,19 @@ namespace TSC {
         // parse_file() that accepts a Glib::ustring — this function sets
         // some internal members.
         virtual void parse_file(boost::filesystem::path filename);
+
+        // Only read the given file into `data'. This may be called
+        // from any thread, see cLevel_File_Data.
+        void Read_File(boost::filesystem::path filename, cLevel_File_Data& data);
+        // Create the level from data read with Read_File(). Must
+        // be called on the main thread.
+        void Build_Level(const cLevel_File_Data& data);
         // After finishing parsing, contains a pointer to a cLevel instance.
         // This pointer must be freed by you. Returns NULL before parsing.
         cLevel* Get_Level();
 
     protected: // SAX parser callbacks
         virtual void on_start_document();
-        virtual void on_end_document();
         virtual void on_start_element(const Glib::ustring& name, const xmlpp::SaxParser::AttributeList& properties);
         virtual void on_end_element(const Glib::ustring& name);
         virtual void on_characters(const Glib::ustring& text);
@@ -91,11 +129,13 @@ namespace TSC {
         void Parse_Tag_Background();
         void Parse_Tag_Player();
         void Parse_Level_Object_Tag(const std::string& name);
+        // Calls the parser for the given major element
+        void Parse_Element(const std::string& name);
 
+        // The file contents we’re reading
+        cLevel_File_Data* mp_data;
         // The cLevel instance we’re building
         cLevel* mp_level;
-        // The file we’re parsing
-        boost::filesystem::path m_levelfile;
         // The <property> results we found before the current tag. The
         // value of the `name' attribute is mapped to the value of the
         // `value' attribute. on_end_element() must clear this at its end.
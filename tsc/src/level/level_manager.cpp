@@ -15,6 +15,7 @@
 */
 
 #include "../level/level_manager.hpp"
+#include "../level/level_prefetcher.hpp"
 #include "../core/main.hpp"
 #include "../core/game_core.hpp"
 #include "../core/filesystem/filesystem.hpp"
@@ -23,6 +24,8 @@
 #include "../overworld/overworld.hpp"
 #include "../core/framerate.hpp"
 #include "../objects/path.hpp"
+#include "../objects/level_exit.hpp"
+#include "../overworld/world_player.hpp"
 #include "../audio/audio.hpp"
 #include "level_settings.hpp"
 #include "../level/level_editor.hpp"
@@ -31,6 +34,8 @@
 #include "../core/global_basic.hpp"
 #include "../gui/hud.hpp"
 #include "../gui/game_console.hpp"
+#include "../video/renderer.hpp"
+#include "../core/camera.hpp"
 
 using namespace std;
 
@@ -44,6 +49,8 @@ cLevel_Manager::cLevel_Manager(void)
     : cObject_Manager<cLevel>()
 {
     m_camera = new cCamera(NULL);
+    m_prefetcher = new cLevel_Prefetcher();
+    m_prefetch_counter = 0.0f;
 
     // set the first camera available
     if (pActive_Camera == NULL) {
@@ -61,6 +68,7 @@ cLevel_Manager::~cLevel_Manager(void)
 {
     Delete_All();
     delete m_camera;
+    delete m_prefetcher;
 }
 
 void cLevel_Manager::Init(void)
@@ -72,6 +80,8 @@ void cLevel_Manager::Unload(void)
 {
     // disable fixed camera velocity
     pLevel_Manager->m_camera->m_fixed_hor_vel = 0.0f;
+    // drop prefetched levels
+    m_prefetcher->Clear();
 
     // always keep one level
     if (size() > 1) {
@@ -130,9 +140,19 @@ cLevel* cLevel_Manager::Load(std::string levelname , bool loading_sublevel /* =
         return level;
     }
 
-    // load
     fs::path filename = Get_Path(levelname);
-    level = cLevel::Load_From_File(filename);
+
+    // already read in the background
+    cLevel_File_Data* data = m_prefetcher->Take(filename);
+
+    if (data) {
+        level = cLevel::Load_From_Data(*data);
+        delete data;
+    }
+    // load
+    else {
+        level = cLevel::Load_From_File(filename);
+    }
 
     Add(level);
     return level;
@@ -229,6 +249,10 @@ fs::path cLevel_Manager::Get_Path(const std::string& levelname, bool check_only_
 
 void cLevel_Manager::Update(void)
 {
+    // positions before this step for drawing
+    pActive_Level->m_sprite_manager->Save_Positions(1);
+    pActive_Camera->Save_Position();
+
     // input
     pActive_Level->Process_Input();
 
@@ -281,10 +305,97 @@ void cLevel_Manager::Update(void)
 
     // update performance timer
     pFramerate->m_perf_timer[PERF_UPDATE_CAMERA]->Update();
+
+    Update_Prefetch();
+}
+
+void cLevel_Manager::Update_Prefetch(void)
+{
+    m_prefetch_counter -= pFramerate->m_speed_factor;
+
+    if (m_prefetch_counter > 0.0f) {
+        return;
+    }
+
+    // about every half second
+    m_prefetch_counter = speedfactor_fps * 0.5f;
+
+    // nothing is entered in the editors
+    if (editor_enabled) {
+        m_prefetcher->Set_Wanted(std::vector<fs::path>());
+        return;
+    }
+
+    std::vector<std::string> levelnames;
+
+    // sublevels behind nearby level exits
+    if (Game_Mode == MODE_LEVEL) {
+        const float max_distance = static_cast<float>(game_res_w) * 1.5f;
+        const float player_x = pLevel_Player->m_col_rect.m_x + (pLevel_Player->m_col_rect.m_w * 0.5f);
+        const float player_y = pLevel_Player->m_col_rect.m_y + (pLevel_Player->m_col_rect.m_h * 0.5f);
+
+        cSprite_List exits;
+        pActive_Level->m_sprite_manager->Get_Objects_by_Type(TYPE_LEVEL_EXIT, exits);
+
+        for (cSprite_List::iterator itr = exits.begin(); itr != exits.end(); ++itr) {
+            cLevel_Exit* level_exit = static_cast<cLevel_Exit*>(*itr);
+
+            if (level_exit->m_dest_level.empty()) {
+                continue;
+            }
+
+            const float exit_x = level_exit->m_col_rect.m_x + (level_exit->m_col_rect.m_w * 0.5f);
+            const float exit_y = level_exit->m_col_rect.m_y + (level_exit->m_col_rect.m_h * 0.5f);
+
+            if (fabs(exit_x - player_x) > max_distance || fabs(exit_y - player_y) > max_distance) {
+                continue;
+            }
+
+            levelnames.push_back(level_exit->m_dest_level);
+        }
+    }
+    // level of the current waypoint
+    else if (Game_Mode == MODE_OVERWORLD) {
+        cWaypoint* waypoint = pOverworld_Player->Get_Waypoint();
+
+        if (waypoint && waypoint->m_waypoint_type == WAYPOINT_NORMAL && !waypoint->Get_Destination().empty()) {
+            levelnames.push_back(waypoint->Get_Destination());
+        }
+    }
+
+    std::vector<fs::path> filenames;
+
+    for (std::vector<std::string>::iterator itr = levelnames.begin(); itr != levelnames.end(); ++itr) {
+        // already loaded
+        if (Get(*itr)) {
+            continue;
+        }
+
+        fs::path filename = Get_Path(*itr);
+
+        if (!filename.empty()) {
+            filenames.push_back(filename);
+        }
+    }
+
+    m_prefetcher->Set_Wanted(filenames);
 }
 
 void cLevel_Manager::Draw(void)
 {
+    /* draw between the last two simulation steps
+     * the editor moves objects directly and shows them where they are
+    */
+    if (!editor_enabled) {
+        const float alpha = pFramerate->Get_Step_Interpolation();
+
+        pActive_Level->m_sprite_manager->Interpolate_Positions(alpha, 1);
+        pActive_Camera->Interpolate_Position(alpha);
+    }
+
+    // the camera of this frame, also for the render thread
+    pRenderer->Set_Camera(pActive_Camera->m_x, pActive_Camera->m_y);
+
     // clear
     pVideo->Clear_Screen();
 
@@ -311,6 +422,10 @@ void cLevel_Manager::Draw(void)
 
     // update performance timer
     pFramerate->m_perf_timer[PERF_DRAW_LEVEL_EDITOR]->Update();
+
+    // back to the simulated positions
+    pActive_Level->m_sprite_manager->Restore_Positions();
+    pActive_Camera->Restore_Position();
 }
 
 void cLevel_Manager::Finish_Level(bool win_music /* = 0 */, std::string taken_exit /* = "" */)
@@ -24,6 +24,8 @@
 
 namespace TSC {
 
+    class cLevel_Prefetcher;
+
 // default files for levels
 #define LEVEL_DEFAULT_MUSIC "land/land_5.ogg"
 #define LEVEL_DEFAULT_BACKGROUND "game/background/green_junglehills.png"
@@ -60,6 +62,10 @@ namespace TSC {
         boost::filesystem::path Get_Path(const std::string& levelname, bool check_only_user_dir = false);
         // update
         void Update(void);
+        /* Prefetch the levels behind level exits near the player
+         * or the level of the current overworld waypoint
+        */
+        void Update_Prefetch(void);
         // draw
         void Draw(void);
 
@@ -80,6 +86,11 @@ namespace TSC {
 
         // level camera
         cCamera* m_camera;
+        // reads levels the player may enter soon
+        cLevel_Prefetcher* m_prefetcher;
+    private:
+        // time until the wanted levels are checked again
+        float m_prefetch_counter;
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
@@ -31,6 +31,7 @@
 #include "../objects/level_exit.hpp"
 #include "../objects/box.hpp"
 #include "../input/keyboard.hpp"
+#include "../input/input_recorder.hpp"
 #include "../core/math/utilities.hpp"
 #include "../core/i18n.hpp"
 #include "../video/gl_surface.hpp"
@@ -181,7 +182,7 @@ bool cLevel_Player::Set_On_Ground(cSprite* obj, bool set_on_top /* = 1 */)
         }
 
         // if massive ground and ducking key is pressed
-        if (m_ground_object->m_massive_type == MASS_MASSIVE && (sf::Keyboard::isKeyPressed(pPreferences->m_key_down) || pJoystick->Down())) {
+        if (m_ground_object->m_massive_type == MASS_MASSIVE && (pKeyboard->Is_Key_Down(pPreferences->m_key_down) || pJoystick->Down())) {
             Start_Ducking();
         }
     }
@@ -220,7 +221,7 @@ void cLevel_Player::DownGrade_Player(bool delayed /* = true */, bool force /* =
 
     // if not weakest state or not forced
     if (m_alex_type != ALEX_SMALL && !force) {
-        pAudio->Play_Sound("player/powerdown.ogg", RID_ALEX_POWERDOWN);
+        pAudio->Play_Sound(SOUND_PLAYER_POWERDOWN, RID_ALEX_POWERDOWN);
 
         // power down
         Set_Type(ALEX_SMALL);
@@ -260,7 +261,7 @@ void cLevel_Player::DownGrade_Player(bool delayed /* = true */, bool force /* =
 
     // lost a live
     if (gp_hud->Get_Lives() >= 0) {
-        pAudio->Play_Sound(utf8_to_path("player/dead.ogg"), RID_ALEX_DEATH);
+        pAudio->Play_Sound(SOUND_PLAYER_DEAD, RID_ALEX_DEATH);
     }
     // game over
     else {
@@ -284,7 +285,7 @@ void cLevel_Player::DownGrade_Player(bool delayed /* = true */, bool force /* =
     float i;
 
     for (i = 0.0f; i < 7.0f; i += pFramerate->m_speed_factor) {
-        while (pVideo->PollEvent(input_event)) {
+        while (pInput_Recorder->Poll_Event(input_event)) {
             if (input_event.type == sf::Event::KeyPressed) {
                 if (input_event.key.code == sf::Keyboard::Escape) {
                     goto animation_end;
@@ -307,6 +308,7 @@ void cLevel_Player::DownGrade_Player(bool delayed /* = true */, bool force /* =
         // render
         pVideo->Render();
         pFramerate->Update();
+        pInput_Recorder->Blocking_Frame();
     }
 
     // very small delay until falling animation
@@ -316,7 +318,7 @@ void cLevel_Player::DownGrade_Player(bool delayed /* = true */, bool force /* =
     m_walk_count = 0.0f;
 
     for (i = 0.0f; m_col_rect.m_y < pActive_Camera->m_y + game_res_h; i++) {
-        while (pVideo->PollEvent(input_event)) {
+        while (pInput_Recorder->Poll_Event(input_event)) {
             if (input_event.type == sf::Event::KeyPressed) {
                 if (input_event.key.code == sf::Keyboard::Escape) {
                     goto animation_end;
@@ -353,6 +355,7 @@ void cLevel_Player::DownGrade_Player(bool delayed /* = true */, bool force /* =
         // render
         pVideo->Render();
         pFramerate->Update();
+        pInput_Recorder->Blocking_Frame();
     }
 
 animation_end:
@@ -383,7 +386,7 @@ animation_end:
         anim->Set_Const_Rotation_Z(-2.0f, 4.0f);
 
         for (i = 10.0f; i > 0.0f; i -= 0.011f * pFramerate->m_speed_factor) {
-            while (pVideo->PollEvent(input_event)) {
+            while (pInput_Recorder->Poll_Event(input_event)) {
                 if (input_event.type == sf::Event::KeyPressed) {
                     if (input_event.key.code == pPreferences->m_key_screenshot) {
                         pVideo->Save_Screenshot();
@@ -394,12 +397,12 @@ animation_end:
             // TODO: Why is the below not simply handled as events in the above event loop?
 
             // Escape stops
-            if (sf::Keyboard::isKeyPressed(sf::Keyboard::Escape) || sf::Keyboard::isKeyPressed(sf::Keyboard::Return) ||sf::Keyboard::isKeyPressed(sf::Keyboard::Space) || sf::Keyboard::isKeyPressed(pPreferences->m_key_action)) {
+            if (pKeyboard->Is_Key_Down(sf::Keyboard::Escape) || pKeyboard->Is_Key_Down(sf::Keyboard::Return) || pKeyboard->Is_Key_Down(sf::Keyboard::Space) || pKeyboard->Is_Key_Down(pPreferences->m_key_action)) {
                 break;
             }
 
             // if joystick enabled and exit pressed
-            if (pPreferences->m_joy_enabled && sf::Joystick::isButtonPressed(pJoystick->m_current_joystick, pPreferences->m_joy_button_exit)) {
+            if (pPreferences->m_joy_enabled && pJoystick->Button(pPreferences->m_joy_button_exit)) {
                 break;
             }
 
@@ -412,6 +415,7 @@ animation_end:
 
             pVideo->Render();
             pFramerate->Update();
+            pInput_Recorder->Blocking_Frame();
         }
 
         delete anim;
@@ -538,17 +542,6 @@ void cLevel_Player::Generate_Feet_Clouds(cParticle_Emitter* anim /* = NULL */)
         return;
     }
 
-    bool create_anim = 0;
-
-    if (!anim) {
-        create_anim = 1;
-        // create animation
-        anim = new cParticle_Emitter(m_sprite_manager);
-    }
-
-    anim->Set_Emitter_Rect(m_col_rect.m_x, m_col_rect.m_y + m_col_rect.m_h - 2.0f, m_col_rect.m_w);
-    anim->Set_Pos_Z(m_pos_z - m_pos_z_delta);
-
     float vel;
 
     if (m_velx > 0.0f) {
@@ -558,54 +551,65 @@ void cLevel_Player::Generate_Feet_Clouds(cParticle_Emitter* anim /* = NULL */)
         vel = -m_velx;
     }
 
+    EffectPreset preset;
+    float speed;
+    float speed_rand;
+
     // ground type
     switch (m_ground_object->m_image->m_ground_type) {
     case GROUND_EARTH: {
-        anim->Set_Image(pVideo->Get_Surface("animation/particles/dirt.png"));
-        anim->Set_Time_to_Live(0.3f);
-        anim->Set_Scale(0.5f);
-        anim->Set_Speed(0.08f + vel * 0.1f, vel * 0.05f);
+        preset = EFFECT_FEET_CLOUDS_EARTH;
+        speed = 0.08f + vel * 0.1f;
+        speed_rand = vel * 0.05f;
         break;
     }
     case GROUND_ICE: {
-        anim->Set_Image(pVideo->Get_Surface("animation/particles/ice_1.png"));
-        anim->Set_Time_to_Live(0.6f);
-        anim->Set_Scale(0.3f);
-        anim->Set_Speed(0.1f + vel * 0.05f, vel * 0.04f);
+        preset = EFFECT_FEET_CLOUDS_ICE;
+        speed = 0.1f + vel * 0.05f;
+        speed_rand = vel * 0.04f;
         break;
     }
     case GROUND_SAND: {
-        anim->Set_Emitter_Iteration_Interval(4.0f);
-        anim->Set_Image(pVideo->Get_Surface("animation/particles/cloud.png"));
-        anim->Set_Time_to_Live(0.3f);
-        anim->Set_Scale(0.2f);
-        anim->Set_Color(lightorange);
-        anim->Set_Speed(0.2f + vel * 0.15f, vel * 0.15f);
+        preset = EFFECT_FEET_CLOUDS_SAND;
+        speed = 0.2f + vel * 0.15f;
+        speed_rand = vel * 0.15f;
         break;
     }
     case GROUND_STONE: {
-        anim->Set_Image(pVideo->Get_Surface("animation/particles/smoke_black.png"));
-        anim->Set_Time_to_Live(0.3f);
-        anim->Set_Scale(0.3f);
-        anim->Set_Speed(vel * 0.08f, 0.1f + vel * 0.1f);
+        preset = EFFECT_FEET_CLOUDS_STONE;
+        speed = vel * 0.08f;
+        speed_rand = 0.1f + vel * 0.1f;
         break;
     }
     case GROUND_PLASTIC: {
-        anim->Set_Image(pVideo->Get_Surface("animation/particles/light.png"));
-        anim->Set_Time_to_Live(0.2f);
-        anim->Set_Scale(0.2f);
-        anim->Set_Color(lightgrey);
-        anim->Set_Speed(0.05f, vel * 0.05f);
+        preset = EFFECT_FEET_CLOUDS_PLASTIC;
+        speed = 0.05f;
+        speed_rand = vel * 0.05f;
         break;
     }
     default: {
-        anim->Set_Image(pVideo->Get_Surface("animation/particles/smoke.png"));
-        anim->Set_Time_to_Live(0.3f);
-        anim->Set_Speed(0.1f + vel * 0.1f, vel * 0.1f);
+        preset = EFFECT_FEET_CLOUDS;
+        speed = 0.1f + vel * 0.1f;
+        speed_rand = vel * 0.1f;
         break;
     }
     }
 
+    bool create_anim = 0;
+
+    if (!anim) {
+        create_anim = 1;
+        // create animation
+        anim = pActive_Animation_Manager->Get_Effect(preset, m_sprite_manager);
+    }
+    else {
+        anim->Copy_Settings(pActive_Animation_Manager->Get_Effect_Preset(preset, m_sprite_manager));
+    }
+
+    anim->Set_Emitter_Rect(m_col_rect.m_x, m_col_rect.m_y + m_col_rect.m_h - 2.0f, m_col_rect.m_w);
+    anim->Set_Pos_Z(m_pos_z - m_pos_z_delta);
+    anim->Set_Speed(speed, speed_rand);
+
     if (m_direction == DIR_RIGHT) {
         anim->Set_Direction_Range(180.0f, 90.0f);
     }
@@ -631,7 +635,7 @@ void cLevel_Player::Update_Walking(void)
     }
 
     // only if left or right is pressed, and game console is not open
-    if ((sf::Keyboard::isKeyPressed(pPreferences->m_key_left) || sf::Keyboard::isKeyPressed(pPreferences->m_key_right) || pJoystick->Left() || pJoystick->Right()) && !gp_game_console->IsVisible()) {
+    if ((pKeyboard->Is_Key_Down(pPreferences->m_key_left) || pKeyboard->Is_Key_Down(pPreferences->m_key_right) || pJoystick->Left() || pJoystick->Right()) && !gp_game_console->IsVisible()) {
         float ground_mod = 1.0f;
 
         if (m_ground_object && m_ground_object->m_image) {
@@ -735,7 +739,7 @@ void cLevel_Player::Update_Staying(void)
     }
 
     // if left and right is not pressed
-    if (!sf::Keyboard::isKeyPressed(pPreferences->m_key_left) && !sf::Keyboard::isKeyPressed(pPreferences->m_key_right) && !pJoystick->Left() && !pJoystick->Right()) {
+    if (!pKeyboard->Is_Key_Down(pPreferences->m_key_left) && !pKeyboard->Is_Key_Down(pPreferences->m_key_right) && !pJoystick->Left() && !pJoystick->Right()) {
         // walking
         if (m_velx) {
             if (m_ground_object->m_image && m_ground_object->m_image->m_ground_type == GROUND_ICE) {
@@ -801,7 +805,7 @@ void cLevel_Player::Update_Flying(void)
         }
 
         // move down
-        if (sf::Keyboard::isKeyPressed(pPreferences->m_key_down) || pJoystick->Down()) {
+        if (pKeyboard->Is_Key_Down(pPreferences->m_key_down) || pJoystick->Down()) {
             const float max_vel = 5.0f * Get_Vel_Modifier();
 
             if (m_vely < max_vel) {
@@ -809,7 +813,7 @@ void cLevel_Player::Update_Flying(void)
             }
         }
         // move up
-        else if (sf::Keyboard::isKeyPressed(pPreferences->m_key_up) || pJoystick->Up()) {
+        else if (pKeyboard->Is_Key_Down(pPreferences->m_key_up) || pJoystick->Up()) {
             const float max_vel = -5.0f * Get_Vel_Modifier();
 
             if (m_vely > max_vel) {
@@ -828,7 +832,7 @@ void cLevel_Player::Update_Flying(void)
     // falling
     else {
         // move left
-        if ((sf::Keyboard::isKeyPressed(pPreferences->m_key_left) || pJoystick->Left()) && !m_ducked_counter) {
+        if ((pKeyboard->Is_Key_Down(pPreferences->m_key_left) || pJoystick->Left()) && !m_ducked_counter) {
             if (!m_parachute) {
                 const float max_vel = -10.0f * Get_Vel_Modifier();
 
@@ -846,7 +850,7 @@ void cLevel_Player::Update_Flying(void)
             }
         }
         // move right
-        else if ((sf::Keyboard::isKeyPressed(pPreferences->m_key_right) || pJoystick->Right()) && !m_ducked_counter) {
+        else if ((pKeyboard->Is_Key_Down(pPreferences->m_key_right) || pJoystick->Right()) && !m_ducked_counter) {
             if (!m_parachute) {
                 const float max_vel = 10.0f * Get_Vel_Modifier();
 
@@ -1086,17 +1090,17 @@ void cLevel_Player::Update_Climbing(void)
 
     if (Is_On_Climbable()) {
         // set velocity
-        if (sf::Keyboard::isKeyPressed(pPreferences->m_key_left) || pJoystick->Left()) {
+        if (pKeyboard->Is_Key_Down(pPreferences->m_key_left) || pJoystick->Left()) {
             m_velx = -2.0f * Get_Vel_Modifier();
         }
-        else if (sf::Keyboard::isKeyPressed(pPreferences->m_key_right) || pJoystick->Right()) {
+        else if (pKeyboard->Is_Key_Down(pPreferences->m_key_right) || pJoystick->Right()) {
             m_velx = 2.0f * Get_Vel_Modifier();
         }
 
-        if (sf::Keyboard::isKeyPressed(pPreferences->m_key_up) || pJoystick->Up()) {
+        if (pKeyboard->Is_Key_Down(pPreferences->m_key_up) || pJoystick->Up()) {
             m_vely = -4.0f * Get_Vel_Modifier();
         }
-        else if (sf::Keyboard::isKeyPressed(pPreferences->m_key_down) || pJoystick->Down()) {
+        else if (pKeyboard->Is_Key_Down(pPreferences->m_key_down) || pJoystick->Down()) {
             m_vely = 4.0f * Get_Vel_Modifier();
         }
 
@@ -1165,23 +1169,23 @@ void cLevel_Player::Start_Jump(float deaccel /* = 0.08f */)
         // small
         if (m_alex_type == ALEX_SMALL) {
             if (m_force_jump) {
-                pAudio->Play_Sound("player/jump_small_power.ogg", RID_ALEX_JUMP);
+                pAudio->Play_Sound(SOUND_PLAYER_JUMP_SMALL_POWER, RID_ALEX_JUMP);
             }
             else {
-                pAudio->Play_Sound("player/jump_small.ogg", RID_ALEX_JUMP);
+                pAudio->Play_Sound(SOUND_PLAYER_JUMP_SMALL, RID_ALEX_JUMP);
             }
         }
         // ghost
         else if (m_alex_type == ALEX_GHOST) {
-            pAudio->Play_Sound("player/jump_ghost.ogg", RID_ALEX_JUMP);
+            pAudio->Play_Sound(SOUND_PLAYER_JUMP_GHOST, RID_ALEX_JUMP);
         }
         // big
         else {
             if (m_force_jump) {
-                pAudio->Play_Sound("player/jump_big_power.ogg", RID_ALEX_JUMP);
+                pAudio->Play_Sound(SOUND_PLAYER_JUMP_BIG_POWER, RID_ALEX_JUMP);
             }
             else {
-                pAudio->Play_Sound("player/jump_big.ogg", RID_ALEX_JUMP);
+                pAudio->Play_Sound(SOUND_PLAYER_JUMP_BIG, RID_ALEX_JUMP);
             }
         }
     }
@@ -1189,7 +1193,7 @@ void cLevel_Player::Start_Jump(float deaccel /* = 0.08f */)
     bool jump_key = 0;
 
     // if jump key pressed
-    if (sf::Keyboard::isKeyPressed(pPreferences->m_key_jump) || pJoystick->Button(pPreferences->m_joy_button_jump)) {
+    if (pKeyboard->Is_Key_Down(pPreferences->m_key_jump) || pJoystick->Button(pPreferences->m_joy_button_jump)) {
         jump_key = 1;
     }
 
@@ -1272,7 +1276,7 @@ void cLevel_Player::Update_Jump(void)
     }
 
     // jumping physics
-    if (sf::Keyboard::isKeyPressed(pPreferences->m_key_jump) || pJoystick->Button(pPreferences->m_joy_button_jump)) {
+    if (pKeyboard->Is_Key_Down(pPreferences->m_key_jump) || pJoystick->Button(pPreferences->m_joy_button_jump)) {
         Add_Velocity_Y(-(m_jump_accel_up + (m_vely * m_jump_vel_deaccel) / Get_Vel_Modifier()));
         m_jump_power -= pFramerate->m_speed_factor;
     }
@@ -1282,7 +1286,7 @@ void cLevel_Player::Update_Jump(void)
     }
 
     // left right physics
-    if ((sf::Keyboard::isKeyPressed(pPreferences->m_key_left) || pJoystick->Left()) && !m_ducked_counter) {
+    if ((pKeyboard->Is_Key_Down(pPreferences->m_key_left) || pJoystick->Left()) && !m_ducked_counter) {
         const float max_vel = -10.0f * Get_Vel_Modifier();
 
         if (m_velx > max_vel) {
@@ -1290,7 +1294,7 @@ void cLevel_Player::Update_Jump(void)
         }
 
     }
-    else if ((sf::Keyboard::isKeyPressed(pPreferences->m_key_right) || pJoystick->Right()) && !m_ducked_counter) {
+    else if ((pKeyboard->Is_Key_Down(pPreferences->m_key_right) || pJoystick->Right()) && !m_ducked_counter) {
         const float max_vel = 10.0f * Get_Vel_Modifier();
 
         if (m_velx < max_vel) {
@@ -1355,7 +1359,7 @@ void cLevel_Player::Update_Item(void)
     }
 
     // if control is pressed search for items in front of the player
-    if (sf::Keyboard::isKeyPressed(pPreferences->m_key_action) || pJoystick->Button(pPreferences->m_joy_button_action)) {
+    if (pKeyboard->Is_Key_Down(pPreferences->m_key_action) || pJoystick->Button(pPreferences->m_joy_button_action)) {
         // next position velocity with extra size
         float check_x = (m_velx > 0.0f) ? (m_velx + 5.0f) : (m_velx - 5.0f);
 
@@ -1425,7 +1429,7 @@ void cLevel_Player::Release_Item(bool set_position /* = 1 */, bool no_action /*
 
         // play kick sound if not dead
         if (!army->m_dead) {
-            pAudio->Play_Sound("enemy/army/shell/hit.ogg");
+            pAudio->Play_Sound(SOUND_ENEMY_ARMY_SHELL_HIT);
         }
 
         // if object got kicked upwards use state stay
@@ -1598,19 +1602,19 @@ void cLevel_Player::Set_Type(Alex_type new_type, bool animation /* = 1 */, bool
     // play sound
     if (sound) {
         if (new_type == ALEX_BIG) {
-            pAudio->Play_Sound("item/mushroom.ogg", RID_MUSHROOM);
+            pAudio->Play_Sound(SOUND_ITEM_MUSHROOM, RID_MUSHROOM);
         }
         else if (new_type == ALEX_FIRE) {
-            pAudio->Play_Sound("item/fireplant.ogg", RID_FIREPLANT);
+            pAudio->Play_Sound(SOUND_ITEM_FIREPLANT, RID_FIREPLANT);
         }
         else if (new_type == ALEX_ICE) {
-            pAudio->Play_Sound("item/mushroom_blue.wav", RID_MUSHROOM_BLUE);
+            pAudio->Play_Sound(SOUND_ITEM_MUSHROOM_BLUE, RID_MUSHROOM_BLUE);
         }
         else if (new_type == ALEX_CAPE) {
-            pAudio->Play_Sound("item/feather.ogg", RID_FEATHER);
+            pAudio->Play_Sound(SOUND_ITEM_FEATHER, RID_FEATHER);
         }
         else if (new_type == ALEX_GHOST) {
-            pAudio->Play_Sound("item/mushroom_ghost.ogg", RID_MUSHROOM_GHOST);
+            pAudio->Play_Sound(SOUND_ITEM_MUSHROOM_GHOST, RID_MUSHROOM_GHOST);
         }
     }
 
@@ -1952,7 +1956,7 @@ void cLevel_Player::Update(void)
 
         // ended
         if (m_ghost_time <= 0.0f) {
-            pAudio->Play_Sound("player/ghost_end.ogg", RID_MUSHROOM_GHOST);
+            pAudio->Play_Sound(SOUND_PLAYER_GHOST_END, RID_MUSHROOM_GHOST);
             Set_Type(m_alex_type_temp_power, 1, 0);
         }
         // near end
@@ -2820,7 +2824,7 @@ void cLevel_Player::Get_Item(SpriteType item_type, bool force /* = 0 */, cMoving
     }
     // Mushroom 1-UP
     else if (item_type == TYPE_MUSHROOM_LIVE_1) {
-        pAudio->Play_Sound("item/live_up.ogg", RID_1UP_MUSHROOM);
+        pAudio->Play_Sound(SOUND_ITEM_LIVE_UP, RID_1UP_MUSHROOM);
         gp_hud->Add_Lives(1);
     }
     // Mushroom Poison
@@ -2829,7 +2833,7 @@ void cLevel_Player::Get_Item(SpriteType item_type, bool force /* = 0 */, cMoving
     }
     // Moon
     else if (item_type == TYPE_MOON) {
-        pAudio->Play_Sound("item/moon.ogg", RID_MOON);
+        pAudio->Play_Sound(SOUND_ITEM_MOON, RID_MOON);
         gp_hud->Add_Lives(3);
     }
     // Star
@@ -2843,7 +2847,7 @@ void cLevel_Player::Get_Item(SpriteType item_type, bool force /* = 0 */, cMoving
     }
     // Armadillo Shell
     else if (item_type == TYPE_ARMY || item_type == TYPE_SHELL) {
-        pAudio->Play_Sound("player/pickup_item.wav");
+        pAudio->Play_Sound(SOUND_PLAYER_PICKUP_ITEM);
 
         m_active_object = base;
         m_active_object->m_massive_type = MASS_PASSIVE;
@@ -2871,7 +2875,7 @@ float cLevel_Player::Get_Vel_Modifier(void) const
     float vel_mod = 1.0f;
 
     // if running key is pressed or always run
-    if (pPreferences->m_always_run || sf::Keyboard::isKeyPressed(pPreferences->m_key_action) || pJoystick->Button(pPreferences->m_joy_button_action)) {
+    if (pPreferences->m_always_run || pKeyboard->Is_Key_Down(pPreferences->m_key_action) || pJoystick->Button(pPreferences->m_joy_button_action)) {
         vel_mod = 1.5f;
     }
 
@@ -3056,7 +3060,7 @@ void cLevel_Player::Action_Interact(input_identifier key_type)
             if (m_direction != DIR_LEFT) {
                 // play stop sound if already running
                 if (m_velx > 12.0f && m_ground_object) {
-                    pAudio->Play_Sound("player/run_stop.ogg", RID_ALEX_STOP);
+                    pAudio->Play_Sound(SOUND_PLAYER_RUN_STOP, RID_ALEX_STOP);
                 }
 
                 m_direction = DIR_LEFT;
@@ -3104,7 +3108,7 @@ void cLevel_Player::Action_Interact(input_identifier key_type)
             if (m_direction != DIR_RIGHT) {
                 // play stop sound if already running
                 if (m_velx < -12.0f && m_ground_object) {
-                    pAudio->Play_Sound("player/run_stop.ogg", RID_ALEX_STOP);
+                    pAudio->Play_Sound(SOUND_PLAYER_RUN_STOP, RID_ALEX_STOP);
                 }
 
                 m_direction = DIR_RIGHT;
@@ -3185,7 +3189,7 @@ void cLevel_Player::Action_Stop_Interact(input_identifier key_type)
     // Left
     else if (key_type == INP_LEFT) {
         // if key in opposite direction is still pressed only change direction
-        if (sf::Keyboard::isKeyPressed(pPreferences->m_key_right) || pJoystick->Right()) {
+        if (pKeyboard->Is_Key_Down(pPreferences->m_key_right) || pJoystick->Right()) {
             m_direction = DIR_RIGHT;
         }
         else {
@@ -3195,7 +3199,7 @@ void cLevel_Player::Action_Stop_Interact(input_identifier key_type)
     // Right
     else if (key_type == INP_RIGHT) {
         // if key in opposite direction is still pressed only change direction
-        if (sf::Keyboard::isKeyPressed(pPreferences->m_key_left) || pJoystick->Left()) {
+        if (pKeyboard->Is_Key_Down(pPreferences->m_key_left) || pJoystick->Left()) {
             m_direction = DIR_LEFT;
         }
         else {
@@ -3244,12 +3248,12 @@ bool cLevel_Player::Ball_Add(ball_effect effect_type /* = FIREBALL_DEFAULT */, f
             ball_vel_x = 12;
 
             // sound
-            pAudio->Play_Sound("item/iceball.wav", RID_ALEX_BALL);
+            pAudio->Play_Sound(SOUND_ITEM_ICEBALL, RID_ALEX_BALL);
         }
         // fireball
         else {
             // sound
-            pAudio->Play_Sound("item/fireball.ogg", RID_ALEX_BALL);
+            pAudio->Play_Sound(SOUND_ITEM_FIREBALL, RID_ALEX_BALL);
         }
 
         if (m_direction == DIR_LEFT) {
@@ -3322,7 +3326,7 @@ bool cLevel_Player::Ball_Add(ball_effect effect_type /* = FIREBALL_DEFAULT */, f
             anim->Set_Fading_Speed(0.3f);
             pActive_Animation_Manager->Add(anim);
 
-            pAudio->Play_Sound("item/fireball_explosion.wav", RID_ALEX_BALL);
+            pAudio->Play_Sound(SOUND_ITEM_FIREBALL_EXPLOSION, RID_ALEX_BALL);
         }
         else {
             // create animation
@@ -3339,7 +3343,7 @@ bool cLevel_Player::Ball_Add(ball_effect effect_type /* = FIREBALL_DEFAULT */, f
             anim->Emit();
             pActive_Animation_Manager->Add(anim);
 
-            pAudio->Play_Sound("item/iceball_explosion.wav", RID_ALEX_BALL);
+            pAudio->Play_Sound(SOUND_ITEM_ICEBALL_EXPLOSION, RID_ALEX_BALL);
         }
     }
     // unknown type
@@ -3352,17 +3356,16 @@ bool cLevel_Player::Ball_Add(ball_effect effect_type /* = FIREBALL_DEFAULT */, f
 
 void cLevel_Player::Ball_Clear(void) const
 {
-    // destroy all fireballs from the player
-    for (cSprite_List::iterator itr = m_sprite_manager->objects.begin(); itr != m_sprite_manager->objects.end(); ++itr) {
-        cSprite* obj = (*itr);
+    cSprite_List balls;
+    m_sprite_manager->Get_Objects_by_Type(TYPE_BALL, balls);
 
-        if (obj->m_type == TYPE_BALL) {
-            cBall* ball = static_cast<cBall*>(obj);
+    // destroy all fireballs from the player
+    for (cSprite_List::iterator itr = balls.begin(); itr != balls.end(); ++itr) {
+        cBall* ball = static_cast<cBall*>(*itr);
 
-            // if from player
-            if (ball->m_origin_type == TYPE_PLAYER) {
-                obj->Destroy();
-            }
+        // if from player
+        if (ball->m_origin_type == TYPE_PLAYER) {
+            ball->Destroy();
         }
     }
 }
@@ -3523,7 +3526,7 @@ Col_Valid_Type cLevel_Player::Validate_Collision(cSprite* obj)
     }
     else if (obj->m_massive_type == MASS_HALFMASSIVE) {
         // fall through
-        if (sf::Keyboard::isKeyPressed(pPreferences->m_key_down) || pJoystick->Down()) {
+        if (pKeyboard->Is_Key_Down(pPreferences->m_key_down) || pJoystick->Down()) {
             return COL_VTYPE_NOT_VALID;
         }
 
@@ -3571,22 +3574,22 @@ Col_Valid_Type cLevel_Player::Validate_Collision(cSprite* obj)
             // warp levelexit key check
             if (levelexit->m_exit_type == LEVEL_EXIT_WARP) {
                 // joystick events are sent as keyboard keys
-                if (sf::Keyboard::isKeyPressed(pPreferences->m_key_up) || pJoystick->Up()) {
+                if (pKeyboard->Is_Key_Down(pPreferences->m_key_up) || pJoystick->Up()) {
                     if (levelexit->m_start_direction == DIR_UP) {
                         Action_Interact(INP_UP);
                     }
                 }
-                else if (sf::Keyboard::isKeyPressed(pPreferences->m_key_down) || pJoystick->Down()) {
+                else if (pKeyboard->Is_Key_Down(pPreferences->m_key_down) || pJoystick->Down()) {
                     if (levelexit->m_start_direction == DIR_DOWN) {
                         Action_Interact(INP_DOWN);
                     }
                 }
-                else if (sf::Keyboard::isKeyPressed(pPreferences->m_key_right) || pJoystick->Right()) {
+                else if (pKeyboard->Is_Key_Down(pPreferences->m_key_right) || pJoystick->Right()) {
                     if (levelexit->m_start_direction == DIR_RIGHT) {
                         Action_Interact(INP_RIGHT);
                     }
                 }
-                else if (sf::Keyboard::isKeyPressed(pPreferences->m_key_left) || pJoystick->Left()) {
+                else if (pKeyboard->Is_Key_Down(pPreferences->m_key_left) || pJoystick->Left()) {
                     if (levelexit->m_start_direction == DIR_LEFT) {
                         Action_Interact(INP_LEFT);
                     }
@@ -3650,7 +3653,7 @@ void cLevel_Player::Handle_Collision_Enemy(cObjectCollision* collision)
 
         // hit
         if (hit_enemy) {
-            pAudio->Play_Sound("item/star_kill.ogg");
+            pAudio->Play_Sound(SOUND_ITEM_STAR_KILL);
             gp_hud->Add_Points(static_cast<unsigned int>(enemy->m_kill_points * 1.2f), enemy->m_pos_x, enemy->m_pos_y - 5.0f, "", yellow, 1);
             // force complete downgrade
             enemy->DownGrade(1);
@@ -3699,7 +3702,7 @@ void cLevel_Player::Handle_Collision_Enemy(cObjectCollision* collision)
         pActive_Animation_Manager->Add(anim);
 
         // ice sound
-        pAudio->Play_Sound("item/ice_kill.wav");
+        pAudio->Play_Sound(SOUND_ITEM_ICE_KILL);
 
         // get points
         gp_hud->Add_Points(enemy->m_kill_points, enemy->m_pos_x, enemy->m_pos_y - 10.0f, "", static_cast<uint8_t>(255), 1);
@@ -3754,7 +3757,7 @@ void cLevel_Player::Handle_Collision_Massive(cObjectCollision* collision)
     // climbable
     if (col_obj->m_massive_type == MASS_CLIMBABLE && m_state != STA_CLIMB && m_state != STA_FLY) {
         // if not climbing and player wants to climb
-        if (sf::Keyboard::isKeyPressed(pPreferences->m_key_up) || pJoystick->Up() || ((sf::Keyboard::isKeyPressed(pPreferences->m_key_down) || pJoystick->Down()) && !m_ground_object)) {
+        if (pKeyboard->Is_Key_Down(pPreferences->m_key_up) || pJoystick->Up() || ((pKeyboard->Is_Key_Down(pPreferences->m_key_down) || pJoystick->Down()) && !m_ground_object)) {
             // start climbing
             Start_Climbing();
         }
@@ -3797,7 +3800,7 @@ void cLevel_Player::Handle_Collision_Massive(cObjectCollision* collision)
                 }
 
                 if (collision->m_array == ARRAY_MASSIVE) {
-                    pAudio->Play_Sound("wall_hit.wav", RID_ALEX_WALL_HIT);
+                    pAudio->Play_Sound(SOUND_WALL_HIT, RID_ALEX_WALL_HIT);
 
                     // create animation
                     cParticle_Emitter* anim = new cParticle_Emitter(m_sprite_manager);
@@ -0,0 +1,257 @@
+/***************************************************************************
+ * level_prefetcher.cpp - read levels the player may enter soon
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../level/level_prefetcher.hpp"
+#include "../level/level_loader.hpp"
+#include "../core/property_helper.hpp"
+#include "../core/global_basic.hpp"
+#include <libxml/parser.h>
+
+using namespace std;
+
+namespace fs = boost::filesystem;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** *** cLevel_Prefetcher *** *** *** *** *** *** *** *** *** *** */
+
+const size_t cLevel_Prefetcher::m_memory_budget = 32 * 1024 * 1024;
+
+cLevel_Prefetcher::cLevel_Prefetcher(void)
+{
+    m_active_cancelled = 0;
+    m_memory_size = 0;
+    m_exit = 0;
+
+    // libxml2 must be initialized on the main thread before parsing on others
+    xmlInitParser();
+
+    m_thread = boost::thread(&cLevel_Prefetcher::Thread_Function, this);
+}
+
+cLevel_Prefetcher::~cLevel_Prefetcher(void)
+{
+    {
+        boost::lock_guard<boost::mutex> lock(m_mutex);
+        m_queue.clear();
+        m_exit = 1;
+    }
+
+    m_condition.notify_all();
+
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+
+    Clear();
+}
+
+void cLevel_Prefetcher::Set_Wanted(const std::vector<fs::path>& filenames)
+{
+    boost::lock_guard<boost::mutex> lock(m_mutex);
+
+    // cancel queued files
+    for (std::deque<fs::path>::iterator itr = m_queue.begin(); itr != m_queue.end();) {
+        if (!Contains(filenames, *itr)) {
+            itr = m_queue.erase(itr);
+        }
+        else {
+            ++itr;
+        }
+    }
+
+    // drop read files
+    for (File_Data_Map::iterator itr = m_ready.begin(); itr != m_ready.end();) {
+        if (!Contains(filenames, itr->first)) {
+            m_memory_size -= itr->second->Get_Memory_Size();
+            delete itr->second;
+            m_ready.erase(itr++);
+        }
+        else {
+            ++itr;
+        }
+    }
+
+    // forget failures so they are tried again when wanted again
+    for (std::vector<fs::path>::iterator itr = m_failed.begin(); itr != m_failed.end();) {
+        if (!Contains(filenames, *itr)) {
+            itr = m_failed.erase(itr);
+        }
+        else {
+            ++itr;
+        }
+    }
+
+    if (!m_active.empty()) {
+        m_active_cancelled = !Contains(filenames, m_active);
+    }
+
+    bool queued = 0;
+
+    // queue new files
+    for (std::vector<fs::path>::const_iterator itr = filenames.begin(); itr != filenames.end(); ++itr) {
+        const fs::path& filename = (*itr);
+
+        if (filename == m_active || m_ready.count(filename) || Contains(m_failed, filename)) {
+            continue;
+        }
+        if (std::find(m_queue.begin(), m_queue.end(), filename) != m_queue.end()) {
+            continue;
+        }
+
+        m_queue.push_back(filename);
+        queued = 1;
+    }
+
+    if (queued) {
+        m_condition.notify_all();
+    }
+}
+
+cLevel_File_Data* cLevel_Prefetcher::Take(const fs::path& filename)
+{
+    boost::unique_lock<boost::mutex> lock(m_mutex);
+
+    // not read yet
+    std::deque<fs::path>::iterator queue_itr = std::find(m_queue.begin(), m_queue.end(), filename);
+
+    if (queue_itr != m_queue.end()) {
+        m_queue.erase(queue_itr);
+        return NULL;
+    }
+
+    // almost read
+    if (m_active == filename) {
+        m_active_cancelled = 0;
+
+        while (m_active == filename) {
+            m_condition.wait(lock);
+        }
+    }
+
+    File_Data_Map::iterator itr = m_ready.find(filename);
+
+    if (itr == m_ready.end()) {
+        return NULL;
+    }
+
+    cLevel_File_Data* data = itr->second;
+    m_memory_size -= data->Get_Memory_Size();
+    m_ready.erase(itr);
+
+    // changed since it was read
+    boost::system::error_code error;
+    if (fs::last_write_time(filename, error) != data->m_write_time || error) {
+        delete data;
+        return NULL;
+    }
+
+    debug_print("Using prefetched level: %s\n", path_to_utf8(filename).c_str());
+
+    return data;
+}
+
+void cLevel_Prefetcher::Clear(void)
+{
+    boost::unique_lock<boost::mutex> lock(m_mutex);
+
+    m_queue.clear();
+    m_failed.clear();
+    m_active_cancelled = 1;
+
+    for (File_Data_Map::iterator itr = m_ready.begin(); itr != m_ready.end(); ++itr) {
+        delete itr->second;
+    }
+
+    m_ready.clear();
+    m_memory_size = 0;
+}
+
+size_t cLevel_Prefetcher::Get_Memory_Size(void)
+{
+    boost::lock_guard<boost::mutex> lock(m_mutex);
+
+    return m_memory_size;
+}
+
+void cLevel_Prefetcher::Thread_Function(void)
+{
+    boost::unique_lock<boost::mutex> lock(m_mutex);
+
+    while (1) {
+        while (m_queue.empty() && !m_exit) {
+            m_condition.wait(lock);
+        }
+
+        if (m_exit) {
+            break;
+        }
+
+        m_active = m_queue.front();
+        m_active_cancelled = 0;
+        m_queue.pop_front();
+
+        const fs::path filename = m_active;
+
+        lock.unlock();
+
+        cLevel_File_Data* data = new cLevel_File_Data();
+
+        try {
+            cLevelLoader reader;
+            reader.Read_File(filename, *data);
+        }
+        catch (const std::exception& err) {
+            cerr << "Warning: Could not prefetch level '" << path_to_utf8(filename) << "': " << err.what() << endl;
+            delete data;
+            data = NULL;
+        }
+
+        const size_t size = data ? data->Get_Memory_Size() : 0;
+
+        lock.lock();
+
+        if (data && m_active_cancelled) {
+            delete data;
+        }
+        // the normal loading will report the error
+        else if (!data) {
+            m_failed.push_back(filename);
+        }
+        else if (m_memory_size + size > m_memory_budget) {
+            debug_print("Level prefetch of %s exceeds the memory budget\n", path_to_utf8(filename).c_str());
+            m_failed.push_back(filename);
+            delete data;
+        }
+        else {
+            m_ready[filename] = data;
+            m_memory_size += size;
+        }
+
+        m_active.clear();
+        m_active_cancelled = 0;
+
+        m_condition.notify_all();
+    }
+}
+
+bool cLevel_Prefetcher::Contains(const std::vector<fs::path>& filenames, const fs::path& filename)
+{
+    return std::find(filenames.begin(), filenames.end(), filename) != filenames.end();
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
@@ -0,0 +1,102 @@
+/***************************************************************************
+ * level_prefetcher.hpp - read levels the player may enter soon
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_LEVEL_PREFETCHER_HPP
+#define TSC_LEVEL_PREFETCHER_HPP
+
+#include "../core/global_basic.hpp"
+#include <deque>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+namespace TSC {
+
+    class cLevel_File_Data;
+
+    /* *** *** *** *** *** *** *** cLevel_Prefetcher *** *** *** *** *** *** *** *** *** *** */
+
+    /* Reads the files of levels the player will probably enter
+     * next on a worker thread, like sublevels behind nearby level
+     * exits or the level of the current overworld waypoint.
+     *
+     * Only the file reading and XML parsing into cLevel_File_Data
+     * happens in the background. Creating the sprites loads images
+     * and the level script needs the mruby interpreter, both only
+     * work on the main thread and are done in cLevel::Load_From_Data()
+     * as before.
+     *
+     * Read levels are kept until they are taken or not wanted anymore.
+     * Reads that would exceed the memory budget are dropped.
+    */
+    class cLevel_Prefetcher {
+    public:
+        cLevel_Prefetcher(void);
+        // Cancels all reads
+        ~cLevel_Prefetcher(void);
+
+        /* Set the levels that should be read
+         * Queued and read levels not in the list are cancelled.
+        */
+        void Set_Wanted(const std::vector<boost::filesystem::path>& filenames);
+
+        /* Returns the read data of the given level file or NULL
+         * Waits if it is being read right now. The returned data
+         * must be deleted by the caller.
+        */
+        cLevel_File_Data* Take(const boost::filesystem::path& filename);
+
+        // Delete all queued and read levels
+        void Clear(void);
+
+        // Returns the memory used by read levels in bytes
+        size_t Get_Memory_Size(void);
+
+        // maximum memory used by read levels in bytes
+        static const size_t m_memory_budget;
+    private:
+        typedef std::map<boost::filesystem::path, cLevel_File_Data*> File_Data_Map;
+
+        // Worker thread loop
+        void Thread_Function(void);
+
+        // Returns true if the given filename is in the list
+        static bool Contains(const std::vector<boost::filesystem::path>& filenames, const boost::filesystem::path& filename);
+
+        boost::thread m_thread;
+        boost::mutex m_mutex;
+        // signaled when a file is queued or read
+        boost::condition_variable m_condition;
+
+        // files to read
+        std::deque<boost::filesystem::path> m_queue;
+        // file being read or empty
+        boost::filesystem::path m_active;
+        // if set the active read is dropped when finished
+        bool m_active_cancelled;
+        // read files
+        File_Data_Map m_ready;
+        // files that failed to read or did not fit into the budget
+        std::vector<boost::filesystem::path> m_failed;
+        // memory used by m_ready
+        size_t m_memory_size;
+        // if set the thread exits
+        bool m_exit;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
@@ -152,7 +152,7 @@ void cBall::Destroy_Ball(bool with_sound /* = 0 */)
 {
     if (with_sound) {
         if (m_ball_type == FIREBALL_DEFAULT) {
-            pAudio->Play_Sound("item/fireball_explode.wav");
+            pAudio->Play_Sound(SOUND_ITEM_FIREBALL_EXPLODE);
         }
     }
 
@@ -382,7 +382,7 @@ void cBall::Handle_Collision_Player(cObjectCollision* collision)
         }
     }
 
-    pAudio->Play_Sound("item/fireball_repelled.wav");
+    pAudio->Play_Sound(SOUND_ITEM_FIREBALL_REPELLED);
     Destroy();
 }
 
@@ -392,7 +392,7 @@ void cBall::Handle_Collision_Enemy(cObjectCollision* collision)
 
     // if enemy is not vulnerable
     if ((m_ball_type == FIREBALL_DEFAULT && enemy->m_fire_resistant) || (m_ball_type == ICEBALL_DEFAULT && enemy->m_ice_resistance >= 1)) {
-        pAudio->Play_Sound("item/fireball_repelled.wav");
+        pAudio->Play_Sound(SOUND_ITEM_FIREBALL_REPELLED);
     }
     // make enemy handle the ball
     else {
@@ -42,6 +42,9 @@ namespace TSC {
 
 /* *** *** *** *** *** *** *** *** cBonusBox *** *** *** *** *** *** *** *** *** */
 
+CEGUI::Combobox* cBonusBox::mp_force_best_item_box = NULL;
+CEGUI::Combobox* cBonusBox::mp_gold_color_box = NULL;
+
 cBonusBox::cBonusBox(cSprite_Manager* sprite_manager)
     : cBaseBox(sprite_manager)
 {
@@ -77,9 +80,6 @@ void cBonusBox::Init(void)
 
     box_type = TYPE_UNDEFINED;
     m_name = _("Bonusbox Empty");
-
-    mp_force_best_item_box = NULL;
-    mp_gold_color_box      = NULL;
 }
 
 cBonusBox* cBonusBox::Copy(void) const
@@ -294,24 +294,24 @@ void cBonusBox::Activate(void)
 
     // no item
     if (box_type == TYPE_UNDEFINED) {
-        pAudio->Play_Sound("item/empty_box.wav");
+        pAudio->Play_Sound(SOUND_ITEM_EMPTY_BOX);
     }
     // check if lower item should be used if no force best item
     else if (!m_force_best_item && (box_type == TYPE_FIREPLANT || box_type == TYPE_MUSHROOM_BLUE) &&
              (current_alex_type == ALEX_SMALL || ((current_alex_type == ALEX_FIRE || current_alex_type == ALEX_ICE) && !gp_hud->Get_Item()))) {
-        pAudio->Play_Sound("sprout_1.ogg");
+        pAudio->Play_Sound(SOUND_SPROUT_1);
 
         cMushroom* mushroom = new cMushroom(m_sprite_manager);
         mushroom->Set_Pos(m_start_pos_x - ((m_item_image->m_w - m_rect.m_w) / 2), m_start_pos_y - ((m_item_image->m_h - m_rect.m_h) / 2), 1);
         box_item = static_cast<cMovingSprite*>(mushroom);
     }
     else if (box_type == TYPE_FIREPLANT) {
-        pAudio->Play_Sound("sprout_1.ogg");
+        pAudio->Play_Sound(SOUND_SPROUT_1);
         box_item = static_cast<cMovingSprite*>(new cFirePlant(m_sprite_manager));
         box_item->Set_Pos(m_start_pos_x - ((m_item_image->m_w - m_rect.m_w) / 2), m_start_pos_y, 1);
     }
     else if (box_type == TYPE_MUSHROOM_DEFAULT || box_type == TYPE_MUSHROOM_LIVE_1 || box_type == TYPE_MUSHROOM_POISON || box_type == TYPE_MUSHROOM_BLUE || box_type == TYPE_MUSHROOM_GHOST) {
-        pAudio->Play_Sound("sprout_1.ogg");
+        pAudio->Play_Sound(SOUND_SPROUT_1);
 
         cMushroom* mushroom = new cMushroom(m_sprite_manager);
         mushroom->Set_Pos(m_start_pos_x - ((m_item_image->m_w - m_rect.m_w) / 2), m_start_pos_y - ((m_item_image->m_h - m_rect.m_h) / 2), 1);
@@ -319,7 +319,7 @@ void cBonusBox::Activate(void)
         box_item = static_cast<cMovingSprite*>(mushroom);
     }
     else if (box_type == TYPE_STAR) {
-        pAudio->Play_Sound("sprout_1.ogg");
+        pAudio->Play_Sound(SOUND_SPROUT_1);
         cjStar* star = new cjStar(m_sprite_manager);
         star->Set_Pos(m_start_pos_x - ((m_item_image->m_w - m_rect.m_w) / 2), m_start_pos_y, 1);
         star->Set_On_Top(this);
@@ -328,7 +328,7 @@ void cBonusBox::Activate(void)
         m_sprite_manager->Add(star);
     }
     else if (box_type == TYPE_GOLDPIECE) {
-        pAudio->Play_Sound("item/jewel_1.ogg");
+        pAudio->Play_Sound(SOUND_ITEM_JEWEL_1);
 
         cJGoldpiece* goldpiece = new cJGoldpiece(m_sprite_manager, m_gold_color);
         goldpiece->Set_Pos(m_start_pos_x - ((m_item_image->m_w - m_rect.m_w) / 2), m_pos_y, 1);
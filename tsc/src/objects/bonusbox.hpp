@@ -98,8 +98,9 @@ namespace TSC {
         // editor gold color option selected event
         bool Editor_Gold_Color_Select(const CEGUI::EventArgs& event);
 
-        CEGUI::Combobox* mp_force_best_item_box;
-        CEGUI::Combobox* mp_gold_color_box;
+        // editor widgets, shared as only one object is edited at a time
+        static CEGUI::Combobox* mp_force_best_item_box;
+        static CEGUI::Combobox* mp_gold_color_box;
 
         // force best possible item
         bool m_force_best_item;
@@ -626,7 +626,7 @@ void cBaseBox::Handle_Collision_Player(cObjectCollision* collision)
         }
         else {
             if (Is_Visible_On_Screen()) {
-                pAudio->Play_Sound("wall_hit.wav", RID_ALEX_WALL_HIT);
+                pAudio->Play_Sound(SOUND_WALL_HIT, RID_ALEX_WALL_HIT);
             }
         }
     }
@@ -665,7 +665,7 @@ void cBaseBox::Handle_Collision_Enemy(cObjectCollision* collision)
         }
         else {
             if (Is_Visible_On_Screen()) {
-                pAudio->Play_Sound("wall_hit.wav");
+                pAudio->Play_Sound(SOUND_WALL_HIT);
             }
         }
     }
@@ -166,10 +166,10 @@ void cGoldpiece::Activate(void)
     }
     else {
         if (m_color_type == COL_RED) {
-            pAudio->Play_Sound("item/jewel_2.ogg");
+            pAudio->Play_Sound(SOUND_ITEM_JEWEL_2, -1, -1, false, SOUND_PRIORITY_LOW);
         }
         else {
-            pAudio->Play_Sound("item/jewel_1.ogg");
+            pAudio->Play_Sound(SOUND_ITEM_JEWEL_1, -1, -1, false, SOUND_PRIORITY_LOW);
         }
     }
 
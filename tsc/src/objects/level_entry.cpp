@@ -198,6 +198,9 @@ void cLevel_Entry::Activate(void)
         float player_posz = pLevel_Player->m_pos_z;
         pLevel_Player->m_pos_z = 0.0799f;
 
+        // particle emitters to keep on screen
+        cSprite_List emitters;
+
         // move slowly out
         while (1) {
             if (m_direction == DIR_DOWN) {
@@ -237,13 +240,12 @@ void cLevel_Entry::Activate(void)
             // center camera
             pActive_Camera->Center();
             // keep particles on screen
-            for (cSprite_List::iterator itr = m_sprite_manager->objects.begin(); itr != m_sprite_manager->objects.end(); ++itr) {
-                cSprite* obj = (*itr);
+            emitters.clear();
+            m_sprite_manager->Get_Objects_by_Type(TYPE_PARTICLE_EMITTER, emitters);
 
-                if (obj->m_type == TYPE_PARTICLE_EMITTER) {
-                    cParticle_Emitter* emitter = static_cast<cParticle_Emitter*>(obj);
-                    emitter->Update_Position();
-                }
+            for (cSprite_List::iterator itr = emitters.begin(); itr != emitters.end(); ++itr) {
+                cParticle_Emitter* emitter = static_cast<cParticle_Emitter*>(*itr);
+                emitter->Update_Position();
             }
             // draw
             Draw_Game();
@@ -40,6 +40,10 @@ namespace TSC {
 
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
 
+CEGUI::Editbox* cLevel_Exit::mp_path_ident_box = NULL;
+CEGUI::Editbox* cLevel_Exit::mp_destination_level_box = NULL;
+CEGUI::Combobox* cLevel_Exit::mp_direction_combobox = NULL;
+
 cLevel_Exit::cLevel_Exit(cSprite_Manager* sprite_manager)
     : cMovingSprite(sprite_manager, "levelexit")
 {
@@ -124,10 +128,6 @@ void cLevel_Exit::Init(void)
 
     m_editor_color = red;
     m_editor_color.alpha = 128;
-
-    mp_path_ident_box = NULL;
-    mp_destination_level_box = NULL;
-    mp_direction_combobox = NULL;
 }
 
 cLevel_Exit* cLevel_Exit::Copy(void) const
@@ -120,9 +120,10 @@ namespace TSC {
         // editor path identifier text changed event
         bool Editor_Path_Identifier_Text_Changed(const CEGUI::EventArgs& event);
 
-        CEGUI::Editbox* mp_path_ident_box;
-        CEGUI::Editbox* mp_destination_level_box;
-        CEGUI::Combobox* mp_direction_combobox;
+        // editor widgets, shared as only one object is edited at a time
+        static CEGUI::Editbox* mp_path_ident_box;
+        static CEGUI::Editbox* mp_destination_level_box;
+        static CEGUI::Combobox* mp_direction_combobox;
 
         // level exit type
         Level_Exit_type m_exit_type;
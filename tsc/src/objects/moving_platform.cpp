@@ -43,6 +43,10 @@ namespace TSC {
 
 /* *** *** *** *** *** *** *** cMoving_Platform *** *** *** *** *** *** *** *** *** *** */
 
+CEGUI::Editbox* cMoving_Platform::mp_path_box = NULL;
+CEGUI::Editbox* cMoving_Platform::mp_distance_box = NULL;
+CEGUI::Combobox* cMoving_Platform::mp_direction_box = NULL;
+
 cMoving_Platform::cMoving_Platform(cSprite_Manager* sprite_manager)
     : cMovingSprite(sprite_manager, "moving_platform"), m_path_state(sprite_manager)
 {
@@ -146,10 +150,6 @@ void cMoving_Platform::Init(void)
     Set_Image_Top_Right(utf8_to_path("ground/green_1/slider/1/brown/right.png"));
     Set_Image(m_left_image.m_image, 1);
 
-    mp_path_box      = NULL;
-    mp_distance_box  = NULL;
-    mp_direction_box = NULL;
-
     Update_Rect();
 }
 
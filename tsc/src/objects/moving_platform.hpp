@@ -159,9 +159,10 @@ namespace TSC {
         bool Editor_Shake_Time_Text_Changed(const CEGUI::EventArgs& event);
         bool Editor_Touch_Move_Time_Text_Changed(const CEGUI::EventArgs& event);
 
-        CEGUI::Editbox* mp_path_box;
-        CEGUI::Editbox* mp_distance_box;
-        CEGUI::Combobox* mp_direction_box;
+        // editor widgets, shared as only one object is edited at a time
+        static CEGUI::Editbox* mp_path_box;
+        static CEGUI::Editbox* mp_distance_box;
+        static CEGUI::Combobox* mp_direction_box;
 
         // platform moving type
         Moving_Platform_Type m_move_type;
@@ -708,9 +708,14 @@ cObjectCollisionType* cMovingSprite::Collision_Check(const GL_rect& new_rect, co
         return col_list;
     }
 
+    // objects touching the rect
+    cSprite_List touching_objects;
+
     // if no object list is given get all objects available
     if (!objects) {
-        objects = &m_sprite_manager->objects;
+        // preselected by the spatial index and the static collision shapes
+        m_sprite_manager->Get_Touching_Objects(touching_objects, new_rect, this);
+        objects = &touching_objects;
 
         // Player
         if (m_type != TYPE_PLAYER && new_rect.Intersects(pActive_Player->m_col_rect)) {
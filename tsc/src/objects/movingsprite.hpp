@@ -282,13 +282,6 @@ namespace TSC {
         // maximum gravity velocity
         float m_gravity_max;
 
-        // current direction
-        ObjectDirection m_direction;
-        // start direction
-        ObjectDirection m_start_direction;
-
-        // can be on a ground object
-        bool m_can_be_on_ground;
         // colliding ground object
         cSprite* m_ground_object;
 
@@ -296,11 +289,19 @@ namespace TSC {
          * look at the definitions
          */
         Moving_state m_state;
+        // current direction
+        ObjectDirection m_direction;
 
-        // ice resistance
-        float m_ice_resistance;
         // time counter if frozen
         float m_freeze_counter;
+        // ice resistance
+        float m_ice_resistance;
+
+        // can be on a ground object
+        bool m_can_be_on_ground;
+
+        // start direction
+        ObjectDirection m_start_direction;
 
     private:
         /* moves in steps and checks in both directions simultaneous
@@ -114,11 +114,14 @@ cPath* cPath_State::Get_Path_Object(const std::string& identifier)
         return NULL;
     }
 
+    cSprite_List paths;
+    m_sprite_manager->Get_Objects_by_Type(TYPE_PATH, paths);
+
     // Search for path
-    for (cSprite_List::iterator itr = m_sprite_manager->objects.begin(); itr != m_sprite_manager->objects.end(); ++itr) {
+    for (cSprite_List::iterator itr = paths.begin(); itr != paths.end(); ++itr) {
         cSprite* obj = (*itr);
 
-        if (obj->m_type != TYPE_PATH || obj->m_auto_destroy) {
+        if (obj->m_auto_destroy) {
             continue;
         }
 
@@ -419,6 +422,12 @@ void cPath_Segment::Update(void)
 
 /* *** *** *** *** *** *** *** Path class *** *** *** *** *** *** *** *** *** *** */
 
+CEGUI::Combobox* cPath::mp_segment_box = NULL;
+CEGUI::Editbox* cPath::mp_x1_box = NULL;
+CEGUI::Editbox* cPath::mp_x2_box = NULL;
+CEGUI::Editbox* cPath::mp_y1_box = NULL;
+CEGUI::Editbox* cPath::mp_y2_box = NULL;
+
 cPath::cPath(cSprite_Manager* sprite_manager)
     : cSprite(sprite_manager, "path")
 {
@@ -492,12 +501,6 @@ void cPath::Init(void)
     m_rewind = 0;
     m_editor_color = Color(static_cast<uint8_t>(100), 150, 200, 128);
     m_editor_selected_segment = 0;
-
-    mp_x1_box      = NULL;
-    mp_x2_box      = NULL;
-    mp_y1_box      = NULL;
-    mp_y2_box      = NULL;
-    mp_segment_box = NULL;
 }
 
 cPath* cPath::Copy(void) const
@@ -220,11 +220,12 @@ namespace TSC {
         // set linked path states to move again from start of the current segment
         void Editor_Segment_Pos_Changed(void);
 
-        CEGUI::Combobox* mp_segment_box;
-        CEGUI::Editbox* mp_x1_box;
-        CEGUI::Editbox* mp_x2_box;
-        CEGUI::Editbox* mp_y1_box;
-        CEGUI::Editbox* mp_y2_box;
+        // editor widgets, shared as only one object is edited at a time
+        static CEGUI::Combobox* mp_segment_box;
+        static CEGUI::Editbox* mp_x1_box;
+        static CEGUI::Editbox* mp_x2_box;
+        static CEGUI::Editbox* mp_y1_box;
+        static CEGUI::Editbox* mp_y2_box;
 
         // string identifier (so objects can link to us)
         std::string m_identifier;
@@ -313,32 +313,38 @@ const float cSprite::m_pos_z_player = 0.0999f;
 const float cSprite::m_pos_z_delta = 0.000001f;
 
 cSprite::cSprite(cSprite_Manager* sprite_manager, const std::string type_name /* = "sprite" */)
-    : cCollidingSprite(sprite_manager), m_type_name(type_name)
+    : cCollidingSprite(sprite_manager), m_registered_type(-1), m_registered_array(-1), m_type_slot(0), m_array_slot(0),
+      m_type_name(type_name), mp_editor_data(NULL)
 {
     cSprite::Init();
 }
 
 cSprite::cSprite(XmlAttributes& attributes, cSprite_Manager* sprite_manager, const std::string type_name /* = "sprite" */)
-    : cCollidingSprite(sprite_manager), m_type_name(type_name)
+    : cCollidingSprite(sprite_manager), m_registered_type(-1), m_registered_array(-1), m_type_slot(0), m_array_slot(0),
+      m_type_name(type_name), mp_editor_data(NULL)
 {
     cSprite::Init();
 
     // position
     Set_Pos(string_to_float(attributes["posx"]), string_to_float(attributes["posy"]), true);
     // image
-    m_image_filename = attributes["image"];
-    if(utf8_to_path(m_image_filename).extension() == utf8_to_path(".png")) {
+    std::string image_filename = attributes["image"];
+    if(utf8_to_path(image_filename).extension() == utf8_to_path(".png")) {
         Set_Image(pVideo->Get_Surface(utf8_to_path(attributes["image"])), true) ;
     }
     else {
-        if (Add_Image_Set("main", utf8_to_path(m_image_filename)))
+        if (Add_Image_Set("main", utf8_to_path(image_filename)))
             Set_Image_Set("main", true);
         else { // level XML points to invalid file
-            std::cerr << "Warning: Level XML is invalid -- file does not load: " << m_image_filename << std::endl;
-            m_image_filename = "game/image_not_found.png";
-            Set_Image(pVideo->Get_Surface(utf8_to_path(m_image_filename)));
+            std::cerr << "Warning: Level XML is invalid -- file does not load: " << image_filename << std::endl;
+            image_filename = "game/image_not_found.png";
+            Set_Image(pVideo->Get_Surface(utf8_to_path(image_filename)));
         }
     }
+    // only kept if it differs from the start image filename saved by default
+    if (editor_enabled || !m_start_image || m_start_image->m_path != pResource_Manager->Get_Game_Pixmaps_Directory() / utf8_to_path(image_filename)) {
+        Set_Image_Filename(image_filename);
+    }
     // Massivity.
     // FIXME: Should be separate "massivity" attribute or so.
     Set_Massive_Type(Get_Massive_Type_Id(attributes["type"]));
@@ -350,6 +356,8 @@ cSprite::~cSprite(void)
         delete m_image;
         m_image = NULL;
     }
+
+    delete mp_editor_data;
 }
 
 void cSprite::Init(void)
@@ -403,6 +411,8 @@ void cSprite::Init(void)
     m_pos_x = 0.0f;
     m_pos_y = 0.0f;
     m_pos_z = 0.0f;
+    m_prev_pos_x = 0.0f;
+    m_prev_pos_y = 0.0f;
     m_editor_pos_z = 0.0f;
 
     m_massive_type = MASS_PASSIVE;
@@ -411,6 +421,10 @@ void cSprite::Init(void)
     m_suppress_save = 0;
     m_camera_range = 1000;
     m_can_be_ground = 0;
+    m_collision_baked = 0;
+    m_render_cached = 0;
+    m_spatial_indexed = 0;
+    m_manager_order = 0;
     m_disallow_managed_delete = 0;
 
     // rotation
@@ -443,7 +457,7 @@ cSprite* cSprite::Copy(void) const
     cSprite* basic_sprite = new cSprite(m_sprite_manager);
  
     // current image
-    basic_sprite->m_image_filename = m_image_filename;
+    basic_sprite->Set_Image_Filename(Get_Image_Filename());
     basic_sprite->Set_Image(m_start_image, true);
 
     // animation details
@@ -456,7 +470,9 @@ cSprite* cSprite::Copy(void) const
     basic_sprite->m_anim_last_ticks = m_anim_last_ticks;
     basic_sprite->m_anim_mod = m_anim_mod;
     basic_sprite->m_images = m_images;
-    basic_sprite->m_named_ranges = m_named_ranges;
+    if (mp_named_ranges) {
+        basic_sprite->mp_named_ranges = new Name_Map(*mp_named_ranges);
+    }
 
     // basic settings
     basic_sprite->Set_Pos(m_start_pos_x, m_start_pos_y, 1);
@@ -504,8 +520,8 @@ xmlpp::Element* cSprite::Save_To_XML_Node(xmlpp::Element* p_element)
 
     // image
     boost::filesystem::path img_filename;
-    if (!m_image_filename.empty())
-        img_filename = utf8_to_path(m_image_filename);
+    if (mp_editor_data && !mp_editor_data->m_image_filename.empty())
+        img_filename = utf8_to_path(mp_editor_data->m_image_filename);
     else if (m_start_image)
         img_filename = m_start_image->m_path;
     else if (m_image)
@@ -609,13 +625,9 @@ void cSprite::Set_Image(cGL_Surface* new_image, bool new_start_image /* = 0 */,
         m_delete_image = del_img;
 
         // if no name is set use the first image name
-        if (m_name.empty()) {
+        if (m_name.empty() && !Is_Basic_Sprite()) {
             m_name = m_image->m_name;
         }
-        // if no editor tags are set use the first image editor tags
-        if (m_editor_tags.empty()) {
-            m_editor_tags = m_image->m_editor_tags;
-        }
     }
     else {
         // clear image data
@@ -633,11 +645,6 @@ void cSprite::Set_Image(cGL_Surface* new_image, bool new_start_image /* = 0 */,
         if (m_start_image) {
             m_start_rect.m_w = m_start_image->m_w;
             m_start_rect.m_h = m_start_image->m_h;
-
-            // always set the image name for basic sprites
-            if (Is_Basic_Sprite()) {
-                m_name = m_start_image->m_name;
-            }
         }
         else {
             m_start_rect.m_w = 0.0f;
@@ -652,6 +659,8 @@ void cSprite::Set_Image(cGL_Surface* new_image, bool new_start_image /* = 0 */,
 void cSprite::Set_Sprite_Type(SpriteType type)
 {
     m_type = type;
+
+    m_sprite_manager->Type_Changed(this);
 }
 
 /**
@@ -736,6 +745,8 @@ void cSprite::Set_Active(bool enabled)
 
     Update_Valid_Draw();
     Update_Valid_Update();
+    Render_Cache_Changed();
+    Static_Collision_Changed();
 }
 
 /** Set a Color Combination ( GL_ADD, GL_MODULATE or GL_REPLACE ).
@@ -755,6 +766,8 @@ void cSprite::Set_Color_Combine(const float red, const float green, const float
     m_combine_color[0] = Clamp(red, 0.000001f, 1.0f);
     m_combine_color[1] = Clamp(green, 0.000001f, 1.0f);
     m_combine_color[2] = Clamp(blue, 0.000001f, 1.0f);
+
+    Render_Cache_Changed();
 }
 
 void cSprite::Update_Rect_Rotation_Z(void)
@@ -808,7 +821,11 @@ void cSprite::Set_Rotation_X(float rot, bool new_start_rot /* = 0 */)
 
     if (m_rotation_affects_rect) {
         Update_Rect_Rotation_X();
+        Spatial_Index_Changed();
+        Static_Collision_Changed();
     }
+
+    Render_Cache_Changed();
 }
 
 void cSprite::Set_Rotation_Y(float rot, bool new_start_rot /* = 0 */)
@@ -821,7 +838,11 @@ void cSprite::Set_Rotation_Y(float rot, bool new_start_rot /* = 0 */)
 
     if (m_rotation_affects_rect) {
         Update_Rect_Rotation_Y();
+        Spatial_Index_Changed();
+        Static_Collision_Changed();
     }
+
+    Render_Cache_Changed();
 }
 
 void cSprite::Set_Rotation_Z(float rot, bool new_start_rot /* = 0 */)
@@ -834,7 +855,11 @@ void cSprite::Set_Rotation_Z(float rot, bool new_start_rot /* = 0 */)
 
     if (m_rotation_affects_rect) {
         Update_Rect_Rotation_Z();
+        Spatial_Index_Changed();
+        Static_Collision_Changed();
     }
+
+    Render_Cache_Changed();
 }
 void cSprite::Set_Scale_X(const float scale, const bool new_startscale /* = 0 */)
 {
@@ -860,6 +885,10 @@ void cSprite::Set_Scale_X(const float scale, const bool new_startscale /* = 0 */
     if (new_startscale) {
         m_start_scale_x = m_scale_x;
     }
+
+    Render_Cache_Changed();
+    Spatial_Index_Changed();
+    Static_Collision_Changed();
 }
 
 void cSprite::Set_Scale_Y(const float scale, const bool new_startscale /* = 0 */)
@@ -886,6 +915,10 @@ void cSprite::Set_Scale_Y(const float scale, const bool new_startscale /* = 0 */
     if (new_startscale) {
         m_start_scale_y = m_scale_y;
     }
+
+    Render_Cache_Changed();
+    Spatial_Index_Changed();
+    Static_Collision_Changed();
 }
 void cSprite::Set_On_Top(const cSprite* sprite, bool optimize_hor_pos /* = 1 */)
 {
@@ -942,6 +975,24 @@ void cSprite::Update_Position_Rect(void)
     }
 
     Update_Valid_Draw();
+    Render_Cache_Changed();
+    Spatial_Index_Changed();
+    Static_Collision_Changed();
+}
+
+void cSprite::Invalidate_Render_Cache(void)
+{
+    m_sprite_manager->m_static_render_cache.Invalidate(this);
+}
+
+void cSprite::Invalidate_Spatial_Index(void)
+{
+    m_sprite_manager->m_spatial_index.Changed(this);
+}
+
+void cSprite::Invalidate_Static_Collision(void)
+{
+    m_sprite_manager->m_static_collision.Remove(this);
 }
 
 void cSprite::Update_Valid_Draw(void)
@@ -960,7 +1011,10 @@ void cSprite::Draw(cSurface_Request* request /* = NULL */)
         return;
     }
 
-    Draw_Image(request);
+    // the image is drawn by the static render cache
+    if (!m_render_cached || request) {
+        Draw_Image(request);
+    }
 
     // draw debugging collision rects
     if (game_debug) {
@@ -1062,11 +1116,13 @@ void cSprite::Draw_Image(cSurface_Request* request /* = NULL */) const
 void cSprite::Draw_Image_Normal(cSurface_Request* request /* = NULL */) const
 {
     // texture id
-    request->m_texture_id = m_image->m_image;
+    request->m_texture_id = m_image->Get_Texture();
 
     // size
     request->m_w = m_image->m_start_w;
     request->m_h = m_image->m_start_h;
+    request->m_tex_part_w = m_image->m_tex_part_w;
+    request->m_tex_part_h = m_image->m_tex_part_h;
 
     // rotation
     request->m_rot_x += m_rot_x + m_image->m_base_rot_x;
@@ -1154,11 +1210,13 @@ void cSprite::Draw_Image_Normal(cSurface_Request* request /* = NULL */) const
 void cSprite::Draw_Image_Editor(cSurface_Request* request /* = NULL */) const
 {
     // texture id
-    request->m_texture_id = m_start_image->m_image;
+    request->m_texture_id = m_start_image->Get_Texture();
 
     // size
     request->m_w = m_start_image->m_start_w;
     request->m_h = m_start_image->m_start_h;
+    request->m_tex_part_w = m_start_image->m_tex_part_w;
+    request->m_tex_part_h = m_start_image->m_tex_part_h;
 
     // rotation
     request->m_rot_x += m_start_rot_x + m_start_image->m_base_rot_x;
@@ -1285,8 +1343,13 @@ void cSprite::Set_Massive_Type(MassiveType type)
         m_can_be_ground = false;
     }
 
+    m_sprite_manager->Type_Changed(this);
+
     // make it the latest sprite
     m_sprite_manager->Move_To_Back(this);
+
+    Render_Cache_Changed();
+    Static_Collision_Changed();
 }
 
 bool cSprite::Is_On_Top(const cSprite* obj) const
@@ -1509,14 +1572,69 @@ bool cSprite::Editor_Image_Text_Changed(const CEGUI::EventArgs& event)
     return 1;
 }
 
+std::string cSprite::Get_Editor_Tags(void) const
+{
+    if (mp_editor_data && !mp_editor_data->m_editor_tags.empty()) {
+        return mp_editor_data->m_editor_tags;
+    }
+
+    // use the image editor tags
+    if (m_start_image) {
+        return m_start_image->m_editor_tags;
+    }
+    else if (m_image) {
+        return m_image->m_editor_tags;
+    }
+
+    return "";
+}
+
+void cSprite::Set_Editor_Tags(const std::string& tags)
+{
+    if (!mp_editor_data) {
+        mp_editor_data = new cSprite_Editor_Data();
+    }
+
+    mp_editor_data->m_editor_tags = tags;
+}
+
+std::string cSprite::Get_Image_Filename(void) const
+{
+    if (mp_editor_data) {
+        return mp_editor_data->m_image_filename;
+    }
+
+    return "";
+}
+
+void cSprite::Set_Image_Filename(const std::string& filename)
+{
+    if (!mp_editor_data) {
+        // nothing to store
+        if (filename.empty()) {
+            return;
+        }
+
+        mp_editor_data = new cSprite_Editor_Data();
+    }
+
+    mp_editor_data->m_image_filename = filename;
+}
+
 /**
  * This method should append all necessary components
  * to m_name and return the result as a new string.
  * This is how the object is presented to the user
- * in the editor. By default it just returns `m_name`.
+ * in the editor. By default it just returns `m_name`,
+ * or the start image name if no name is set.
  */
 std::string cSprite::Create_Name() const
 {
+    // basic sprites don't store a name of their own
+    if (m_name.empty() && m_start_image) {
+        return m_start_image->m_name;
+    }
+
     return m_name;
 }
 
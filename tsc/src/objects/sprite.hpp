@@ -112,6 +112,19 @@ namespace TSC {
         cObjectCollision_List m_collisions;
     };
 
+    /* *** *** *** *** *** *** *** cSprite_Editor_Data *** *** *** *** *** *** *** *** *** *** */
+
+    /* Sprite data only needed by the editor and for saving. It is kept
+     * out of cSprite and allocated on first write so normal gameplay
+     * does not carry it around in every object.
+    */
+    struct cSprite_Editor_Data {
+        /// sprite editor tags. See cEditor::load_special_items().
+        std::string m_editor_tags;
+        /// image filename as given in the level file
+        std::string m_image_filename;
+    };
+
     /* *** *** *** *** *** *** *** cSprite *** *** *** *** *** *** *** *** *** *** */
 
     class cSprite : public cCollidingSprite, public cImageSet {
@@ -122,6 +135,9 @@ namespace TSC {
         cSprite(XmlAttributes& attributes, cSprite_Manager* sprite_manager, const std::string type_name = "sprite");
         // destructor
         virtual ~cSprite(void);
+        // sprites own their editor data, use Copy() instead
+        cSprite(const cSprite& other) = delete;
+        cSprite& operator=(const cSprite& other) = delete;
 
         // initialize defaults
         virtual void Init(void);
@@ -151,7 +167,7 @@ namespace TSC {
         virtual std::string Get_Identity()
         {
             std::stringstream ss;
-            ss << "sprite type " << m_type << ", name " << m_name.c_str();
+            ss << "sprite type " << m_type << ", name " << Create_Name().c_str();
             return ss.str();
         }
 
@@ -199,11 +215,13 @@ namespace TSC {
         inline void Set_Shadow_Pos(const float pos)
         {
             m_shadow_pos = pos;
+            Render_Cache_Changed();
         };
         // Set the shadow color
         inline void Set_Shadow_Color(const Color& shadow)
         {
             m_shadow_color = shadow;
+            Render_Cache_Changed();
         };
         // Set image color
         inline void Set_Color(const uint8_t red, const uint8_t green, const uint8_t blue, const uint8_t alpha = 255)
@@ -212,10 +230,12 @@ namespace TSC {
             m_color.green = green;
             m_color.blue = blue;
             m_color.alpha = alpha;
+            Render_Cache_Changed();
         };
         inline void Set_Color(const Color& col)
         {
             m_color = col;
+            Render_Cache_Changed();
         };
 
         /// Set a Color Combination ( GL_ADD, GL_MODULATE or GL_REPLACE )
@@ -365,6 +385,27 @@ namespace TSC {
 
         // Update the position rect values
         void Update_Position_Rect(void);
+        // Tell the static render cache that the drawing of this sprite changed
+        inline void Render_Cache_Changed(void)
+        {
+            if (m_render_cached) {
+                Invalidate_Render_Cache();
+            }
+        };
+        // Tell the spatial index that the rect of this sprite changed
+        inline void Spatial_Index_Changed(void)
+        {
+            if (m_spatial_indexed) {
+                Invalidate_Spatial_Index();
+            }
+        };
+        // Tell the static collision map that the collision of this sprite changed
+        inline void Static_Collision_Changed(void)
+        {
+            if (m_collision_baked) {
+                Invalidate_Static_Collision();
+            }
+        };
         // default update, derived updates should not call this again if they also call Update_Animation()
         virtual void Update(void) { Update_Animation(); };
         /* late update
@@ -452,17 +493,27 @@ namespace TSC {
         // editor image text changed event
         bool Editor_Image_Text_Changed(const CEGUI::EventArgs& event);
 
-        /// current image used for drawing
-        cGL_Surface* m_image;
-        /// editor and first image
-        cGL_Surface* m_start_image;
-        /// image filename
-        std::string m_image_filename;
+        /* Return the editor tags. Only populated and used in relation
+         * with the editor's object menu. If none were set the tags of
+         * the start image are returned.
+        */
+        std::string Get_Editor_Tags(void) const;
+        // Set the editor tags
+        void Set_Editor_Tags(const std::string& tags);
+        // Return the image filename as given in the level file or an empty string
+        std::string Get_Image_Filename(void) const;
+        // Set the image filename saved to the level file
+        void Set_Image_Filename(const std::string& filename);
+
+        /* The members below are ordered by access frequency: everything
+         * touched by Update_Items(), Draw_Items() and Collision_Check()
+         * comes first so it shares as few cache lines as possible, and
+         * editor, start and save data follows. Keep it this way when
+         * adding new members.
+         */
 
         /// complete image rect
         GL_rect m_rect;
-        /// editor and first image rect
-        GL_rect m_start_rect;
         /// collision rect
         GL_rect m_col_rect;
         /// collision start point
@@ -472,20 +523,65 @@ namespace TSC {
         float m_pos_x;
         float m_pos_y;
         float m_pos_z;
-        /// start position
-        float m_start_pos_x;
-        float m_start_pos_y;
-        /** editor z position
-         * it's only used if not 0
-        */
-        float m_editor_pos_z;
+        /// position before the last simulation step, for drawing between both
+        float m_prev_pos_x;
+        float m_prev_pos_y;
+
+        /// current image used for drawing
+        cGL_Surface* m_image;
+
+        /// sprite type
+        SpriteType m_type;
+        /// sprite array type
+        ArrayType m_sprite_array;
+        /// massive collision type
+        MassiveType m_massive_type;
 
+        /// if true we are active and can be updated and drawn
+        bool m_active;
+        /// if drawing is valid
+        bool m_valid_draw;
+        /// if updating is valid
+        bool m_valid_update;
+        /** if true this sprite is not used anywhere anymore
+         * and is ready to be replaced with a new sprite
+         * should not be used for objects needed by the editor
+         * should be used for not active spawned objects
+        */
+        bool m_auto_destroy;
+        /// true if not using the camera position
+        bool m_no_camera;
+        /// can be used as ground object
+        bool m_can_be_ground;
+        /// if set the collision rect is part of a cStatic_Collision_Map shape
+        bool m_collision_baked;
+        /// if set the image is drawn by a cStatic_Render_Cache chunk
+        bool m_render_cached;
+        /// if set the sprite is in a cSpatial_Index cell
+        bool m_spatial_indexed;
         /// if set rotation not only affects the image but also the rectangle
         bool m_rotation_affects_rect;
-        /// editor and start rotation
-        float m_start_rot_x;
-        float m_start_rot_y;
-        float m_start_rot_z;
+        /// if set scale not only affects the image but also the rectangle
+        bool m_scale_affects_rect;
+        /** which parts of the image get scaled
+         * if all are set scaling is centered
+        */
+        bool m_scale_up;
+        bool m_scale_down;
+        bool m_scale_left;
+        bool m_scale_right;
+
+        /// maximum distance to the camera to get updated
+        unsigned int m_camera_range;
+        /// sprite manager array order, increasing with the array position but not contiguous
+        int m_manager_order;
+        /// type and sprite array registered with in the sprite manager, -1 if not registered
+        int m_registered_type;
+        int m_registered_array;
+        /// position in the sprite manager type and sprite array registries
+        unsigned int m_type_slot;
+        unsigned int m_array_slot;
+
         /// X rotation. Can only be "0" (no rotation) or "180" (mirror on X axis).
         float m_rot_x;
         /// Y rotation. Can only be "0" (no rotation) or "180" (mirror on Y axis).
@@ -497,80 +593,56 @@ namespace TSC {
         // to m_mirror_x and m_mirror_y, m_rot_z should be renamed
         // to m_rot(ation).
 
-        /// if set scale not only affects the image but also the rectangle
-        bool m_scale_affects_rect;
-        /** which parts of the image get scaled
-         * if all are set scaling is centered
-        */
-        bool m_scale_up;
-        bool m_scale_down;
-        bool m_scale_left;
-        bool m_scale_right;
-        /// editor and start scale
-        float m_start_scale_x;
-        float m_start_scale_y;
         /// scale
         float m_scale_x;
         float m_scale_y;
 
         /// color
         Color m_color;
+        /// shadow color
+        Color m_shadow_color;
+        /// shadow position
+        float m_shadow_pos;
         /// combine type
         GLint m_combine_type;
         /// combine color
         float m_combine_color[3];
 
-        /// sprite type
-        SpriteType m_type;
-        /// internal type name
-        const std::string m_type_name;
-        /// sprite array type
-        ArrayType m_sprite_array;
-        /// massive collision type
-        MassiveType m_massive_type;
+        /// editor and first image
+        cGL_Surface* m_start_image;
+        /// editor and first image rect
+        GL_rect m_start_rect;
+        /// start position
+        float m_start_pos_x;
+        float m_start_pos_y;
+        /** editor z position
+         * it's only used if not 0
+        */
+        float m_editor_pos_z;
 
-        /// sprite editor tags. Only populated and used in relation
-        /// with the editor's object menu. See
-        /// cEditor::load_special_items() function. In normal
-        /// gameplay, this is empty.
-        std::string m_editor_tags;
+        /// editor and start rotation
+        float m_start_rot_x;
+        float m_start_rot_y;
+        float m_start_rot_z;
+        /// editor and start scale
+        float m_start_scale_x;
+        float m_start_scale_y;
 
-        /// true if not using the camera position
-        bool m_no_camera;
-        /// if true we are active and can be updated and drawn
-        bool m_active;
         /// if spawned
         bool m_spawned;
         /// enable to prevent a spawned object from being saved
         bool m_suppress_save;
-        /// maximum distance to the camera to get updated
-        unsigned int m_camera_range;
-        /// can be used as ground object
-        bool m_can_be_ground;
-
         /// delete the given image when it gets unloaded
         bool m_delete_image;
         /// if this can not be auto-deleted because the object is controlled from elsewhere
         bool m_disallow_managed_delete;
-        /** if true this sprite is not used anywhere anymore
-         * and is ready to be replaced with a new sprite
-         * should not be used for objects needed by the editor
-         * should be used for not active spawned objects
-        */
-        bool m_auto_destroy;
-        /// shadow position
-        float m_shadow_pos;
-        /// shadow color
-        Color m_shadow_color;
-
-        /// if drawing is valid
-        bool m_valid_draw;
-        /// if updating is valid
-        bool m_valid_update;
 
         /// ID to uniquely identify this sprite (UIDS[idhere] uses this)
         int m_uid;
 
+        /// internal type name
+        const std::string m_type_name;
+
         static const float m_pos_z_passive_start; ///< Start Z position for passive elements
         static const float m_pos_z_massive_start; ///< Start Z position for massive elements
         static const float m_pos_z_front_passive_start; ///< Start Z position for front passive elements
@@ -588,6 +660,17 @@ namespace TSC {
 
         /// XML type property.
         virtual std::string Get_XML_Type_Name();
+
+    private:
+        /// editor only data, NULL until first set
+        cSprite_Editor_Data* mp_editor_data;
+
+        // Mark the static render cache chunk of this sprite for recompiling
+        void Invalidate_Render_Cache(void);
+        // Move this sprite out of its spatial index cell
+        void Invalidate_Spatial_Index(void);
+        // Take this sprite out of its static collision shape
+        void Invalidate_Static_Collision(void);
     };
 
     typedef vector<cSprite*> cSprite_List;
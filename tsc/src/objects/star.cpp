@@ -178,8 +178,7 @@ void cjStar::Generate_Particles(float x /* = 0.0f */, float y /* = 0.0f */, bool
     particle_color.blue += static_cast<uint8_t>(m_glim_counter / 1.5f);
 
     // create emitter
-    cParticle_Emitter* anim = new cParticle_Emitter(m_sprite_manager);
-    anim->Set_Image(pVideo->Get_Surface("animation/particles/light.png"));
+    cParticle_Emitter* anim = pActive_Animation_Manager->Get_Effect(EFFECT_STAR_BURST, m_sprite_manager);
     anim->Set_Pos_Z(m_pos_z + 0.0001f);
 
     if (random) {
@@ -192,14 +191,7 @@ void cjStar::Generate_Particles(float x /* = 0.0f */, float y /* = 0.0f */, bool
         anim->Set_Direction_Range(180, 180);
     }
     anim->Set_Quota(quota);
-    anim->Set_Time_to_Live(0.4f);
-    anim->Set_Fading_Alpha(1);
-    anim->Set_Fading_Size(1);
-    anim->Set_Speed(1.5f, 0.5f);
-    anim->Set_Scale(0.15f);
     anim->Set_Color(particle_color);
-    anim->Set_Blending(BLEND_ADD);
-    anim->Set_Const_Rotation_Z(-5, 10);
     anim->Emit();
     pActive_Animation_Manager->Add(anim);
 }
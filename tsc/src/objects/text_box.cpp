@@ -22,6 +22,7 @@
 #include "../input/joystick.hpp"
 #include "../core/main.hpp"
 #include "../input/keyboard.hpp"
+#include "../input/input_recorder.hpp"
 #include "../core/i18n.hpp"
 #include "../audio/audio.hpp"
 #include "../level/level.hpp"
@@ -145,7 +146,7 @@ void cText_Box::Activate(void)
     bool display = 1;
 
     while (display) {
-        while (pVideo->PollEvent(input_event)) {
+        while (pInput_Recorder->Poll_Event(input_event)) {
             if (input_event.type == sf::Event::KeyPressed) {
 
                 // exit keys
@@ -178,11 +179,11 @@ void cText_Box::Activate(void)
         }
 
         // down
-        if (sf::Keyboard::isKeyPressed(pPreferences->m_key_down) || pJoystick->Down()) {
+        if (pKeyboard->Is_Key_Down(pPreferences->m_key_down) || pJoystick->Down()) {
             editbox->getVertScrollbar()->setScrollPosition(editbox->getVertScrollbar()->getScrollPosition() + (editbox->getVertScrollbar()->getStepSize() * 0.25f * pFramerate->m_speed_factor));
         }
         // up
-        if (sf::Keyboard::isKeyPressed(pPreferences->m_key_up) || pJoystick->Up()) {
+        if (pKeyboard->Is_Key_Down(pPreferences->m_key_up) || pJoystick->Up()) {
             editbox->getVertScrollbar()->setScrollPosition(editbox->getVertScrollbar()->getScrollPosition() - (editbox->getVertScrollbar()->getStepSize() * 0.25f * pFramerate->m_speed_factor));
         }
 
@@ -207,6 +208,7 @@ void cText_Box::Activate(void)
         // render
         pVideo->Render();
         pFramerate->Update();
+        pInput_Recorder->Blocking_Frame();
     }
 
     wmgr.destroyWindow(editbox);
@@ -29,6 +29,7 @@
 #include "../input/joystick.hpp"
 #include "../input/keyboard.hpp"
 #include "../level/level.hpp"
+#include "../level/level_manager.hpp"
 #include "../core/i18n.hpp"
 #include "../core/filesystem/filesystem.hpp"
 #include "../core/filesystem/resource_manager.hpp"
@@ -460,7 +461,7 @@ void cOverworld::Draw_Layer_1(void)
 
 void cOverworld::Process_Input()
 {
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::O) && sf::Keyboard::isKeyPressed(sf::Keyboard::M) && !editor_world_enabled) {
+    if (pKeyboard->Is_Key_Down(sf::Keyboard::O) && pKeyboard->Is_Key_Down(sf::Keyboard::M) && !editor_world_enabled) {
         if (m_cheat_counter > 50.0f) {
             // all waypoint access
             gp_hud->Set_Text(_("Omega Mode unlocks all waypoints"));
@@ -505,6 +506,9 @@ void cOverworld::Update(void)
     // Editor
     pWorld_Editor->Update();
 
+    // read the level of the current waypoint in the background
+    pLevel_Manager->Update_Prefetch();
+
     // update performance timer
     pFramerate->m_perf_timer[PERF_UPDATE_OVERWORLD]->Update();
 }
@@ -517,16 +521,16 @@ void cOverworld::Update_Camera(void)
 
     // todo : move to a Process_Input function
     if (pOverworld_Manager->m_camera_mode) {
-        if (sf::Keyboard::isKeyPressed(pPreferences->m_key_right) || pJoystick->Right()) {
+        if (pKeyboard->Is_Key_Down(pPreferences->m_key_right) || pJoystick->Right()) {
             pOverworld_Manager->m_camera->Move(pFramerate->m_speed_factor * 15, 0);
         }
-        else if (sf::Keyboard::isKeyPressed(pPreferences->m_key_left) || pJoystick->Left()) {
+        else if (pKeyboard->Is_Key_Down(pPreferences->m_key_left) || pJoystick->Left()) {
             pOverworld_Manager->m_camera->Move(pFramerate->m_speed_factor * -15, 0);
         }
-        if (sf::Keyboard::isKeyPressed(pPreferences->m_key_up) || pJoystick->Up()) {
+        if (pKeyboard->Is_Key_Down(pPreferences->m_key_up) || pJoystick->Up()) {
             pOverworld_Manager->m_camera->Move(0, pFramerate->m_speed_factor * -15);
         }
-        else if (sf::Keyboard::isKeyPressed(pPreferences->m_key_down) || pJoystick->Down()) {
+        else if (pKeyboard->Is_Key_Down(pPreferences->m_key_down) || pJoystick->Down()) {
             pOverworld_Manager->m_camera->Move(0, pFramerate->m_speed_factor * 15);
         }
     }
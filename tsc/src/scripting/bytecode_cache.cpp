@@ -0,0 +1,132 @@
+/***************************************************************************
+ * bytecode_cache.cpp - Compiled mruby scripts
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstring>
+#include <iterator>
+#include <mruby/dump.h>
+#include "bytecode_cache.hpp"
+#include "../core/property_helper.hpp"
+#include "../core/global_basic.hpp"
+
+namespace fs = boost::filesystem;
+using namespace std;
+
+namespace TSC {
+
+namespace Scripting {
+
+cBytecode_Cache* pBytecode_Cache = NULL;
+
+cBytecode_Cache::cBytecode_Cache(const fs::path& cache_dir)
+{
+    m_cache_dir = cache_dir;
+}
+
+cBytecode_Cache::~cBytecode_Cache()
+{
+    //
+}
+
+std::string cBytecode_Cache::Get_Key(const std::string& code, const std::string& contextname)
+{
+    // 64 bit FNV-1a, including the mruby version so an upgrade compiles again
+    uint64_t hash = 14695981039346656037ULL;
+    std::string versioned = std::string(MRUBY_VERSION) + '\0' + contextname + '\0';
+
+    for (std::string::const_iterator iter = versioned.begin(); iter != versioned.end(); iter++) {
+        hash = (hash ^ static_cast<unsigned char>(*iter)) * 1099511628211ULL;
+    }
+    for (std::string::const_iterator iter = code.begin(); iter != code.end(); iter++) {
+        hash = (hash ^ static_cast<unsigned char>(*iter)) * 1099511628211ULL;
+    }
+
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%016llx-%lu", static_cast<unsigned long long>(hash), static_cast<unsigned long>(code.size()));
+    return std::string(buf);
+}
+
+bool cBytecode_Cache::Is_Valid(const Bytecode& bytecode)
+{
+    if (bytecode.size() < sizeof(struct rite_binary_header))
+        return false;
+
+    const struct rite_binary_header* p_header = reinterpret_cast<const struct rite_binary_header*>(&bytecode[0]);
+
+    return memcmp(p_header->binary_ident, RITE_BINARY_IDENT, sizeof(p_header->binary_ident)) == 0 &&
+           memcmp(p_header->binary_version, RITE_BINARY_FORMAT_VER, sizeof(p_header->binary_version)) == 0;
+}
+
+const cBytecode_Cache::Bytecode* cBytecode_Cache::Get(const std::string& code, const std::string& contextname)
+{
+    std::string key = Get_Key(code, contextname);
+
+    // Already used in this game
+    std::unordered_map<std::string, Bytecode>::const_iterator iter = m_bytecode.find(key);
+    if (iter != m_bytecode.end()) {
+        return &iter->second;
+    }
+
+    // Compiled in an earlier game
+    fs::path filename = m_cache_dir / utf8_to_path(key + ".mrb");
+    fs::ifstream file(filename, ios::in | ios::binary);
+    if (!file.is_open()) {
+        return NULL;
+    }
+
+    Bytecode bytecode((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    file.close();
+
+    if (!Is_Valid(bytecode)) {
+        debug_print("Scripting engine: ignoring invalid bytecode file '%s'\n", path_to_utf8(filename).c_str());
+        return NULL;
+    }
+
+    Bytecode& cached = m_bytecode[key];
+    cached.swap(bytecode);
+    return &cached;
+}
+
+const cBytecode_Cache::Bytecode* cBytecode_Cache::Add(const std::string& code, const std::string& contextname, const uint8_t* p_bytecode, size_t size)
+{
+    std::string key = Get_Key(code, contextname);
+    Bytecode& cached = m_bytecode[key];
+    cached.assign(p_bytecode, p_bytecode + size);
+
+    // Write to a temporary file first so an interrupted write never
+    // leaves a broken .mrb file behind
+    fs::path filename = m_cache_dir / utf8_to_path(key + ".mrb");
+    fs::path tempname = m_cache_dir / utf8_to_path(key + ".tmp");
+
+    try {
+        fs::ofstream file(tempname, ios::out | ios::binary | ios::trunc);
+        if (!file.is_open()) {
+            cerr << "Scripting engine: warning: could not write bytecode cache file '" << path_to_utf8(tempname) << "'" << endl;
+            return &cached;
+        }
+
+        file.write(reinterpret_cast<const char*>(p_bytecode), size);
+        file.close();
+
+        fs::rename(tempname, filename);
+    }
+    catch (const fs::filesystem_error& err) {
+        cerr << "Scripting engine: warning: could not write bytecode cache file: " << err.what() << endl;
+    }
+
+    return &cached;
+}
+
+};
+
+};
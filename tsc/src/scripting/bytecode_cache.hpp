@@ -0,0 +1,65 @@
+/***************************************************************************
+ * bytecode_cache.hpp - Compiled mruby scripts
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TSC_BYTECODE_CACHE_HPP
+#define TSC_BYTECODE_CACHE_HPP
+#include "../core/global_basic.hpp"
+#include "../core/global_game.hpp"
+
+namespace TSC {
+    namespace Scripting {
+
+        /**
+         * Every level creates a new mruby interpreter which has to
+         * run the scripting library, the user's script packs and the
+         * level script. Compiling all of that from source again for
+         * each level is slow, so the compiled RITE bytecode of every
+         * script is kept here, keyed by a hash of its source code.
+         *
+         * The bytecode is kept in memory for the rest of the game and
+         * written as .mrb file to the user cache directory so that it
+         * is also available on the next start. A changed script simply
+         * has a different hash and is compiled again.
+         */
+        class cBytecode_Cache {
+        public:
+            typedef std::vector<uint8_t> Bytecode;
+
+            cBytecode_Cache(const boost::filesystem::path& cache_dir);
+            ~cBytecode_Cache();
+
+            // Returns the bytecode compiled from the given code or
+            // NULL if it was not compiled before. `contextname' is
+            // part of the key as the bytecode contains it for
+            // exception messages.
+            const Bytecode* Get(const std::string& code, const std::string& contextname);
+            // Store the bytecode compiled from the given code and
+            // return the stored copy.
+            const Bytecode* Add(const std::string& code, const std::string& contextname, const uint8_t* p_bytecode, size_t size);
+        private:
+            // Returns the key for the given code.
+            static std::string Get_Key(const std::string& code, const std::string& contextname);
+            // Returns true if the bytecode was created by this mruby version.
+            static bool Is_Valid(const Bytecode& bytecode);
+
+            boost::filesystem::path m_cache_dir;
+            std::unordered_map<std::string, Bytecode> m_bytecode;
+        };
+
+        // The bytecode cache shared by all interpreters
+        extern cBytecode_Cache* pBytecode_Cache;
+    };
+};
+
+#endif
@@ -94,7 +94,7 @@ static mrb_value Kill_With_Points(mrb_state* p_state,  mrb_value self)
     gp_hud->Add_Points(p_enemy->m_kill_points,
                             p_enemy->m_pos_x,
                             p_enemy->m_pos_y - 5.0f);
-    pAudio->Play_Sound(p_enemy->m_kill_sound);
+    pAudio->Play_Sound(p_enemy->Get_Kill_Sound_Handle());
     p_enemy->Set_Dead(true);
 
     return mrb_nil_value();
@@ -181,7 +181,7 @@ static mrb_value Set_Kill_Sound(mrb_state* p_state,  mrb_value self)
     cEnemy* p_enemy = Get_Data_Ptr<cEnemy>(p_state, self);
     char* path;
     mrb_get_args(p_state, "z", &path);
-    p_enemy->m_kill_sound = path;
+    p_enemy->Set_Kill_Sound(path);
 
     return mrb_str_new_cstr(p_state, path);
 }
@@ -161,6 +161,13 @@
  * of collected jewels, etc.), it will result in undefined behaviour
  * probably leading TSC to crash.
  *
+ * =item [saved]
+ *
+ * Called after a savegame was completely written to the disk. Savegames
+ * are written in the background, so this happens a few frames after
+ * the B<save_load> event collected the data to store. Use it to tell
+ * the player that saving succeeded, a failed save doesn’t trigger it.
+ *
  * =back
  *
  * =head2 See Also
@@ -177,6 +184,7 @@ using namespace TSC::Scripting;
  ***************************************/
 
 MRUBY_IMPLEMENT_EVENT(save_load);
+MRUBY_IMPLEMENT_EVENT(saved);
 
 /***************************************
  * Methods
@@ -809,6 +817,7 @@ void TSC::Scripting::Init_Level(mrb_state* p_state)
     mrb_define_method(p_state, p_rcLevel, "fixed_horizontal_velocity", Get_Fixed_Hor_Vel, MRB_ARGS_NONE());
 
     mrb_define_method(p_state, p_rcLevel, "on_save_load", MRUBY_EVENT_HANDLER(save_load), MRB_ARGS_NONE());
+    mrb_define_method(p_state, p_rcLevel, "on_saved", MRUBY_EVENT_HANDLER(saved), MRB_ARGS_NONE());
 
     struct RClass* p_rcLevel_StackEntry = mrb_define_class_under(p_state, p_rcLevel, "StackEntry", p_state->object_class);
 
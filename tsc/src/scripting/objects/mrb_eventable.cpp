@@ -68,7 +68,7 @@ mrb_value Bind(mrb_state* p_state, mrb_value self)
      * see through our C++ pointers, so we have to prevent it from garbage-
      * collecting the callback explicitely by referencing it from this object.
      * This causes somewhat duplicate information, as the callbacks are now
-     * referenced from both the `callbacks' instance variable and the m_callbacks
+     * referenced from both the `callbacks' instance variable and the mp_callbacks
      * member of the C++ object instance, which *must* be kept in sync to
      * prevent bad side-effects like unexpected segmentation faults. */
     mrb_ary_push(p_state, mrb_iv_get(p_state, self, callbacks_sym), callback);
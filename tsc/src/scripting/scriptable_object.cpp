@@ -19,7 +19,7 @@
 using namespace TSC;
 using namespace TSC::Scripting;
 
-/* The `m_callbacks' member variable of the cScriptableObject class
+/* The `mp_callbacks' member variable of the cScriptableObject class
  * is blasphemical currently. It holds mruby objects (mrb_value instances)
  * of DIFFERENT mruby interpreters! The reason for this is sublevel
  * handling. Each level has its own mruby interpreter attached, but
@@ -28,24 +28,51 @@ using namespace TSC::Scripting;
  * some objects, most notably the level player (cLevel_Player singleton
  * instance), is shared amongst all currently active levels. This is
  * a design flaw that should probably be fixed, but to work around
- * the problem m_callbacks just maps an event handler by both level
+ * the problem mp_callbacks just maps an event handler by both level
  * and event name. If you tried to run an event handler from a level
  * different from the active one (pActive_Level), this would actually
  * work and have effect on the currently invisible level. However, this
  * is unintended and not allowed by the outbound interface of the
  * cScriptable_Object class hence. When a sublevel is destroyed, it
- * is required to remove all objects it has from the `m_callbacks'
+ * is required to remove all objects it has from the `mp_callbacks'
  * member by employing clear_event_handlers() with its level name
  * passed. */
 
+/* Returned by event_handlers_begin() and event_handlers_end() for
+ * objects that never had a handler registered, so that firing an
+ * event on them does not allocate anything. */
+static std::vector<mrb_value> s_no_event_handlers;
+
 cScriptable_Object::cScriptable_Object()
+    : mp_callbacks(NULL)
 {
     //
 }
 
+cScriptable_Object::cScriptable_Object(const cScriptable_Object& other)
+    : mp_callbacks(NULL)
+{
+    if (other.mp_callbacks)
+        mp_callbacks = new Callback_Map(*other.mp_callbacks);
+}
+
 cScriptable_Object::~cScriptable_Object()
 {
-    clear_event_handlers();
+    delete mp_callbacks;
+}
+
+cScriptable_Object& cScriptable_Object::operator=(const cScriptable_Object& other)
+{
+    if (this == &other)
+        return *this;
+
+    delete mp_callbacks;
+    mp_callbacks = NULL;
+
+    if (other.mp_callbacks)
+        mp_callbacks = new Callback_Map(*other.mp_callbacks);
+
+    return *this;
 }
 
 /**
@@ -74,10 +101,15 @@ cScriptable_Object::~cScriptable_Object()
  */
 void cScriptable_Object::clear_event_handlers(const std::string& levelname /* = "" */)
 {
-    if (levelname.empty())
-        m_callbacks.clear();
+    if (!mp_callbacks)
+        return;
+
+    if (levelname.empty()) {
+        delete mp_callbacks;
+        mp_callbacks = NULL;
+    }
     else
-        m_callbacks[levelname].clear();
+        mp_callbacks->erase(levelname);
 }
 
 /**
@@ -94,7 +126,10 @@ void cScriptable_Object::clear_event_handlers(const std::string& levelname /* =
  */
 void cScriptable_Object::register_event_handler(const std::string& evtname, mrb_value callback)
 {
-    m_callbacks[get_active_level_name()][evtname].push_back(callback);
+    if (!mp_callbacks)
+        mp_callbacks = new Callback_Map();
+
+    (*mp_callbacks)[get_active_level_name()][evtname].push_back(callback);
 }
 
 /**
@@ -107,7 +142,12 @@ void cScriptable_Object::register_event_handler(const std::string& evtname, mrb_
  */
 std::vector<mrb_value>::iterator cScriptable_Object::event_handlers_begin(const std::string& evtname)
 {
-    return m_callbacks[get_active_level_name()][evtname].begin();
+    std::vector<mrb_value>* p_handlers = find_event_handlers(evtname);
+
+    if (!p_handlers)
+        return s_no_event_handlers.begin();
+
+    return p_handlers->begin();
 }
 
 /**
@@ -120,7 +160,32 @@ std::vector<mrb_value>::iterator cScriptable_Object::event_handlers_begin(const
  */
 std::vector<mrb_value>::iterator cScriptable_Object::event_handlers_end(const std::string& evtname)
 {
-    return m_callbacks[get_active_level_name()][evtname].end();
+    std::vector<mrb_value>* p_handlers = find_event_handlers(evtname);
+
+    if (!p_handlers)
+        return s_no_event_handlers.end();
+
+    return p_handlers->end();
+}
+
+/**
+ * Look up the callback list for the given event in the active level
+ * without creating it. Returns NULL if no handler was ever registered.
+ */
+std::vector<mrb_value>* cScriptable_Object::find_event_handlers(const std::string& evtname)
+{
+    if (!mp_callbacks)
+        return NULL;
+
+    Callback_Map::iterator level_itr = mp_callbacks->find(get_active_level_name());
+    if (level_itr == mp_callbacks->end())
+        return NULL;
+
+    std::map<std::string, std::vector<mrb_value> >::iterator evt_itr = level_itr->second.find(evtname);
+    if (evt_itr == level_itr->second.end())
+        return NULL;
+
+    return &evt_itr->second;
 }
 
 std::string cScriptable_Object::get_active_level_name()
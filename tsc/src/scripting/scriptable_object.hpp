@@ -27,20 +27,30 @@ namespace TSC {
         class cScriptable_Object {
         public:
             cScriptable_Object();
+            cScriptable_Object(const cScriptable_Object& other);
             virtual ~cScriptable_Object();
 
+            cScriptable_Object& operator=(const cScriptable_Object& other);
+
             void clear_event_handlers(const std::string& levelname = "");
             void register_event_handler(const std::string& evtname, mrb_value callback);
             std::vector<mrb_value>::iterator event_handlers_begin(const std::string& evtname);
             std::vector<mrb_value>::iterator event_handlers_end(const std::string& evtname);
+            /// True if any event handler was ever registered for any level.
+            bool has_event_handlers() const { return mp_callbacks != NULL; }
 
         protected:
+            typedef std::map<std::string, std::map<std::string, std::vector<mrb_value> > > Callback_Map;
+
             /// Mapping of level + event names and registered callbacks.
             /// Example in ruby syntax:
             /// {"mylevel" => {"myevent" => [handle1, handle2]}, "mevent2" => ["handle3"]}
-            std::map<std::string, std::map<std::string, std::vector<mrb_value> > > m_callbacks;
+            /// Only allocated once the first handler is registered, as the
+            /// vast majority of objects never gets one.
+            Callback_Map* mp_callbacks;
         private:
             std::string get_active_level_name();
+            std::vector<mrb_value>* find_event_handlers(const std::string& evtname);
         };
     };
 };
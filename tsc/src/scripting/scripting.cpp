@@ -12,11 +12,15 @@
  * along with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <mruby/dump.h>
 #include "scripting.hpp"
+#include "bytecode_cache.hpp"
 #include "../level/level.hpp"
 #include "../level/level_player.hpp"
 #include "../core/sprite_manager.hpp"
 #include "../core/property_helper.hpp"
+#include "../core/game_core.hpp"
+#include "../core/framerate.hpp"
 #include "../core/filesystem/resource_manager.hpp"
 #include "../core/i18n.hpp"
 #include "../audio/audio.hpp"
@@ -93,6 +97,8 @@ namespace Scripting {
 
 cMRuby_Interpreter::cMRuby_Interpreter(cLevel* p_level)
 {
+    uint32_t perf_ticks = TSC_GetTicks();
+
     // Set member variables
     mp_level = p_level;
     mp_mruby = mrb_open();
@@ -107,6 +113,9 @@ cMRuby_Interpreter::cMRuby_Interpreter(cLevel* p_level)
     Load_Wrappers();
     // Load scripting library
     Load_Scripts();
+
+    // update performance timer
+    pFramerate->m_perf_timer[PERF_SCRIPTING_INTERPRETER]->Update(perf_ticks);
 }
 
 cMRuby_Interpreter::~cMRuby_Interpreter()
@@ -175,6 +184,39 @@ mrb_value cMRuby_Interpreter::Run_Code_In_Context(const std::string& code, mrbc_
     return retval;
 }
 
+mrb_value cMRuby_Interpreter::Run_Cached_Code_In_Context(const std::string& code, const std::string& contextname, mrbc_context* p_context)
+{
+    uint32_t perf_ticks = TSC_GetTicks();
+    const cBytecode_Cache::Bytecode* p_bytecode = pBytecode_Cache->Get(code, contextname);
+
+    if (!p_bytecode) {
+        // Only compile, so the bytecode can be stored before it runs
+        p_context->no_exec = true;
+        mrb_value proc = mrb_load_nstring_cxt(mp_mruby, code.c_str(), code.length(), p_context);
+        p_context->no_exec = false;
+
+        // Syntax error
+        if (mp_mruby->exc || mrb_type(proc) != MRB_TT_PROC)
+            return mrb_nil_value();
+
+        uint8_t* p_bin = NULL;
+        size_t bin_size = 0;
+        if (mrb_dump_irep(mp_mruby, mrb_proc_ptr(proc)->body.irep, DUMP_DEBUG_INFO, &p_bin, &bin_size) != MRB_DUMP_OK) {
+            // Can’t be cached, just run it
+            pFramerate->m_perf_timer[PERF_SCRIPTING_BYTECODE]->Update(perf_ticks);
+            return mrb_funcall(mp_mruby, proc, "call", 0);
+        }
+
+        p_bytecode = pBytecode_Cache->Add(code, contextname, p_bin, bin_size);
+        mrb_free(mp_mruby, p_bin);
+    }
+
+    // update performance timer
+    pFramerate->m_perf_timer[PERF_SCRIPTING_BYTECODE]->Update(perf_ticks);
+
+    return mrb_load_irep_cxt(mp_mruby, &(*p_bytecode)[0], p_context);
+}
+
 mrb_value cMRuby_Interpreter::Run_Code_In_Console_Context(const std::string& code)
 {
     return Run_Code_In_Context(code, mp_console_ctx);
@@ -190,7 +232,7 @@ bool cMRuby_Interpreter::Run_Code(const std::string& code, const std::string& co
     p_context->lineno = 1;
     mrbc_filename(mp_mruby, p_context, contextname.c_str()); // Set context filename (for exceptions)
 
-    Run_Code_In_Context(code, p_context);
+    Run_Cached_Code_In_Context(code, contextname, p_context);
 
     bool result;
     if (mp_mruby->exc) {
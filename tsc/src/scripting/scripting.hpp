@@ -79,6 +79,10 @@ namespace TSC {
             // exception inspection is done for you. It’s basically
             // a wrapper around mrb_load_nstring_cxt().
             mrb_value Run_Code_In_Context(const std::string& code, mrbc_context* p_context);
+            // Same as Run_Code_In_Context(), but loads the code as
+            // bytecode from the bytecode cache. Code not in the
+            // cache yet is compiled and added to it first.
+            mrb_value Run_Cached_Code_In_Context(const std::string& code, const std::string& contextname, mrbc_context* p_context);
             // Run the given code in the execution context of the game console.
             mrb_value Run_Code_In_Console_Context(const std::string& code);
             // Registers an MRuby callback to be called on the next
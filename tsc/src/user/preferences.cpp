@@ -50,6 +50,8 @@ const uint8_t cPreferences::m_video_screen_bpp_default = 32;
 */
 const bool cPreferences::m_video_vsync_default = 0;
 const uint16_t cPreferences::m_video_fps_limit_default = 240;
+const bool cPreferences::m_video_render_thread_default = 0;
+const uint16_t cPreferences::m_video_texture_budget_default = 512;
 // default geometry detail is medium
 const float cPreferences::m_geometry_quality_default = 0.5f;
 // default texture detail is high
@@ -151,6 +153,8 @@ void cPreferences::Save(void)
     Add_Property(p_root, "video_screen_bpp", static_cast<int>(m_video_screen_bpp));
     Add_Property(p_root, "video_vsync", m_video_vsync);
     Add_Property(p_root, "video_fps_limit", m_video_fps_limit);
+    Add_Property(p_root, "video_render_thread", m_video_render_thread);
+    Add_Property(p_root, "video_texture_budget", m_video_texture_budget);
     Add_Property(p_root, "video_geometry_quality", pVideo->m_geometry_quality);
     Add_Property(p_root, "video_texture_quality", pVideo->m_texture_quality);
     // Audio
@@ -237,6 +241,8 @@ void cPreferences::Reset_Video(void)
     m_video_screen_bpp = m_video_screen_bpp_default;
     m_video_vsync = m_video_vsync_default;
     m_video_fps_limit = m_video_fps_limit_default;
+    m_video_render_thread = m_video_render_thread_default;
+    m_video_texture_budget = m_video_texture_budget_default;
     m_video_fullscreen = m_video_fullscreen_default;
     pVideo->m_geometry_quality = m_geometry_quality_default;
     pVideo->m_texture_quality = m_texture_quality_default;
@@ -332,10 +338,13 @@ void cPreferences::Apply(void)
 
 void cPreferences::Apply_Video(uint16_t screen_w, uint16_t screen_h, uint8_t screen_bpp, bool fullscreen, bool vsync, float geometry_detail, float texture_detail)
 {
-    /* if resolution, bpp, vsync or texture detail changed
-     * a texture reload is necessary
-    */
+    // if resolution, bpp, vsync or texture detail changed
     if (m_video_screen_w != screen_w || m_video_screen_h != screen_h || m_video_screen_bpp != screen_bpp || m_video_vsync != vsync || !Is_Float_Equal(pVideo->m_texture_quality, texture_detail)) {
+        /* the textures are cached by resolution and scaled by the texture detail
+         * for other changes the textures are kept
+        */
+        const bool reload_textures = m_video_screen_w != screen_w || m_video_screen_h != screen_h || !Is_Float_Equal(pVideo->m_texture_quality, texture_detail);
+
         // new settings
         m_video_screen_w = screen_w;
         m_video_screen_h = screen_h;
@@ -345,8 +354,8 @@ void cPreferences::Apply_Video(uint16_t screen_w, uint16_t screen_h, uint8_t scr
         pVideo->m_texture_quality = texture_detail;
         pVideo->m_geometry_quality = geometry_detail;
 
-        // reinitialize video and reload textures from file
-        pVideo->Init_Video(1);
+        // reinitialize video
+        pVideo->Init_Video(reload_textures);
     }
     // no texture reload necessary
     else {
@@ -82,6 +82,10 @@ namespace TSC {
         uint8_t m_video_screen_bpp;
         bool m_video_vsync;
         uint16_t m_video_fps_limit;
+        // render the game in a separate thread
+        bool m_video_render_thread;
+        // video memory for image textures in megabytes, 0 is unlimited
+        uint16_t m_video_texture_budget;
 
         // Keyboard
         // key definitions
@@ -164,6 +168,8 @@ namespace TSC {
         static const uint8_t m_video_screen_bpp_default;
         static const bool m_video_vsync_default;
         static const uint16_t m_video_fps_limit_default;
+        static const bool m_video_render_thread_default;
+        static const uint16_t m_video_texture_budget_default;
         static const float m_geometry_quality_default;
         static const float m_texture_quality_default;
         // Keyboard
@@ -158,6 +158,10 @@ void cPreferencesLoader::handle_property(const std::string& name, const std::str
         mp_preferences->m_video_vsync = string_to_bool(value);
     else if (name == "video_fps_limit")
         mp_preferences->m_video_fps_limit = string_to_int(value);
+    else if (name == "video_render_thread")
+        mp_preferences->m_video_render_thread = string_to_bool(value);
+    else if (name == "video_texture_budget")
+        mp_preferences->m_video_texture_budget = string_to_int(value);
     else if (name == "video_fullscreen")
         mp_preferences->m_video_fullscreen = string_to_bool(value);
     else if (name == "video_geometry_detail" || name == "video_geometry_quality")
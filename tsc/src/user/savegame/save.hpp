@@ -50,6 +50,8 @@ namespace TSC {
         // Write the savegame out to the given file; raises
         // xmlpp::exception on error.
         void Write_To_File(boost::filesystem::path filepath);
+        // Write the savegame XML to the given stream
+        void Write_To_Stream(std::ostream& stream);
 
         // savegame version
         int m_version;
@@ -17,6 +17,7 @@
 #ifndef TSC_SAVEGAME_SAVE_LEVEL_HPP
 #define TSC_SAVEGAME_SAVE_LEVEL_HPP
 #include "../../objects/sprite.hpp"
+#include "../../core/xml_stream_writer.hpp"
 
 namespace TSC {
     // This is used in the scripting API's Save event for storing the
@@ -79,7 +80,7 @@ namespace TSC {
         cSave_Level(void);
         ~cSave_Level(void);
 
-        void Save_To_Node(xmlpp::Element* p_parent_node);
+        void Save_To_Stream(cXml_Stream_Writer& writer);
 
         std::string m_name;
         /// True if this is the active level.
@@ -28,6 +28,8 @@
 #include "../../core/filesystem/filesystem.hpp"
 #include "../../core/filesystem/resource_manager.hpp"
 #include "../../scripting/events/level_save_load_event.hpp"
+#include "../../scripting/events/saved_event.hpp"
+#include "../../core/filesystem/async_file_writer.hpp"
 #include "../../core/global_basic.hpp"
 #include "../../audio/audio.hpp"
 #include "../../enemies/army.hpp"
@@ -50,11 +52,18 @@ cSave_Player_Return_Entry::cSave_Player_Return_Entry(const std::string& level, c
 cSavegame::cSavegame(void)
 {
     m_savegame_dir = pResource_Manager->Get_User_Savegame_Directory();
+    m_save_job = 0;
+    m_save_slot = 0;
+    m_finished_save_job = 0;
+    m_finished_save_success = 1;
 }
 
 cSavegame::~cSavegame(void)
 {
-    //
+    // the HUD may be gone already, only finish writing
+    if (m_save_job) {
+        pAsync_File_Writer->Wait();
+    }
 }
 
 int cSavegame::Load_Game(unsigned int save_slot)
@@ -284,7 +293,7 @@ int cSavegame::Load_Game(unsigned int save_slot)
     return save_type;
 }
 
-bool cSavegame::Save_Game(unsigned int save_slot, std::string description)
+unsigned int cSavegame::Save_Game(unsigned int save_slot, std::string description)
 {
     if (pLevel_Player->m_alex_type == ALEX_DEAD || gp_hud->Get_Lives() < 0) {
         cerr << "Error : Couldn't save savegame " << description << " because of invalid game state" << endl;
@@ -421,30 +430,93 @@ bool cSavegame::Save_Game(unsigned int save_slot, std::string description)
         }
     }
 
-    fs::path save_dir = pResource_Manager->Get_User_Savegame_Directory();
-    fs::path filename = save_dir / utf8_to_path(int_to_string(save_slot) + ".tscsav");
-    // remove old format savegame files
-    fs::remove(save_dir / utf8_to_path(int_to_string(save_slot) + ".save"));
-    fs::remove(save_dir / utf8_to_path(int_to_string(save_slot) + ".smcsav"));
+    fs::path filename = pResource_Manager->Get_User_Savegame_Directory() / utf8_to_path(int_to_string(save_slot) + ".tscsav");
+
+    // finish a previous save first
+    Wait();
+
+    /* The sprites may change or be deleted after this frame so the
+     * XML is created here, only writing it to the disk happens in the
+     * background */
+    std::ostringstream stream;
+    savegame->Write_To_Stream(stream);
+    delete savegame;
+
+    m_save_job = pAsync_File_Writer->Write(filename, stream.str());
+    m_save_slot = save_slot;
+
+    return m_save_job;
+}
+
+void cSavegame::Update(void)
+{
+    if (!m_save_job) {
+        return;
+    }
+
+    bool success;
+    std::string error;
 
-    try {
-        savegame->Write_To_File(filename);
+    if (!pAsync_File_Writer->Get_Result(m_save_job, success, error)) {
+        return;
     }
-    catch (xmlpp::exception& e) {
-        cerr << "Failed to save savegame '" << filename << "': " << e.what() << endl
+
+    m_finished_save_job = m_save_job;
+    m_finished_save_success = success;
+    m_save_job = 0;
+
+    fs::path save_dir = pResource_Manager->Get_User_Savegame_Directory();
+    fs::path filename = save_dir / utf8_to_path(int_to_string(m_save_slot) + ".tscsav");
+
+    if (!success) {
+        cerr << "Failed to save savegame '" << filename << "': " << error << endl
              << "Is the file read-only?" << endl;
         gp_hud->Set_Text(_("Couldn't save savegame ") + path_to_utf8(filename));
+        return;
     }
 
-    gp_hud->Set_Text(_("Saved to Slot ") + int_to_string(save_slot));
+    debug_print("Wrote savegame file '%s'.\n", path_to_utf8(filename).c_str());
 
-    delete savegame;
+    // remove old format savegame files
+    fs::remove(save_dir / utf8_to_path(int_to_string(m_save_slot) + ".save"));
+    fs::remove(save_dir / utf8_to_path(int_to_string(m_save_slot) + ".smcsav"));
+
+    gp_hud->Set_Text(_("Saved to Slot ") + int_to_string(m_save_slot));
+
+    // the savegame is on the disk now
+    if (pActive_Level->Is_Loaded()) {
+        Scripting::cSaved_Event evt;
+        evt.Fire(pActive_Level->m_mruby, this);
+    }
+}
+
+bool cSavegame::Wait(void)
+{
+    if (!m_save_job) {
+        return m_finished_save_success;
+    }
+
+    pAsync_File_Writer->Wait();
+    Update();
 
+    return m_finished_save_success;
+}
+
+bool cSavegame::Get_Save_Result(unsigned int save_job, bool& success) const
+{
+    if (!save_job || save_job != m_finished_save_job) {
+        return 0;
+    }
+
+    success = m_finished_save_success;
     return 1;
 }
 
 cSave* cSavegame::Load(unsigned int save_slot)
 {
+    // the slot may still be written
+    Wait();
+
     fs::path save_dir = pResource_Manager->Get_User_Savegame_Directory();
     fs::path filename = save_dir / utf8_to_path(int_to_string(save_slot) + ".tscsav");
 
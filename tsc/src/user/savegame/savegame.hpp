@@ -45,8 +45,22 @@ namespace TSC {
         * 2 if overworld save
         */
         int Load_Game(unsigned int save_slot);
-        // Save the game with the given description
-        bool Save_Game(unsigned int save_slot, std::string description);
+        /* Save the game with the given description
+         * The game state is collected right away and written in the
+         * background, Update() reports the result when it is written.
+         * Returns the save job or 0 if the game state can't be saved
+        */
+        unsigned int Save_Game(unsigned int save_slot, std::string description);
+        // Finish a background save if it is written
+        void Update(void);
+        /* Wait until a background save is written
+         * Returns false if the last save failed
+        */
+        bool Wait(void);
+        /* Returns true if the given save job is written
+         * success : set to the result of the save job
+        */
+        bool Get_Save_Result(unsigned int save_job, bool& success) const;
 
         /**
          * \brief Load a Save
@@ -77,6 +91,14 @@ namespace TSC {
 
         // savegame directory
         boost::filesystem::path m_savegame_dir;
+    private:
+        // background save job or 0
+        unsigned int m_save_job;
+        // slot of the background save
+        unsigned int m_save_slot;
+        // last written save job and its result
+        unsigned int m_finished_save_job;
+        bool m_finished_save_success;
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
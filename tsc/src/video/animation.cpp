@@ -465,6 +465,8 @@ void cParticle::Set_Gravity(float x, float y)
 
 /* *** *** *** *** *** *** *** cParticle_Emitter *** *** *** *** *** *** *** *** *** *** */
 
+const unsigned int cParticle_Emitter::m_max_free_particles = 200;
+
 cParticle_Emitter::cParticle_Emitter(cSprite_Manager* sprite_manager)
     : cAnimation(sprite_manager, "particle_emitter")
 {
@@ -562,6 +564,10 @@ cParticle_Emitter::cParticle_Emitter(XmlAttributes& attributes, cSprite_Manager*
 cParticle_Emitter::~cParticle_Emitter(void)
 {
     cParticle_Emitter::Clear();
+
+    for (ParticleList::iterator itr = m_free_particles.begin(); itr != m_free_particles.end(); ++itr) {
+        delete *itr;
+    }
 }
 
 void cParticle_Emitter::Init(void)
@@ -622,6 +628,8 @@ void cParticle_Emitter::Init(void)
     m_clip_rect = GL_rect();
     m_clip_mode = PCM_MOVE;
 
+    m_pooled = 0;
+
     // animation data
     m_emit_counter = 0.0f;
     m_emitter_living_time = 0.0f;
@@ -630,33 +638,43 @@ void cParticle_Emitter::Init(void)
 cParticle_Emitter* cParticle_Emitter::Copy(void) const
 {
     cParticle_Emitter* particle_animation = new cParticle_Emitter(m_sprite_manager);
-    particle_animation->Set_Based_On_Camera_Pos(m_emitter_based_on_camera_pos);
-    particle_animation->Set_Particle_Based_On_Emitter_Pos(m_particle_based_on_emitter_pos);
     particle_animation->Set_Pos(m_start_pos_x, m_start_pos_y, 1);
-    particle_animation->Set_Pos_Z(m_pos_z, m_pos_z_rand);
-    particle_animation->Set_Image_Filename(fs::path(m_image_filename));
     particle_animation->Set_Emitter_Rect(m_rect);
-    particle_animation->Set_Emitter_Time_to_Live(m_emitter_time_to_live);
-    particle_animation->Set_Emitter_Iteration_Interval(m_emitter_iteration_interval);
-    particle_animation->Set_Quota(m_emitter_quota);
-    particle_animation->Set_Time_to_Live(m_time_to_live, m_time_to_live_rand);
-    particle_animation->Set_Speed(m_vel, m_vel_rand);
-    particle_animation->Set_Rotation(m_start_rot_x, m_start_rot_y, m_start_rot_z, 1);
-    particle_animation->Set_Start_Rot_Z_Uses_Direction(m_start_rot_z_uses_direction);
-    particle_animation->Set_Const_Rotation_X(m_const_rot_x, m_const_rot_x_rand);
-    particle_animation->Set_Const_Rotation_Y(m_const_rot_y, m_const_rot_y_rand);
-    particle_animation->Set_Const_Rotation_Z(m_const_rot_z, m_const_rot_z_rand);
-    particle_animation->Set_Direction_Range(m_angle_start, m_angle_range);
-    particle_animation->Set_Scale(m_size_scale, m_size_scale_rand);
-    particle_animation->Set_Color(m_color, m_color_rand);
-    particle_animation->Set_Horizontal_Gravity(m_gravity_x, m_gravity_x_rand);
-    particle_animation->Set_Vertical_Gravity(m_gravity_y, m_gravity_y_rand);
+    particle_animation->Copy_Settings(this);
     particle_animation->Set_Spawned(m_spawned);
-    particle_animation->Set_Clip_Rect(m_clip_rect);
-    particle_animation->Set_Clip_Mode(m_clip_mode);
     return particle_animation;
 }
 
+void cParticle_Emitter::Copy_Settings(const cParticle_Emitter* emitter)
+{
+    m_image_filename = emitter->m_image_filename;
+    Set_Image(emitter->m_image);
+    Set_Based_On_Camera_Pos(emitter->m_emitter_based_on_camera_pos);
+    Set_Particle_Based_On_Emitter_Pos(emitter->m_particle_based_on_emitter_pos);
+    Set_Pos_Z(emitter->m_pos_z, emitter->m_pos_z_rand);
+    Set_Emitter_Time_to_Live(emitter->m_emitter_time_to_live);
+    Set_Emitter_Iteration_Interval(emitter->m_emitter_iteration_interval);
+    Set_Quota(emitter->m_emitter_quota);
+    Set_Time_to_Live(emitter->m_time_to_live, emitter->m_time_to_live_rand);
+    Set_Speed(emitter->m_vel, emitter->m_vel_rand);
+    Set_Rotation(emitter->m_start_rot_x, emitter->m_start_rot_y, emitter->m_start_rot_z, 1);
+    Set_Start_Rot_Z_Uses_Direction(emitter->m_start_rot_z_uses_direction);
+    Set_Const_Rotation_X(emitter->m_const_rot_x, emitter->m_const_rot_x_rand);
+    Set_Const_Rotation_Y(emitter->m_const_rot_y, emitter->m_const_rot_y_rand);
+    Set_Const_Rotation_Z(emitter->m_const_rot_z, emitter->m_const_rot_z_rand);
+    Set_Direction_Range(emitter->m_angle_start, emitter->m_angle_range);
+    Set_Scale(emitter->m_size_scale, emitter->m_size_scale_rand);
+    Set_Color(emitter->m_color, emitter->m_color_rand);
+    Set_Horizontal_Gravity(emitter->m_gravity_x, emitter->m_gravity_x_rand);
+    Set_Vertical_Gravity(emitter->m_gravity_y, emitter->m_gravity_y_rand);
+    Set_Fading_Size(emitter->m_fade_size);
+    Set_Fading_Alpha(emitter->m_fade_alpha);
+    Set_Fading_Color(emitter->m_fade_color);
+    Set_Blending(emitter->m_blending);
+    Set_Clip_Rect(emitter->m_clip_rect);
+    Set_Clip_Mode(emitter->m_clip_mode);
+}
+
 std::string cParticle_Emitter::Get_XML_Type_Name()
 {
     return "";
@@ -765,7 +783,20 @@ void cParticle_Emitter::Emit(void)
     }
 
     for (unsigned int i = 0; i < m_emitter_quota; i++) {
-        cParticle* particle = new cParticle(this);
+        cParticle* particle;
+
+        // reuse a finished particle
+        if (!m_free_particles.empty()) {
+            particle = m_free_particles.back();
+            m_free_particles.pop_back();
+
+            particle->m_sprite_manager = m_sprite_manager;
+            particle->Set_Active(1);
+            particle->m_fade_pos = 1.0f;
+        }
+        else {
+            particle = new cParticle(this);
+        }
 
         // X Position
         float x = m_pos_x - (m_image->m_w * 0.5f);
@@ -874,9 +905,9 @@ void cParticle_Emitter::Emit(void)
 
 void cParticle_Emitter::Clear(bool reset /* = 1 */)
 {
-    // clear particles
+    // keep particles for reuse
     for (ParticleList::iterator itr = m_objects.begin(); itr != m_objects.end(); ++itr) {
-        delete *itr;
+        Free_Particle(*itr);
     }
 
     m_objects.clear();
@@ -889,6 +920,16 @@ void cParticle_Emitter::Clear(bool reset /* = 1 */)
     }
 }
 
+void cParticle_Emitter::Free_Particle(cParticle* particle)
+{
+    if (m_free_particles.size() >= m_max_free_particles) {
+        delete particle;
+        return;
+    }
+
+    m_free_particles.push_back(particle);
+}
+
 void cParticle_Emitter::Update(void)
 {
     Update_Valid_Update();
@@ -907,21 +948,23 @@ void cParticle_Emitter::Update(void)
 void cParticle_Emitter::Update_Particles(void)
 {
     // update objects
-    for (ParticleList::iterator itr = m_objects.begin(); itr != m_objects.end();) {
+    for (size_t i = 0; i < m_objects.size();) {
         // get object pointer
-        cParticle* obj = (*itr);
+        cParticle* obj = m_objects[i];
 
         // update
         obj->Update();
 
         // if finished
         if (!obj->m_active) {
-            itr = m_objects.erase(itr);
-            delete obj;
+            // the order is not needed as render requests are sorted by z position
+            m_objects[i] = m_objects.back();
+            m_objects.pop_back();
+            Free_Particle(obj);
         }
         // increment
         else {
-            ++itr;
+            i++;
         }
     }
 
@@ -2111,7 +2154,9 @@ bool cParticle_Emitter::Editor_Clip_Mode_Select(const CEGUI::EventArgs& event)
 cAnimation_Manager::cAnimation_Manager(void)
     : cObject_Manager<cAnimation>()
 {
-
+    for (unsigned int i = 0; i < EFFECT_COUNT; i++) {
+        m_effect_presets[i] = NULL;
+    }
 }
 
 cAnimation_Manager::~cAnimation_Manager(void)
@@ -2119,23 +2164,169 @@ cAnimation_Manager::~cAnimation_Manager(void)
     cAnimation_Manager::Delete_All();
 }
 
+void cAnimation_Manager::Delete_All(void)
+{
+    cObject_Manager<cAnimation>::Delete_All();
+
+    for (Particle_Emitter_List::iterator itr = m_free_effects.begin(); itr != m_free_effects.end(); ++itr) {
+        delete *itr;
+    }
+
+    m_free_effects.clear();
+
+    // created with the sprite manager of the first user
+    Clear_Effect_Presets();
+}
+
+void cAnimation_Manager::Clear_Effect_Presets(void)
+{
+    for (unsigned int i = 0; i < EFFECT_COUNT; i++) {
+        delete m_effect_presets[i];
+        m_effect_presets[i] = NULL;
+    }
+}
+
+cParticle_Emitter* cAnimation_Manager::Get_Effect(EffectPreset preset, cSprite_Manager* sprite_manager)
+{
+    cParticle_Emitter* anim;
+
+    // reuse the emitter of a finished effect
+    if (!m_free_effects.empty()) {
+        anim = m_free_effects.back();
+        m_free_effects.pop_back();
+
+        anim->m_sprite_manager = sprite_manager;
+        anim->Clear();
+        anim->Set_Active(1);
+    }
+    else {
+        anim = new cParticle_Emitter(sprite_manager);
+        anim->m_pooled = 1;
+    }
+
+    anim->Copy_Settings(Get_Effect_Preset(preset, sprite_manager));
+
+    return anim;
+}
+
+const cParticle_Emitter* cAnimation_Manager::Get_Effect_Preset(EffectPreset preset, cSprite_Manager* sprite_manager)
+{
+    if (m_effect_presets[preset]) {
+        return m_effect_presets[preset];
+    }
+
+    // only the particle settings are used
+    cParticle_Emitter* anim = new cParticle_Emitter(sprite_manager);
+
+    switch (preset) {
+    case EFFECT_SMOKE: {
+        anim->Set_Image(pVideo->Get_Surface("animation/particles/smoke.png"));
+        anim->Set_Time_to_Live(1, 1);
+        anim->Set_Direction_Range(180, 180);
+        anim->Set_Speed(0.05f, 0.4f);
+        anim->Set_Const_Rotation_Z(-2, 4);
+        break;
+    }
+    case EFFECT_SMOKE_BIG: {
+        anim->Set_Image(pVideo->Get_Surface("animation/particles/smoke_grey_big.png"));
+        anim->Set_Time_to_Live(0.8f, 0.8f);
+        anim->Set_Speed(1.0f, 0.2f);
+        anim->Set_Const_Rotation_Z(-1, 2);
+        anim->Set_Color(Color(static_cast<uint8_t>(155), 150, 130));
+        break;
+    }
+    case EFFECT_SPARKS: {
+        anim->Set_Image(pVideo->Get_Surface("animation/particles/light.png"));
+        anim->Set_Time_to_Live(0.2f, 0.1f);
+        anim->Set_Speed(1.2f, 1.1f);
+        anim->Set_Color(Color(static_cast<uint8_t>(250), 250, 200), Color(static_cast<uint8_t>(5), 5, 0, 0));
+        anim->Set_Scale(0.3f, 0.3f);
+        anim->Set_Fading_Size(1);
+        anim->Set_Fading_Alpha(0);
+        break;
+    }
+    case EFFECT_STAR_BURST: {
+        anim->Set_Image(pVideo->Get_Surface("animation/particles/light.png"));
+        anim->Set_Time_to_Live(0.4f);
+        anim->Set_Fading_Size(1);
+        anim->Set_Speed(1.5f, 0.5f);
+        anim->Set_Scale(0.15f);
+        anim->Set_Blending(BLEND_ADD);
+        anim->Set_Const_Rotation_Z(-5, 10);
+        break;
+    }
+    case EFFECT_FEET_CLOUDS_EARTH: {
+        anim->Set_Image(pVideo->Get_Surface("animation/particles/dirt.png"));
+        anim->Set_Time_to_Live(0.3f);
+        anim->Set_Scale(0.5f);
+        break;
+    }
+    case EFFECT_FEET_CLOUDS_ICE: {
+        anim->Set_Image(pVideo->Get_Surface("animation/particles/ice_1.png"));
+        anim->Set_Time_to_Live(0.6f);
+        anim->Set_Scale(0.3f);
+        break;
+    }
+    case EFFECT_FEET_CLOUDS_SAND: {
+        anim->Set_Emitter_Iteration_Interval(4.0f);
+        anim->Set_Image(pVideo->Get_Surface("animation/particles/cloud.png"));
+        anim->Set_Time_to_Live(0.3f);
+        anim->Set_Scale(0.2f);
+        anim->Set_Color(lightorange);
+        break;
+    }
+    case EFFECT_FEET_CLOUDS_STONE: {
+        anim->Set_Image(pVideo->Get_Surface("animation/particles/smoke_black.png"));
+        anim->Set_Time_to_Live(0.3f);
+        anim->Set_Scale(0.3f);
+        break;
+    }
+    case EFFECT_FEET_CLOUDS_PLASTIC: {
+        anim->Set_Image(pVideo->Get_Surface("animation/particles/light.png"));
+        anim->Set_Time_to_Live(0.2f);
+        anim->Set_Scale(0.2f);
+        anim->Set_Color(lightgrey);
+        break;
+    }
+    case EFFECT_FEET_CLOUDS:
+    default: {
+        anim->Set_Image(pVideo->Get_Surface("animation/particles/smoke.png"));
+        anim->Set_Time_to_Live(0.3f);
+        break;
+    }
+    }
+
+    m_effect_presets[preset] = anim;
+
+    return anim;
+}
+
 void cAnimation_Manager::Update(void)
 {
-    for (cAnimation_List::iterator itr = objects.begin(); itr != objects.end();) {
+    for (size_t i = 0; i < objects.size();) {
         // get object pointer
-        cAnimation* obj = (*itr);
+        cAnimation* obj = objects[i];
 
         // update
         obj->Update();
 
-        // delete if finished
+        // remove if finished
         if (!obj->m_active) {
-            itr = objects.erase(itr);
-            delete obj;
+            // the order is not needed as render requests are sorted by z position
+            objects[i] = objects.back();
+            objects.pop_back();
+
+            // keep effect emitters for reuse
+            if (obj->m_type == TYPE_PARTICLE_EMITTER && static_cast<cParticle_Emitter*>(obj)->m_pooled) {
+                m_free_effects.push_back(static_cast<cParticle_Emitter*>(obj));
+            }
+            else {
+                delete obj;
+            }
         }
         // increment
         else {
-            ++itr;
+            i++;
         }
     }
 }
@@ -174,6 +174,8 @@ namespace TSC {
         virtual void Init(void);
         // copy
         virtual cParticle_Emitter* Copy(void) const;
+        // Copy the particle settings of the given emitter but not its position and size
+        void Copy_Settings(const cParticle_Emitter* emitter);
 
         // Create the MRuby object for this
         virtual mrb_value Create_MRuby_Object(mrb_state* p_state)
@@ -313,6 +315,12 @@ namespace TSC {
         // Particle items
         typedef vector<cParticle*> ParticleList;
         ParticleList m_objects;
+        // finished particles reused by Emit()
+        ParticleList m_free_particles;
+        // maximum finished particles kept for reuse
+        static const unsigned int m_max_free_particles;
+        // if reused by the animation manager when finished, see cAnimation_Manager::Get_Effect()
+        bool m_pooled;
 
         // filename of the particle image
         boost::filesystem::path m_image_filename;
@@ -376,6 +384,31 @@ namespace TSC {
         float m_emitter_living_time;
         // emit counter
         float m_emit_counter;
+
+        // Keep the finished particle for reuse or delete it if enough are kept
+        void Free_Particle(cParticle* particle);
+    };
+
+    /* *** *** *** *** *** *** *** Effect presets *** *** *** *** *** *** *** *** *** *** */
+
+    // particle effects available from cAnimation_Manager::Get_Effect()
+    enum EffectPreset {
+        // smoke puffs
+        EFFECT_SMOKE,
+        // big grey smoke clouds
+        EFFECT_SMOKE_BIG,
+        // short bright sparks
+        EFFECT_SPARKS,
+        // glowing star particles
+        EFFECT_STAR_BURST,
+        // clouds under the feet for every ground type
+        EFFECT_FEET_CLOUDS,
+        EFFECT_FEET_CLOUDS_EARTH,
+        EFFECT_FEET_CLOUDS_ICE,
+        EFFECT_FEET_CLOUDS_SAND,
+        EFFECT_FEET_CLOUDS_STONE,
+        EFFECT_FEET_CLOUDS_PLASTIC,
+        EFFECT_COUNT
     };
 
     /* *** *** *** *** *** *** *** Animation Manager *** *** *** *** *** *** *** *** *** *** */
@@ -387,6 +420,21 @@ namespace TSC {
 
         // Add an animation object with the given settings
         virtual void Add(cAnimation* animation);
+        // Delete all objects, the emitters kept for reuse and the effect presets
+        virtual void Delete_All(void);
+        /* Delete the effect presets
+         * they are created again with the current images when used
+        */
+        void Clear_Effect_Presets(void);
+
+        /* Return a particle emitter with the settings of the given effect
+         * Set its position and the settings depending on the situation,
+         * then call Emit() and add it with Add(). The emitter is reused
+         * for the next effect after it finished.
+        */
+        cParticle_Emitter* Get_Effect(EffectPreset preset, cSprite_Manager* sprite_manager);
+        // Return the emitter holding the settings of the given effect
+        const cParticle_Emitter* Get_Effect_Preset(EffectPreset preset, cSprite_Manager* sprite_manager);
 
         // Update the objects
         void Update(void);
@@ -394,6 +442,14 @@ namespace TSC {
         void Draw(void);
 
         typedef vector<cAnimation*> cAnimation_List;
+
+    private:
+        typedef vector<cParticle_Emitter*> Particle_Emitter_List;
+
+        // emitters of finished effects
+        Particle_Emitter_List m_free_effects;
+        // settings of the effects, created when first used
+        cParticle_Emitter* m_effect_presets[EFFECT_COUNT];
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
@@ -33,6 +33,7 @@ namespace TSC {
 cGL_Surface::cGL_Surface(void)
 {
     m_image = 0;
+    m_repeat_texture = 0;
 
     m_int_x = 0;
     m_int_y = 0;
@@ -42,6 +43,8 @@ cGL_Surface::cGL_Surface(void)
     m_h = 0;
     m_tex_w = 0;
     m_tex_h = 0;
+    m_tex_part_w = 1.0f;
+    m_tex_part_h = 1.0f;
 
     // internal rotation data
     m_base_rot_x = 0;
@@ -57,6 +60,8 @@ cGL_Surface::cGL_Surface(void)
     m_auto_del_img = 1;
     m_managed = 0;
     m_obsolete = 0;
+    m_evicted = 0;
+    m_last_use_frame = 0;
 
     // default massive type is passive
     m_massive_type = MASS_PASSIVE;
@@ -69,8 +74,16 @@ cGL_Surface::cGL_Surface(void)
 cGL_Surface::~cGL_Surface(void)
 {
     // don't delete a managed OpenGL image if still in use by another managed cGL_Surface
-    if (m_auto_del_img && glIsTexture(m_image) && (!m_managed || !Is_Texture_Use_Multiple())) {
-        glDeleteTextures(1, &m_image);
+    if (m_auto_del_img && (!m_managed || !Is_Texture_Use_Multiple())) {
+        // the render thread may still draw it
+        if (pVideo) {
+            pVideo->Render_Finish();
+            assert(!pVideo->Is_Render_Context_Lent());
+        }
+
+        if (glIsTexture(m_image)) {
+            glDeleteTextures(1, &m_image);
+        }
     }
 
     if (destruction_function) {
@@ -93,6 +106,8 @@ cGL_Surface* cGL_Surface::Copy(void) const
     new_surface->m_h = m_h;
     new_surface->m_tex_h = m_tex_h;
     new_surface->m_tex_w = m_tex_w;
+    new_surface->m_tex_part_w = m_tex_part_w;
+    new_surface->m_tex_part_h = m_tex_part_h;
     new_surface->m_base_rot_x = m_base_rot_x;
     new_surface->m_base_rot_y = m_base_rot_y;
     new_surface->m_base_rot_z = m_base_rot_z;
@@ -111,7 +126,7 @@ cGL_Surface* cGL_Surface::Copy(void) const
     return new_surface;
 }
 
-void cGL_Surface::Blit(float x, float y, float z, cSurface_Request* request /* = NULL */) const
+void cGL_Surface::Blit(float x, float y, float z, cSurface_Request* request /* = NULL */)
 {
     bool create_request = 0;
 
@@ -134,10 +149,10 @@ void cGL_Surface::Blit(float x, float y, float z, cSurface_Request* request /* =
     }
 }
 
-void cGL_Surface::Blit_Data(cSurface_Request* request) const
+void cGL_Surface::Blit_Data(cSurface_Request* request)
 {
     // texture id
-    request->m_texture_id = m_image;
+    request->m_texture_id = Get_Texture();
 
     // position
     request->m_pos_x += m_int_x;
@@ -146,6 +161,8 @@ void cGL_Surface::Blit_Data(cSurface_Request* request) const
     // size
     request->m_w = m_start_w;
     request->m_h = m_start_h;
+    request->m_tex_part_w = m_tex_part_w;
+    request->m_tex_part_h = m_tex_part_h;
 
     // rotation
     request->m_rot_x += m_base_rot_x;
@@ -153,9 +170,18 @@ void cGL_Surface::Blit_Data(cSurface_Request* request) const
     request->m_rot_z += m_base_rot_z;
 }
 
+GLuint cGL_Surface::Get_Texture(void)
+{
+    if (m_managed) {
+        pImage_Manager->Use_Texture(this);
+    }
+
+    return m_image;
+}
+
 void cGL_Surface::Save(const std::string& filename)
 {
-    if (!m_image) {
+    if (!Get_Texture()) {
         cerr << "Couldn't save cGL_Surface : No Image Texture ID set" << endl;
         return;
     }
@@ -178,6 +204,30 @@ void cGL_Surface::Set_Ground_Type(GroundType gtype)
     m_ground_type = gtype;
 }
 
+bool cGL_Surface::Is_Repeatable(void) const
+{
+    if (!m_image) {
+        return 0;
+    }
+
+    // drawn with an offset or rotated
+    if (m_int_x || m_int_y || m_base_rot_x || m_base_rot_y || m_base_rot_z) {
+        return 0;
+    }
+
+    // tiles are placed with a different size than drawn
+    if (!Is_Float_Equal(m_w, m_start_w) || !Is_Float_Equal(m_h, m_start_h)) {
+        return 0;
+    }
+
+    // repeating would leave out the padding
+    if (!Is_Float_Equal(m_tex_part_w, 1.0f) || !Is_Float_Equal(m_tex_part_h, 1.0f)) {
+        return 0;
+    }
+
+    return 1;
+}
+
 bool cGL_Surface::Is_Texture_Use_Multiple(void) const
 {
     for (GL_Surface_List::iterator itr = pImage_Manager->objects.begin(); itr != pImage_Manager->objects.end(); ++itr) {
@@ -269,6 +319,7 @@ void cGL_Surface::Load_Software_Texture(cSaved_Texture* soft_tex)
         pVideo->Create_GL_Texture(soft_tex->m_width, soft_tex->m_height, soft_tex->m_pixels, mipmaps);
 
         m_image = tex_id;
+        m_repeat_texture = 0;
     }
     // load from file
     else {
@@ -279,17 +330,25 @@ void cGL_Surface::Load_Software_Texture(cSaved_Texture* soft_tex)
             return;
         }
 
-        // get image
-        m_image = surface_copy->m_image;
-        m_tex_w = surface_copy->m_tex_w;
-        m_tex_h = surface_copy->m_tex_h;
-        // keep hardware texture
-        surface_copy->m_auto_del_img = 0;
-        // delete copy
-        delete surface_copy;
+        Take_Texture(surface_copy);
     }
 }
 
+void cGL_Surface::Take_Texture(cGL_Surface* surface_copy)
+{
+    // get image
+    m_image = surface_copy->m_image;
+    m_repeat_texture = 0;
+    m_tex_w = surface_copy->m_tex_w;
+    m_tex_h = surface_copy->m_tex_h;
+    m_tex_part_w = surface_copy->m_tex_part_w;
+    m_tex_part_h = surface_copy->m_tex_part_h;
+    // keep hardware texture
+    surface_copy->m_auto_del_img = 0;
+    // delete copy
+    delete surface_copy;
+}
+
 fs::path cGL_Surface::Get_Path()
 {
     return m_path;
@@ -32,9 +32,14 @@ namespace TSC {
         /* Blit the surface on the given position
          * if request is NULL automatically creates the request
         */
-        void Blit(float x, float y, float z, cSurface_Request* request = NULL) const;
+        void Blit(float x, float y, float z, cSurface_Request* request = NULL);
         // Blit only the surface data on the given request
-        void Blit_Data(cSurface_Request* request) const;
+        void Blit_Data(cSurface_Request* request);
+
+        /* Return the texture for drawing
+         * Reloads it if it was evicted and marks it as used, see cImage_Manager::Update_Residency()
+        */
+        GLuint Get_Texture(void);
 
         // Copy cGL_Surface and return it
         cGL_Surface* Copy(void) const;
@@ -47,6 +52,10 @@ namespace TSC {
 
         // Check if the OpenGL texture is used by another cGL_Surface
         bool Is_Texture_Use_Multiple(void) const;
+        /* Check if tiling this surface can be drawn by repeating the texture
+         * which needs the texture to fill exactly one tile
+        */
+        bool Is_Repeatable(void) const;
 
         /* Return a software texture copy
          * only_filename: if set doesn't save the software texture but only the filename
@@ -54,6 +63,8 @@ namespace TSC {
         cSaved_Texture* Get_Software_Texture(bool only_filename = 0);
         // Load a software texture
         void Load_Software_Texture(cSaved_Texture* soft_tex);
+        // Use the texture of a newly loaded copy of this surface, the copy gets deleted
+        void Take_Texture(cGL_Surface* surface_copy);
 
         // Return the filename if created from a file, otherwise an
         // empty boost::filesystem::path instance.
@@ -67,6 +78,10 @@ namespace TSC {
 
         // GL texture number
         GLuint m_image;
+        /* texture number switched to the repeat wrap mode by a cRepeat_Surface_Request
+         * 0 if the texture still has the default clamped wrap mode
+        */
+        GLuint m_repeat_texture;
         // internal drawing offset
         float m_int_x;
         float m_int_y;
@@ -79,6 +94,11 @@ namespace TSC {
         // texture dimension
         unsigned int m_tex_w;
         unsigned int m_tex_h;
+        /* part of the drawn size covered by the texture
+         * less than 1 if the power of 2 padding is not part of the texture
+        */
+        float m_tex_part_w;
+        float m_tex_part_h;
         // internal rotation
         float m_base_rot_x;
         float m_base_rot_y;
@@ -102,6 +122,10 @@ namespace TSC {
         bool m_managed;
         // if the image is tagged as obsolete
         bool m_obsolete;
+        // if the texture was evicted by the image manager to save video memory
+        bool m_evicted;
+        // image manager frame the texture was last drawn in
+        uint32_t m_last_use_frame;
 
         // editor tags
         std::string m_editor_tags;
@@ -15,11 +15,17 @@
 */
 
 #include "../video/img_manager.hpp"
+#include "../video/img_set.hpp"
+#include "../video/animation.hpp"
+#include "../video/img_settings.hpp"
 #include "../video/renderer.hpp"
 #include "../video/loading_screen.hpp"
 #include "../core/i18n.hpp"
 #include "../core/global_basic.hpp"
 #include "../core/property_helper.hpp"
+#include "../user/preferences.hpp"
+#include "../core/asset_preloader.hpp"
+#include "../core/game_core.hpp"
 
 using namespace std;
 
@@ -27,6 +33,14 @@ namespace fs = boost::filesystem;
 
 namespace TSC {
 
+// sort by last use, least recently drawn first
+struct texture_last_use_sort {
+    bool operator()(const cGL_Surface* a, const cGL_Surface* b) const
+    {
+        return a->m_last_use_frame < b->m_last_use_frame;
+    }
+};
+
 /* *** *** *** *** *** cSaved_Texture *** *** *** *** *** *** *** *** *** *** *** *** */
 
 cSaved_Texture::cSaved_Texture(void)
@@ -53,10 +67,20 @@ cSaved_Texture::~cSaved_Texture(void)
 
 /* *** *** *** *** *** *** cImage_Manager *** *** *** *** *** *** *** *** *** *** *** */
 
+// about 5 seconds
+const uint32_t cImage_Manager::m_min_unused_frames = 300;
+const uint32_t cImage_Manager::m_eviction_interval = 60;
+
 cImage_Manager::cImage_Manager(void)
     : cObject_Manager<cGL_Surface>()
 {
     m_high_texture_id = 0;
+    m_eviction_count = 0;
+    m_reload_count = 0;
+    m_texture_memory = 0;
+    m_padding_saved = 0;
+    m_frame = 0;
+    m_next_eviction_frame = 0;
 }
 
 cImage_Manager::~cImage_Manager(void)
@@ -72,6 +96,12 @@ void cImage_Manager::Add(cGL_Surface* obj)
 
     // it is now managed
     obj->m_managed = 1;
+    // not evicted before it is drawn the first time
+    obj->m_last_use_frame = m_frame;
+
+    if (obj->m_image) {
+        Add_Texture_Memory(obj);
+    }
 
     // Add and remember index where it was stored
     cObject_Manager<cGL_Surface>::Add(obj);
@@ -106,6 +136,27 @@ cGL_Surface* cImage_Manager::Copy(const fs::path& path)
     }
 }
 
+// Draw the loading screen progress, at most every 50 milliseconds or when finished
+static void Draw_Texture_Progress(CEGUI::ProgressBar* progress_bar, unsigned int loaded_files, unsigned int file_count, uint32_t& last_draw_ticks)
+{
+    if (loaded_files < file_count && TSC_GetTicks() - last_draw_ticks < 50) {
+        return;
+    }
+
+    last_draw_ticks = TSC_GetTicks();
+
+    // update progress
+    progress_bar->setProgress(static_cast<float>(loaded_files) / static_cast<float>(file_count));
+
+    Loading_Screen_Draw();
+}
+
+// Decode an image on a worker thread of cImage_Manager::Restore_Textures()
+static void Restore_Texture_Job(const vector<fs::path>& filenames, vector<cVideo::cSoftware_Image>& software_images, size_t index)
+{
+    software_images[index] = pVideo->Load_Image(filenames[index]);
+}
+
 // Must be called on the loading screen, i.e. after Loading_Screen_Init() and
 // before Loading_Screen_Exit().
 void cImage_Manager::Grab_Textures(bool from_file /* = 0 */, bool draw_gui /* = 0 */)
@@ -121,35 +172,46 @@ void cImage_Manager::Grab_Textures(bool from_file /* = 0 */, bool draw_gui /* =
         Loading_Screen_Draw_Text(_("Saving Textures"));
     }
 
+    // cached image sets are parsed again with the reloaded textures
+    if (pImageSet_Cache) {
+        pImageSet_Cache->Clear();
+    }
+    // and the effect presets are created again
+    if (pActive_Animation_Manager) {
+        pActive_Animation_Manager->Clear_Effect_Presets();
+    }
+    // image settings are read again with the image files
+    if (from_file && pSettingsParser) {
+        pSettingsParser->Clear_Cache();
+    }
+
     unsigned int loaded_files = 0;
     unsigned int file_count = objects.size();
+    uint32_t last_draw_ticks = TSC_GetTicks();
 
     // save all textures
     for (GL_Surface_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
         // get surface
         cGL_Surface* obj = (*itr);
 
+        // count files
+        loaded_files++;
+
         // skip surfaces with an already deleted texture
         if (!glIsTexture(obj->m_image)) {
             continue;
         }
 
-        // get software texture and save it to software memory
-        m_saved_textures.push_back(obj->Get_Software_Texture(from_file));
+        // get software texture and save it to software memory, surfaces without a file must be read back
+        m_saved_textures.push_back(obj->Get_Software_Texture(from_file && !obj->m_path.empty()));
         // delete hardware texture
         if (glIsTexture(obj->m_image)) {
             glDeleteTextures(1, &obj->m_image);
         }
 
-        // count files
-        loaded_files++;
-
         // draw
         if (draw_gui) {
-            // update progress
-            progress_bar->setProgress(static_cast<float>(loaded_files) / static_cast<float>(file_count));
-
-            Loading_Screen_Draw();
+            Draw_Texture_Progress(progress_bar, loaded_files, file_count, last_draw_ticks);
         }
     }
 }
@@ -169,12 +231,24 @@ void cImage_Manager::Restore_Textures(bool draw_gui /* = 0 */)
 
     unsigned int loaded_files = 0;
     unsigned int file_count = m_saved_textures.size();
+    uint32_t last_draw_ticks = TSC_GetTicks();
+
+    // textures loaded again from their file
+    Saved_Texture_List file_textures;
+    vector<fs::path> filenames;
 
     // load back into hardware textures
     for (Saved_Texture_List::iterator itr = m_saved_textures.begin(); itr != m_saved_textures.end(); ++itr) {
         // get saved texture
         cSaved_Texture* soft_tex = (*itr);
 
+        // decoded on the worker threads
+        if (!soft_tex->m_pixels) {
+            file_textures.push_back(soft_tex);
+            filenames.push_back(soft_tex->m_base->m_path);
+            continue;
+        }
+
         // load it
         soft_tex->m_base->Load_Software_Texture(soft_tex);
         // delete
@@ -185,14 +259,53 @@ void cImage_Manager::Restore_Textures(bool draw_gui /* = 0 */)
 
         // draw
         if (draw_gui) {
-            // update progress
-            progress_bar->setProgress(static_cast<float>(loaded_files) / static_cast<float>(file_count));
-
-            Loading_Screen_Draw();
+            Draw_Texture_Progress(progress_bar, loaded_files, file_count, last_draw_ticks);
         }
     }
 
     m_saved_textures.clear();
+
+    // decoded images
+    vector<cVideo::cSoftware_Image> software_images(filenames.size());
+    cAsset_Preloader preloader(filenames.size(), boost::bind(&Restore_Texture_Job, boost::cref(filenames), boost::ref(software_images), _1));
+    vector<size_t> finished;
+
+    // the textures can only be created here
+    while (preloader.Wait_Finished(finished, 16)) {
+        for (vector<size_t>::iterator itr = finished.begin(); itr != finished.end(); ++itr) {
+            cSaved_Texture* soft_tex = file_textures[*itr];
+            cGL_Surface* surface_copy = pVideo->Create_GL_Surface(filenames[*itr], software_images[*itr]);
+
+            if (surface_copy) {
+                soft_tex->m_base->Take_Texture(surface_copy);
+            }
+            else {
+                cerr << "Warning: cImage_Manager :: Restore_Textures " << path_to_utf8(filenames[*itr]) << " loading failed" << endl;
+            }
+
+            delete soft_tex;
+
+            // count files
+            loaded_files++;
+        }
+
+        finished.clear();
+
+        // draw
+        if (draw_gui) {
+            Draw_Texture_Progress(progress_bar, loaded_files, file_count, last_draw_ticks);
+        }
+    }
+
+    // the texture quality may have changed the sizes
+    m_texture_memory = 0;
+    m_padding_saved = 0;
+
+    for (GL_Surface_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+        if ((*itr)->m_image) {
+            Add_Texture_Memory(*itr);
+        }
+    }
 }
 
 void cImage_Manager::Delete_Image_Textures(void)
@@ -209,7 +322,14 @@ void cImage_Manager::Delete_Image_Textures(void)
 
 bool cImage_Manager::Delete(size_t array_num, bool delete_data)
 {
+    // cached image sets may reference it
+    if (pImageSet_Cache) {
+        pImageSet_Cache->Clear();
+    }
+
     if (array_num < objects.size()) {
+        Remove_Residency(objects[array_num]);
+
         std::string filepath = path_to_utf8(objects[array_num]->m_path);
         objects.erase(objects.begin() + array_num);
         m_index_table.erase(filepath);
@@ -224,6 +344,15 @@ bool cImage_Manager::Delete(size_t array_num, bool delete_data)
 
 bool cImage_Manager::Delete(cGL_Surface* obj, bool delete_data)
 {
+    // cached image sets may reference it
+    if (pImageSet_Cache) {
+        pImageSet_Cache->Clear();
+    }
+
+    if (obj->m_managed) {
+        Remove_Residency(obj);
+    }
+
     std::string filepath = path_to_utf8(obj->m_path);
     if (cObject_Manager::Delete(obj, delete_data)) {
         m_index_table.erase(filepath);
@@ -249,10 +378,216 @@ void cImage_Manager::Delete_Hardware_Textures(void)
 
 void cImage_Manager::Delete_All(void)
 {
+    if (pImageSet_Cache) {
+        pImageSet_Cache->Clear();
+    }
+
     // stops cGL_Surface destructor from checking if GL texture id still in use
     Delete_Image_Textures();
     cObject_Manager<cGL_Surface>::Delete_All();
     m_index_table.clear();
+
+    for (Evicted_Texture_Map::iterator itr = m_evicted_textures.begin(); itr != m_evicted_textures.end(); ++itr) {
+        delete itr->second;
+    }
+
+    m_evicted_textures.clear();
+    m_pin_counts.clear();
+    m_texture_memory = 0;
+    m_padding_saved = 0;
+}
+
+void cImage_Manager::Pin(cGL_Surface* obj)
+{
+    if (!obj || !obj->m_managed) {
+        return;
+    }
+
+    m_pin_counts[obj]++;
+}
+
+void cImage_Manager::Unpin(cGL_Surface* obj)
+{
+    Pin_Count_Map::iterator itr = m_pin_counts.find(obj);
+
+    if (itr == m_pin_counts.end()) {
+        return;
+    }
+
+    itr->second--;
+
+    if (!itr->second) {
+        m_pin_counts.erase(itr);
+    }
+}
+
+void cImage_Manager::Update_Residency(void)
+{
+    m_frame++;
+
+    if (m_frame < m_next_eviction_frame) {
+        return;
+    }
+
+    m_next_eviction_frame = m_frame + m_eviction_interval;
+
+    // no limit
+    if (!pPreferences->m_video_texture_budget) {
+        return;
+    }
+
+    const size_t budget = static_cast<size_t>(pPreferences->m_video_texture_budget) * 1024 * 1024;
+
+    if (m_texture_memory <= budget) {
+        return;
+    }
+
+    // a texture shared by several surfaces can not be reloaded for all of them
+    std::unordered_map<GLuint, unsigned int> texture_users;
+
+    for (GL_Surface_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+        if ((*itr)->m_image) {
+            texture_users[(*itr)->m_image]++;
+        }
+    }
+
+    GL_Surface_List candidates;
+
+    for (GL_Surface_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+        cGL_Surface* obj = (*itr);
+
+        if (Is_Evictable(obj) && texture_users[obj->m_image] == 1) {
+            candidates.push_back(obj);
+        }
+    }
+
+    if (candidates.empty()) {
+        return;
+    }
+
+    std::sort(candidates.begin(), candidates.end(), texture_last_use_sort());
+
+    // the render thread may still draw them
+    pVideo->Render_Finish();
+
+    for (GL_Surface_List::iterator itr = candidates.begin(); itr != candidates.end(); ++itr) {
+        if (m_texture_memory <= budget) {
+            break;
+        }
+
+        Evict_Texture(*itr);
+    }
+
+    debug_print("Texture memory after eviction: %u KB, %u textures evicted\n", static_cast<unsigned int>(m_texture_memory / 1024), static_cast<unsigned int>(m_evicted_textures.size()));
+}
+
+size_t cImage_Manager::Get_Texture_Size(const cGL_Surface* obj)
+{
+    return static_cast<size_t>(obj->m_tex_w) * obj->m_tex_h * 4;
+}
+
+size_t cImage_Manager::Get_Padded_Texture_Size(const cGL_Surface* obj)
+{
+    return static_cast<size_t>(obj->m_tex_w / obj->m_tex_part_w + 0.5f) * static_cast<size_t>(obj->m_tex_h / obj->m_tex_part_h + 0.5f) * 4;
+}
+
+void cImage_Manager::Add_Texture_Memory(const cGL_Surface* obj)
+{
+    const size_t size = Get_Texture_Size(obj);
+    const size_t padded_size = Get_Padded_Texture_Size(obj);
+
+    m_texture_memory += size;
+
+    if (padded_size > size) {
+        m_padding_saved += padded_size - size;
+    }
+}
+
+void cImage_Manager::Remove_Texture_Memory(const cGL_Surface* obj)
+{
+    const size_t size = Get_Texture_Size(obj);
+    const size_t padded_size = Get_Padded_Texture_Size(obj);
+
+    m_texture_memory -= size;
+
+    if (padded_size > size) {
+        m_padding_saved -= padded_size - size;
+    }
+}
+
+bool cImage_Manager::Is_Evictable(cGL_Surface* obj) const
+{
+    // only textures which can be loaded again from their file
+    if (!obj->m_image || obj->m_evicted || !obj->m_auto_del_img || obj->m_path.empty()) {
+        return 0;
+    }
+
+    // drawn recently
+    if (obj->m_last_use_frame + m_min_unused_frames > m_frame) {
+        return 0;
+    }
+
+    if (m_pin_counts.count(obj)) {
+        return 0;
+    }
+
+    return 1;
+}
+
+void cImage_Manager::Evict_Texture(cGL_Surface* obj)
+{
+    // the render thread may still draw it
+    assert(!pVideo->Is_Render_Context_Lent());
+
+    m_evicted_textures[obj] = obj->Get_Software_Texture(1);
+    Remove_Texture_Memory(obj);
+
+    if (glIsTexture(obj->m_image)) {
+        glDeleteTextures(1, &obj->m_image);
+    }
+
+    obj->m_image = 0;
+    obj->m_repeat_texture = 0;
+    obj->m_evicted = 1;
+    m_eviction_count++;
+}
+
+void cImage_Manager::Reload_Texture(cGL_Surface* obj)
+{
+    obj->m_evicted = 0;
+
+    Evicted_Texture_Map::iterator itr = m_evicted_textures.find(obj);
+
+    if (itr == m_evicted_textures.end()) {
+        return;
+    }
+
+    cSaved_Texture* soft_tex = itr->second;
+    m_evicted_textures.erase(itr);
+
+    obj->Load_Software_Texture(soft_tex);
+    delete soft_tex;
+
+    if (obj->m_image) {
+        Add_Texture_Memory(obj);
+    }
+
+    m_reload_count++;
+}
+
+void cImage_Manager::Remove_Residency(cGL_Surface* obj)
+{
+    m_pin_counts.erase(obj);
+
+    Evicted_Texture_Map::iterator itr = m_evicted_textures.find(obj);
+
+    if (itr != m_evicted_textures.end()) {
+        delete itr->second;
+        m_evicted_textures.erase(itr);
+    }
+    else if (obj->m_image) {
+        Remove_Texture_Memory(obj);
+    }
 }
 
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
@@ -58,6 +58,12 @@ namespace TSC {
 
 //  Keeps track of all the images in memory
 //
+// Textures loaded from files are evicted from video memory when
+// the texture budget of the preferences is exceeded. The least
+// recently drawn ones go first and are loaded again from their
+// file when they are drawn the next time. Pinned textures and
+// textures drawn in the last frames are never evicted.
+//
 // Operators:
 //  - cImage_Manager [path]
 //  - cImage_Manager [identifier]
@@ -109,13 +115,96 @@ namespace TSC {
         virtual bool Delete(size_t array_num, bool delete_data = 1);
         virtual bool Delete(cGL_Surface* obj, bool delete_data = 1);
 
+        // Mark the texture of the given managed surface as drawn and load it again if evicted
+        inline void Use_Texture(cGL_Surface* obj)
+        {
+            obj->m_last_use_frame = m_frame;
+
+            if (obj->m_evicted) {
+                Reload_Texture(obj);
+            }
+        }
+
+        /* Keep the texture of the given surface in video memory
+         * Every Pin() needs an Unpin().
+        */
+        void Pin(cGL_Surface* obj);
+        void Unpin(cGL_Surface* obj);
+
+        /* Start the next frame and evict the least recently drawn textures if over the budget
+         * Must be called on the main thread after the last frame was rendered.
+        */
+        void Update_Residency(void);
+
+        // Returns the estimated video memory size of all textures in bytes
+        inline size_t Get_Texture_Memory(void) const
+        {
+            return m_texture_memory;
+        }
+        // Returns the video memory size not used for power of 2 padding in bytes, see cVideo::Create_Texture()
+        inline size_t Get_Padding_Saved(void) const
+        {
+            return m_padding_saved;
+        }
+        // Returns the number of evicted textures
+        inline unsigned int Get_Evicted_Count(void) const
+        {
+            return m_evicted_textures.size();
+        }
+        // Returns the number of pinned textures
+        inline unsigned int Get_Pinned_Count(void) const
+        {
+            return m_pin_counts.size();
+        }
+
         // highest opengl texture id found
         GLuint m_high_texture_id;
 
+        // textures evicted since initialization
+        unsigned int m_eviction_count;
+        // evicted textures loaded again since initialization
+        unsigned int m_reload_count;
+
+        // frames a texture must not have been drawn in before it can be evicted
+        static const uint32_t m_min_unused_frames;
+        // frames between eviction passes
+        static const uint32_t m_eviction_interval;
     private:
+        // Returns the estimated video memory size of the texture in bytes
+        static size_t Get_Texture_Size(const cGL_Surface* obj);
+        // Returns the estimated video memory size of the texture with the power of 2 padding in bytes
+        static size_t Get_Padded_Texture_Size(const cGL_Surface* obj);
+        // Count the texture of the surface as resident or not
+        void Add_Texture_Memory(const cGL_Surface* obj);
+        void Remove_Texture_Memory(const cGL_Surface* obj);
+        // Returns true if the texture of the surface can be evicted
+        bool Is_Evictable(cGL_Surface* obj) const;
+        // Delete the texture of the surface and remember how to load it again
+        void Evict_Texture(cGL_Surface* obj);
+        // Load an evicted texture again
+        void Reload_Texture(cGL_Surface* obj);
+        // Forget the residency data of a surface which gets deleted
+        void Remove_Residency(cGL_Surface* obj);
+
         // saved textures for reloading
         Saved_Texture_List m_saved_textures;
 
+        typedef std::unordered_map<cGL_Surface*, cSaved_Texture*> Evicted_Texture_Map;
+        typedef std::unordered_map<cGL_Surface*, unsigned int> Pin_Count_Map;
+
+        // saved evicted textures for reloading
+        Evicted_Texture_Map m_evicted_textures;
+        // pin count of the pinned surfaces
+        Pin_Count_Map m_pin_counts;
+        // estimated video memory size of the resident textures
+        size_t m_texture_memory;
+        // estimated video memory size of the padding the resident textures don't need
+        size_t m_padding_saved;
+        // current frame
+        uint32_t m_frame;
+        // frame of the next eviction pass
+        uint32_t m_next_eviction_frame;
+
         std::unordered_map<std::string, size_t> m_index_table;
     };
 
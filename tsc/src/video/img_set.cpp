@@ -21,6 +21,7 @@
 #include "../core/file_parser.hpp"
 #include "../core/filesystem/resource_manager.hpp"
 #include "../core/math/utilities.hpp"
+#include "../core/property_helper.hpp"
 #include "../core/global_basic.hpp"
 
 using namespace std;
@@ -145,6 +146,7 @@ int cImageSet::Surface::Leave(void)
 /* *** *** *** *** *** *** *** cImageSet *** *** *** *** *** *** *** *** *** *** */
 
 cImageSet::cImageSet()
+    : mp_named_ranges(NULL)
 {
     // animation data
     m_curr_img = -1;
@@ -157,8 +159,44 @@ cImageSet::cImageSet()
     m_anim_mod = 1.0f;
 }
 
+cImageSet::cImageSet(const cImageSet& other)
+    : m_curr_img(other.m_curr_img), m_anim_enabled(other.m_anim_enabled),
+      m_anim_img_start(other.m_anim_img_start), m_anim_img_end(other.m_anim_img_end),
+      m_anim_time_default(other.m_anim_time_default), m_anim_counter(other.m_anim_counter),
+      m_anim_last_ticks(other.m_anim_last_ticks), m_anim_mod(other.m_anim_mod),
+      m_images(other.m_images), mp_named_ranges(NULL)
+{
+    if (other.mp_named_ranges)
+        mp_named_ranges = new Name_Map(*other.mp_named_ranges);
+}
+
 cImageSet::~cImageSet()
 {
+    delete mp_named_ranges;
+}
+
+cImageSet& cImageSet::operator=(const cImageSet& other)
+{
+    if (this == &other)
+        return *this;
+
+    m_curr_img = other.m_curr_img;
+    m_anim_enabled = other.m_anim_enabled;
+    m_anim_img_start = other.m_anim_img_start;
+    m_anim_img_end = other.m_anim_img_end;
+    m_anim_time_default = other.m_anim_time_default;
+    m_anim_counter = other.m_anim_counter;
+    m_anim_last_ticks = other.m_anim_last_ticks;
+    m_anim_mod = other.m_anim_mod;
+    m_images = other.m_images;
+
+    delete mp_named_ranges;
+    mp_named_ranges = NULL;
+
+    if (other.mp_named_ranges)
+        mp_named_ranges = new Name_Map(*other.mp_named_ranges);
+
+    return *this;
 }
 
 void cImageSet::Add_Image(cGL_Surface* image, uint32_t time /* = 0 */)
@@ -204,38 +242,58 @@ bool cImageSet::Add_Image_Set(const std::string& name, boost::filesystem::path p
         // Parse the animation file
         filename = pResource_Manager->Get_Game_Pixmap(path_to_utf8(path));
 
-        if(!fs::exists(filename)) {
-            cerr << "Warning: Unable to load image set: " << name << " " << Get_Identity() << endl;
-            return false;
-        }
+        // already parsed
+        const Surface_List* frames = pImageSet_Cache->Get(filename, time);
 
-        Parser parser(time);
-        if(!parser.Parse(path_to_utf8(filename))) {
-            cerr << "Warning: Unable to parse image set: " << filename << endl;
-            return false;
-        }
+        if(!frames) {
+            if(!fs::exists(filename)) {
+                cerr << "Warning: Unable to load image set: " << name << " " << Get_Identity() << endl;
+                return false;
+            }
+
+            Parser parser(time);
+            if(!parser.Parse(path_to_utf8(filename))) {
+                cerr << "Warning: Unable to parse image set: " << filename << endl;
+                return false;
+            }
 
-        if(parser.m_images.size() == 0) {
-            cerr << "Warning: Empty image set: " << filename << endl;
-            return false;
+            if(parser.m_images.size() == 0) {
+                cerr << "Warning: Empty image set: " << filename << endl;
+                return false;
+            }
+
+            // load images
+            Surface_List new_frames;
+
+            for(Parser::List_Type::iterator itr = parser.m_images.begin(); itr != parser.m_images.end(); ++itr) {
+                Surface frame;
+                frame.m_image = pVideo->Get_Surface(itr->m_filename);
+
+                if(frame.m_image) {
+                    frame.m_info = *itr;
+                    new_frames.push_back(frame);
+                }
+            }
+
+            frames = pImageSet_Cache->Add(filename, time, new_frames);
         }
 
         // Add images
-        for(Parser::List_Type::iterator itr = parser.m_images.begin(); itr != parser.m_images.end(); ++itr) {
-            cGL_Surface* surface = pVideo->Get_Surface(itr->m_filename);
-            if(surface) {
-                Add_Image(surface, itr->m_time_min);
+        for(Surface_List::const_iterator itr = frames->begin(); itr != frames->end(); ++itr) {
+            Add_Image(itr->m_image, itr->m_info.m_time_min);
 
-                // update info
-                m_images.back().m_info = *itr;
-            }
+            // update info
+            m_images.back().m_info = itr->m_info;
         }
     }
     end = m_images.size() - 1;
 
     // Add the item
     if(end >= start) {
-        m_named_ranges[name] = std::pair<int, int>(start, end);
+        if (!mp_named_ranges)
+            mp_named_ranges = new Name_Map;
+
+        (*mp_named_ranges)[name] = std::pair<int, int>(start, end);
 
         if(start_num)
             *start_num = start;
@@ -253,9 +311,9 @@ bool cImageSet::Add_Image_Set(const std::string& name, boost::filesystem::path p
 
 bool cImageSet::Set_Image_Set(const std::string& name, bool new_startimage /* =0 */)
 {
-    Name_Map::iterator it = m_named_ranges.find(name);
+    Name_Map::iterator it;
 
-    if(it == m_named_ranges.end()) {
+    if(!mp_named_ranges || (it = mp_named_ranges->find(name)) == mp_named_ranges->end()) {
         cerr << "Warning: Named image set not found: " << name << " " << Get_Identity() << endl;
         Set_Image_Num(-1, new_startimage);
         Set_Animation(0);
@@ -315,7 +373,8 @@ void cImageSet::Clear_Images(bool reset_image/*=false*/, bool reset_startimage/*
 {
     m_curr_img = -1;
     m_images.clear();
-    m_named_ranges.clear();
+    delete mp_named_ranges;
+    mp_named_ranges = NULL;
 
     if(reset_image) {
         Set_Image_Set_Image(NULL, reset_startimage);
@@ -422,6 +481,46 @@ void cSimpleImageSet::Set_Image_Set_Image(cGL_Surface* new_image, bool new_start
     m_image = new_image;
 }
 
+/* *** *** *** *** *** *** cImageSet_Cache *** *** *** *** *** *** *** *** *** */
+cImageSet_Cache::cImageSet_Cache(void)
+{
+}
+
+cImageSet_Cache::~cImageSet_Cache(void)
+{
+}
+
+std::string cImageSet_Cache::Get_Key(const fs::path& filename, uint32_t time)
+{
+    return path_to_utf8(filename) + ":" + int_to_string(time);
+}
+
+const cImageSet::Surface_List* cImageSet_Cache::Get(const fs::path& filename, uint32_t time) const
+{
+    Image_Set_Map::const_iterator itr = m_image_sets.find(Get_Key(filename, time));
+
+    if(itr == m_image_sets.end()) {
+        return NULL;
+    }
+
+    return &itr->second;
+}
+
+const cImageSet::Surface_List* cImageSet_Cache::Add(const fs::path& filename, uint32_t time, const cImageSet::Surface_List& frames)
+{
+    cImageSet::Surface_List& cached = m_image_sets[Get_Key(filename, time)];
+    cached = frames;
+
+    return &cached;
+}
+
+void cImageSet_Cache::Clear(void)
+{
+    m_image_sets.clear();
+}
+
+cImageSet_Cache* pImageSet_Cache = NULL;
+
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
 
 } // namespace TSC
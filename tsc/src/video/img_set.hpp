@@ -80,9 +80,12 @@ namespace TSC {
 
         // constructor
         cImageSet();
+        cImageSet(const cImageSet& other);
         // destructor
         virtual ~cImageSet(void);
 
+        cImageSet& operator=(const cImageSet& other);
+
         /* Add an image to the animation
          * NULL image is allowed
          * time: if not set uses the default display time
@@ -175,8 +178,9 @@ namespace TSC {
         Surface_List m_images;
 
         // Image set names
+        // only allocated once the first named set is added, as most sprites never use one
         typedef std::map<std::string, std::pair<int, int> > Name_Map;
-        Name_Map m_named_ranges;
+        Name_Map* mp_named_ranges;
 
     };
 
@@ -205,6 +209,39 @@ namespace TSC {
         cGL_Surface* m_image;
     };
 
+    /* *** *** *** *** *** *** cImageSet_Cache *** *** *** *** *** *** *** *** *** */
+
+    /* Keeps the frames of every parsed image set file
+     * so objects using the same animation only copy them
+     * The surfaces are owned by the image manager which clears
+     * this cache when it deletes or reloads them
+    */
+    class cImageSet_Cache {
+    public:
+        cImageSet_Cache(void);
+        ~cImageSet_Cache(void);
+
+        /* Return the frames of the given image set file or NULL if not cached
+         * time : default frame time the file was parsed with
+        */
+        const cImageSet::Surface_List* Get(const boost::filesystem::path& filename, uint32_t time) const;
+        // Store the frames of the given image set file
+        const cImageSet::Surface_List* Add(const boost::filesystem::path& filename, uint32_t time, const cImageSet::Surface_List& frames);
+
+        // Remove all cached image sets
+        void Clear(void);
+
+    private:
+        // Return the cache key
+        static std::string Get_Key(const boost::filesystem::path& filename, uint32_t time);
+
+        typedef std::unordered_map<std::string, cImageSet::Surface_List> Image_Set_Map;
+        Image_Set_Map m_image_sets;
+    };
+
+    // Image Set Cache
+    extern cImageSet_Cache* pImageSet_Cache;
+
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
 
 } // namespace TSC
@@ -247,18 +247,49 @@ cImage_Settings_Parser::cImage_Settings_Parser(void)
 
 cImage_Settings_Parser::~cImage_Settings_Parser(void)
 {
-    //
+    Clear_Cache();
 }
 
 cImage_Settings_Data* cImage_Settings_Parser::Get(const boost::filesystem::path& filename, bool load_base_settings /* = 1 */)
 {
+    boost::lock_guard<boost::recursive_mutex> lock(m_mutex);
+
+    const std::string key = path_to_utf8(filename) + (load_base_settings ? ":1" : ":0");
+    Settings_Map::iterator itr = m_cache.find(key);
+
+    // already parsed
+    if (itr != m_cache.end()) {
+        return new cImage_Settings_Data(*itr->second);
+    }
+
+    // base settings are loaded while parsing, keep the state of the file including them
+    cImage_Settings_Data* parent_settings = m_settings_temp;
+    bool parent_load_base = m_load_base;
+    fs::path parent_file = data_file;
+
     m_load_base = load_base_settings;
     m_settings_temp = new cImage_Settings_Data();
 
     Parse(filename);
     cImage_Settings_Data* settings = m_settings_temp;
-    m_settings_temp = NULL;
-    return settings;
+
+    m_settings_temp = parent_settings;
+    m_load_base = parent_load_base;
+    data_file = parent_file;
+
+    m_cache[key] = settings;
+    return new cImage_Settings_Data(*settings);
+}
+
+void cImage_Settings_Parser::Clear_Cache(void)
+{
+    boost::lock_guard<boost::recursive_mutex> lock(m_mutex);
+
+    for (Settings_Map::iterator itr = m_cache.begin(); itr != m_cache.end(); ++itr) {
+        delete itr->second;
+    }
+
+    m_cache.clear();
 }
 
 bool cImage_Settings_Parser::HandleMessage(const std::string* parts, unsigned int count, unsigned int line)
@@ -297,11 +328,8 @@ bool cImage_Settings_Parser::HandleMessage(const std::string* parts, unsigned in
                         break;
                     }
 
-                    // create new temporary parser
-                    cImage_Settings_Parser* temp_parser = new cImage_Settings_Parser();
-                    cImage_Settings_Data* base_settings = temp_parser->Get(settings_file);
-                    // finished loading base settings
-                    delete temp_parser;
+                    // parsed with its own base settings or taken from the cache
+                    cImage_Settings_Data* base_settings = Get(settings_file);
                     settings_file.clear();
 
                     // handle
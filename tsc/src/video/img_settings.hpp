@@ -21,6 +21,7 @@
 #include "../core/file_parser.hpp"
 #include "../video/gl_surface.hpp"
 #include "../core/math/rect.hpp"
+#include <boost/thread/recursive_mutex.hpp>
 
 namespace TSC {
 
@@ -81,9 +82,14 @@ namespace TSC {
         /* Returns the settings from the given file
          * load_base_settings : if set will overwrite settings with all base settings if available
          * The returned settings data should be deleted if not used anymore
+         * Every file is only parsed once and then copied from the cache
+         * Can be used from other threads, see cAsset_Preloader.
         */
         cImage_Settings_Data* Get(const boost::filesystem::path& filename, bool load_base_settings = 1);
 
+        // Remove all cached settings so they are parsed again
+        void Clear_Cache(void);
+
         // Handle one tokenized line
         virtual bool HandleMessage(const std::string* parts, unsigned int count, unsigned int line);
 
@@ -91,6 +97,13 @@ namespace TSC {
         cImage_Settings_Data* m_settings_temp;
         // load base settings
         bool m_load_base;
+
+    private:
+        typedef std::unordered_map<std::string, cImage_Settings_Data*> Settings_Map;
+        // parsed settings by filename and base loading
+        Settings_Map m_cache;
+        // locks the cache and the parsing state, Get() is called again for base settings
+        boost::recursive_mutex m_mutex;
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
@@ -16,6 +16,7 @@
 
 #include "../core/global_basic.hpp"
 #include "../video/renderer.hpp"
+#include "../video/sprite_shader.hpp"
 #include "../core/game_core.hpp"
 #include "../core/global_basic.hpp"
 
@@ -28,7 +29,238 @@ namespace TSC {
 #endif
 
 const float doubled_pi = static_cast<float>(M_PI * 2.0f);
-static GLuint last_bind_texture = 0;
+// state set by the render requests
+static cGL_State gl_state;
+// camera position of the rendered queue
+static float render_camera_x = 0.0f;
+static float render_camera_y = 0.0f;
+
+/* *** *** *** *** *** *** cGL_State *** *** *** *** *** *** *** *** *** *** *** */
+
+cGL_State::cGL_State(void)
+{
+    m_texture_2d = 0;
+    m_bound_texture = 0;
+    m_blend_sfactor = GL_SRC_ALPHA;
+    m_blend_dfactor = GL_ONE_MINUS_SRC_ALPHA;
+    m_color = white;
+    m_combine_type = 0;
+    m_combine_color[0] = 0.0f;
+    m_combine_color[1] = 0.0f;
+    m_combine_color[2] = 0.0f;
+    m_line_width = 1.0f;
+    m_line_stipple = 0;
+    m_sprite_shader = 0;
+
+    Invalidate();
+}
+
+void cGL_State::Invalidate(void)
+{
+    m_texture_2d_valid = 0;
+    m_bound_texture_valid = 0;
+    m_blend_valid = 0;
+    m_color_valid = 0;
+    m_combine_valid = 0;
+    m_line_width_valid = 0;
+    m_line_stipple_valid = 0;
+    m_sprite_shader_valid = 0;
+
+    m_calls_issued = 0;
+    m_calls_skipped = 0;
+}
+
+void cGL_State::Set_Defaults(void)
+{
+    Set_Sprite_Shader(0);
+    Set_Blend_Func(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    Set_Color(white);
+    Set_Combine(0, NULL);
+    Set_Line_Width(1.0f);
+    Set_Line_Stipple(0);
+}
+
+void cGL_State::Set_Texture_2D(bool enable)
+{
+    if (m_texture_2d_valid && m_texture_2d == enable) {
+        m_calls_skipped++;
+        return;
+    }
+
+    if (enable) {
+        glEnable(GL_TEXTURE_2D);
+    }
+    else {
+        glDisable(GL_TEXTURE_2D);
+    }
+
+    m_texture_2d = enable;
+    m_texture_2d_valid = 1;
+    m_calls_issued++;
+}
+
+void cGL_State::Bind_Texture(GLuint texture_id)
+{
+    if (m_bound_texture_valid && m_bound_texture == texture_id) {
+        m_calls_skipped++;
+        return;
+    }
+
+    glBindTexture(GL_TEXTURE_2D, texture_id);
+
+    m_bound_texture = texture_id;
+    m_bound_texture_valid = 1;
+    m_calls_issued++;
+}
+
+void cGL_State::Texture_Changed(void)
+{
+    m_bound_texture_valid = 0;
+}
+
+void cGL_State::Set_Blend_Func(GLenum sfactor, GLenum dfactor)
+{
+    if (m_blend_valid && m_blend_sfactor == sfactor && m_blend_dfactor == dfactor) {
+        m_calls_skipped++;
+        return;
+    }
+
+    glBlendFunc(sfactor, dfactor);
+
+    m_blend_sfactor = sfactor;
+    m_blend_dfactor = dfactor;
+    m_blend_valid = 1;
+    m_calls_issued++;
+}
+
+void cGL_State::Set_Color(const Color& color)
+{
+    if (m_color_valid && m_color == color) {
+        m_calls_skipped++;
+        return;
+    }
+
+    glColor4ub(color.red, color.green, color.blue, color.alpha);
+
+    Color_Changed(color);
+    m_calls_issued++;
+}
+
+void cGL_State::Color_Changed(const Color& color)
+{
+    m_color = color;
+    m_color_valid = 1;
+}
+
+void cGL_State::Set_Combine(GLint combine_type, const float* combine_color)
+{
+    // modulate
+    if (!combine_type) {
+        if (m_combine_valid && !m_combine_type) {
+            m_calls_skipped++;
+            return;
+        }
+
+        glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+        m_calls_issued++;
+    }
+    // combine with a constant color
+    else {
+        // the sources stay set while combining
+        if (!m_combine_valid || !m_combine_type) {
+            glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_COMBINE);
+            glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE0_RGB, GL_CONSTANT);
+            glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE1_RGB, GL_TEXTURE);
+            m_calls_issued += 3;
+        }
+        else {
+            m_calls_skipped += 3;
+        }
+
+        if (!m_combine_valid || m_combine_type != combine_type) {
+            glTexEnvi(GL_TEXTURE_ENV, GL_COMBINE_RGB, combine_type);
+            m_calls_issued++;
+        }
+        else {
+            m_calls_skipped++;
+        }
+
+        if (!m_combine_valid || !m_combine_type || m_combine_color[0] != combine_color[0] || m_combine_color[1] != combine_color[1] || m_combine_color[2] != combine_color[2]) {
+            glTexEnvfv(GL_TEXTURE_ENV, GL_TEXTURE_ENV_COLOR, combine_color);
+            m_combine_color[0] = combine_color[0];
+            m_combine_color[1] = combine_color[1];
+            m_combine_color[2] = combine_color[2];
+            m_calls_issued++;
+        }
+        else {
+            m_calls_skipped++;
+        }
+    }
+
+    m_combine_type = combine_type;
+    m_combine_valid = 1;
+}
+
+void cGL_State::Set_Line_Width(float width)
+{
+    if (m_line_width_valid && m_line_width == width) {
+        m_calls_skipped++;
+        return;
+    }
+
+    glLineWidth(width);
+
+    m_line_width = width;
+    m_line_width_valid = 1;
+    m_calls_issued++;
+}
+
+void cGL_State::Set_Line_Stipple(GLushort pattern)
+{
+    if (m_line_stipple_valid && m_line_stipple == pattern) {
+        m_calls_skipped++;
+        return;
+    }
+
+    if (!pattern) {
+        glDisable(GL_LINE_STIPPLE);
+        m_calls_issued++;
+    }
+    else {
+        // keep it enabled if only the pattern changes
+        if (!m_line_stipple_valid || !m_line_stipple) {
+            glEnable(GL_LINE_STIPPLE);
+            m_calls_issued++;
+        }
+
+        glLineStipple(2, pattern);
+        m_calls_issued++;
+    }
+
+    m_line_stipple = pattern;
+    m_line_stipple_valid = 1;
+}
+
+void cGL_State::Set_Sprite_Shader(bool enable)
+{
+    if (m_sprite_shader_valid && m_sprite_shader == enable) {
+        m_calls_skipped++;
+        return;
+    }
+
+    if (enable) {
+        pVideo->mp_sprite_shader->Bind();
+        m_calls_issued++;
+    }
+    // without shader support no program was ever used
+    else if (pVideo->mp_sprite_shader) {
+        cSprite_Shader::Unbind();
+        m_calls_issued++;
+    }
+
+    m_sprite_shader = enable;
+    m_sprite_shader_valid = 1;
+}
 
 /* *** *** *** *** *** *** cRender_Request *** *** *** *** *** *** *** *** *** *** *** */
 
@@ -111,17 +343,12 @@ void cRender_Request_Advanced::Render_Basic(void)
     }
 
     // blend factor
-    if (m_blend_sfactor != GL_SRC_ALPHA || m_blend_dfactor != GL_ONE_MINUS_SRC_ALPHA) {
-        glBlendFunc(m_blend_sfactor, m_blend_dfactor);
-    }
+    gl_state.Set_Blend_Func(m_blend_sfactor, m_blend_dfactor);
 }
 
 void cRender_Request_Advanced::Render_Basic_Clear(void) const
 {
-    // clear blend factor
-    if (m_blend_sfactor != GL_SRC_ALPHA || m_blend_dfactor != GL_ONE_MINUS_SRC_ALPHA) {
-        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    }
+    // the state is kept for the next request
 
     // if debug build check for errors
 #ifdef _DEBUG
@@ -148,24 +375,14 @@ void cRender_Request_Advanced::Render_Advanced(void)
     }
 
     // Color Combine
-    if (m_combine_type != 0) {
-        glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_COMBINE);
-        glTexEnvi(GL_TEXTURE_ENV, GL_COMBINE_RGB, m_combine_type);
-        glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE0_RGB, GL_CONSTANT);
-        glTexEnvfv(GL_TEXTURE_ENV, GL_TEXTURE_ENV_COLOR, m_combine_color);
-        glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE1_RGB, GL_TEXTURE);
+    if (!gl_state.Is_Sprite_Shader()) {
+        gl_state.Set_Combine(m_combine_type, m_combine_color);
     }
 }
 
-void cRender_Request_Advanced::Render_Advanced_Clear(void) const
+bool cRender_Request_Advanced::Can_Use_Sprite_Shader(void) const
 {
-    // clear color modifications
-    if (m_combine_type != 0) {
-        float col[3] = { 0.0f, 0.0f, 0.0f };
-        glTexEnvfv(GL_TEXTURE_ENV, GL_TEXTURE_ENV_COLOR, col);
-        glTexEnvi(GL_TEXTURE_ENV, GL_COMBINE_RGB, GL_MODULATE);
-        glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
-    }
+    return pVideo->mp_sprite_shader && cSprite_Shader::Supports_Combine(m_combine_type);
 }
 
 /* *** *** *** *** *** *** cLine_Request *** *** *** *** *** *** *** *** *** *** *** */
@@ -191,7 +408,7 @@ void cLine_Request::Draw(void)
 
     // set camera position
     if (!m_no_camera) {
-        glTranslatef(-pActive_Camera->m_x, -pActive_Camera->m_y, m_pos_z);
+        glTranslatef(-render_camera_x, -render_camera_y, m_pos_z);
     }
     else {
         // only z position
@@ -201,44 +418,19 @@ void cLine_Request::Draw(void)
     Render_Advanced();
 
     // color
-    if (m_color.red != 255 || m_color.green != 255 || m_color.blue != 255 || m_color.alpha != 255) {
-        glColor4ub(m_color.red, m_color.green, m_color.blue, m_color.alpha);
-    }
+    gl_state.Set_Color(m_color);
 
-    if (glIsEnabled(GL_TEXTURE_2D)) {
-        glDisable(GL_TEXTURE_2D);
-    }
+    gl_state.Set_Texture_2D(0);
+    gl_state.Set_Sprite_Shader(0);
 
-    // change width
-    if (m_line_width != 1.0f) {
-        glLineWidth(m_line_width);
-    }
-    // enable stipple pattern
-    if (m_stipple_pattern != 0) {
-        glEnable(GL_LINE_STIPPLE);
-        glLineStipple(2, m_stipple_pattern);
-    }
+    gl_state.Set_Line_Width(m_line_width);
+    gl_state.Set_Line_Stipple(m_stipple_pattern);
 
     glBegin(GL_LINES);
     glVertex2f(m_line.m_x1, m_line.m_y1);
     glVertex2f(m_line.m_x2, m_line.m_y2);
     glEnd();
 
-    // clear stipple pattern
-    if (m_stipple_pattern != 0) {
-        glDisable(GL_LINE_STIPPLE);
-    }
-    // clear line width
-    if (m_line_width != 1.0f) {
-        glLineWidth(1.0f);
-    }
-
-    // clear color
-    if (m_color.red != 255 || m_color.green != 255 || m_color.blue != 255 || m_color.alpha != 255) {
-        glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
-    }
-
-    Render_Advanced_Clear();
     Render_Basic_Clear();
 }
 
@@ -278,8 +470,8 @@ void cRect_Request::Draw(void)
 
     // set camera position
     if (!m_no_camera) {
-        final_pos_x -= pActive_Camera->m_x;
-        final_pos_y -= pActive_Camera->m_y;
+        final_pos_x -= render_camera_x;
+        final_pos_y -= render_camera_y;
     }
 
     glTranslatef(final_pos_x, final_pos_y, m_pos_z);
@@ -292,27 +484,17 @@ void cRect_Request::Draw(void)
     Render_Advanced();
 
     // color
-    if (m_color.red != 255 || m_color.green != 255 || m_color.blue != 255 || m_color.alpha != 255) {
-        glColor4ub(m_color.red, m_color.green, m_color.blue, m_color.alpha);
-    }
+    gl_state.Set_Color(m_color);
 
-    if (glIsEnabled(GL_TEXTURE_2D)) {
-        glDisable(GL_TEXTURE_2D);
-    }
+    gl_state.Set_Texture_2D(0);
+    gl_state.Set_Sprite_Shader(0);
 
     if (m_filled) {
         glBegin(GL_POLYGON);
     }
     else {
-        // change width
-        if (m_line_width != 1.0f) {
-            glLineWidth(m_line_width);
-        }
-        // enable stipple pattern
-        if (m_stipple_pattern != 0) {
-            glEnable(GL_LINE_STIPPLE);
-            glLineStipple(2, m_stipple_pattern);
-        }
+        gl_state.Set_Line_Width(m_line_width);
+        gl_state.Set_Line_Stipple(m_stipple_pattern);
 
         glBegin(GL_LINE_LOOP);
     }
@@ -326,21 +508,6 @@ void cRect_Request::Draw(void)
     glVertex2f(-half_w, half_h);
     glEnd();
 
-    // clear stipple pattern
-    if (m_stipple_pattern != 0) {
-        glDisable(GL_LINE_STIPPLE);
-    }
-    // clear line width
-    if (m_line_width != 1.0f) {
-        glLineWidth(1.0f);
-    }
-
-    // clear color
-    if (m_color.red != 255 || m_color.green != 255 || m_color.blue != 255 || m_color.alpha != 255) {
-        glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
-    }
-
-    Render_Advanced_Clear();
     Render_Basic_Clear();
 }
 
@@ -367,16 +534,15 @@ void cGradient_Request::Draw(void)
 
     // set camera position
     if (!m_no_camera) {
-        glTranslatef(m_rect.m_x - pActive_Camera->m_x, m_rect.m_y - pActive_Camera->m_y, m_pos_z);
+        glTranslatef(m_rect.m_x - render_camera_x, m_rect.m_y - render_camera_y, m_pos_z);
     }
     // ignore camera position
     else {
         glTranslatef(m_rect.m_x, m_rect.m_y, m_pos_z);
     }
 
-    if (glIsEnabled(GL_TEXTURE_2D)) {
-        glDisable(GL_TEXTURE_2D);
-    }
+    gl_state.Set_Texture_2D(0);
+    gl_state.Set_Sprite_Shader(0);
 
     Render_Advanced();
 
@@ -390,6 +556,7 @@ void cGradient_Request::Draw(void)
         glVertex2f(0.0f, m_rect.m_h);
         glEnd();
 
+        gl_state.Color_Changed(m_color_2);
     }
     else if (m_dir == DIR_HORIZONTAL) {
         glBegin(GL_POLYGON);
@@ -400,12 +567,10 @@ void cGradient_Request::Draw(void)
         glVertex2f(m_rect.m_w, 0.0f);
         glVertex2f(m_rect.m_w, m_rect.m_h);
         glEnd();
-    }
 
-    // clear color
-    glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
+        gl_state.Color_Changed(m_color_2);
+    }
 
-    Render_Advanced_Clear();
     Render_Basic_Clear();
 }
 
@@ -433,7 +598,7 @@ void cCircle_Request::Draw(void)
 
     // set camera position
     if (!m_no_camera) {
-        glTranslatef(m_pos.m_x - pActive_Camera->m_x, m_pos.m_y - pActive_Camera->m_y, m_pos_z);
+        glTranslatef(m_pos.m_x - render_camera_x, m_pos.m_y - render_camera_y, m_pos_z);
     }
     // ignore camera position
     else {
@@ -443,18 +608,15 @@ void cCircle_Request::Draw(void)
     Render_Advanced();
 
     // color
-    if (m_color.red != 255 || m_color.green != 255 || m_color.blue != 255 || m_color.alpha != 255) {
-        glColor4ub(m_color.red, m_color.green, m_color.blue, m_color.alpha);
-    }
+    gl_state.Set_Color(m_color);
 
-    if (glIsEnabled(GL_TEXTURE_2D)) {
-        glDisable(GL_TEXTURE_2D);
-    }
+    gl_state.Set_Texture_2D(0);
+    gl_state.Set_Sprite_Shader(0);
 
     // not filled
     if (m_line_width) {
-        // set line width
-        glLineWidth(m_line_width);
+        gl_state.Set_Line_Width(m_line_width);
+        gl_state.Set_Line_Stipple(0);
 
         glBegin(GL_LINE_STRIP);
     }
@@ -487,17 +649,6 @@ void cCircle_Request::Draw(void)
 
     glEnd();
 
-    // clear line width
-    if (m_line_width != 1) {
-        glLineWidth(1.0f);
-    }
-
-    // clear color
-    if (m_color.red != 255 || m_color.green != 255 || m_color.blue != 255 || m_color.alpha != 255) {
-        glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
-    }
-
-    Render_Advanced_Clear();
     Render_Basic_Clear();
 }
 
@@ -515,6 +666,9 @@ cSurface_Request::cSurface_Request(void)
     m_w = 0.0f;
     m_h = 0.0f;
 
+    m_tex_part_w = 1.0f;
+    m_tex_part_h = 1.0f;
+
     m_scale_x = 1.0f;
     m_scale_y = 1.0f;
     m_scale_z = 1.0f;
@@ -533,8 +687,14 @@ cSurface_Request::~cSurface_Request(void)
 
 void cSurface_Request::Draw(void)
 {
+    const bool sprite_shader = Can_Use_Sprite_Shader();
+    /* the sprite shader draws the shadow together with the surface
+     * if its offset can be moved back from the rotated and scaled space
+    */
+    const bool shader_shadow = m_shadow_pos && sprite_shader && !m_rot_x && !m_rot_y && !m_rot_z && m_scale_x && m_scale_y && m_scale_z;
+
     // draw shadow
-    if (m_shadow_pos) {
+    if (m_shadow_pos && !shader_shadow) {
         // shadow position
         m_pos_x += m_shadow_pos;
         m_pos_y += m_shadow_pos;
@@ -580,14 +740,17 @@ void cSurface_Request::Draw(void)
     // get half the size
     const float half_w = m_w / 2;
     const float half_h = m_h / 2;
+    // bottom right corner of the texture, the padding behind it is not drawn
+    const float tex_right = -half_w + (m_w * m_tex_part_w);
+    const float tex_bottom = -half_h + (m_h * m_tex_part_h);
     // position
     float final_pos_x = m_pos_x + (half_w * m_scale_x);
     float final_pos_y = m_pos_y + (half_h * m_scale_y);
 
     // set camera position
     if (!m_no_camera) {
-        final_pos_x -= pActive_Camera->m_x;
-        final_pos_y -= pActive_Camera->m_y;
+        final_pos_x -= render_camera_x;
+        final_pos_y -= render_camera_y;
     }
 
     glTranslatef(final_pos_x, final_pos_y, m_pos_z);
@@ -597,51 +760,188 @@ void cSurface_Request::Draw(void)
         glScalef(m_scale_x, m_scale_y, m_scale_z);
     }
 
+    gl_state.Set_Sprite_Shader(sprite_shader);
+
     Render_Advanced();
 
     // color
-    if (m_color.red != 255 || m_color.green != 255 || m_color.blue != 255 || m_color.alpha != 255) {
-        glColor4ub(m_color.red, m_color.green, m_color.blue, m_color.alpha);
+    if (shader_shadow) {
+        // shadow as a white texture
+        Color shadow_color = black;
+        // keep m_shadow_color alpha
+        shadow_color.alpha = m_shadow_color.alpha;
+
+        gl_state.Set_Color(shadow_color);
+    }
+    else {
+        gl_state.Set_Color(m_color);
     }
 
-    if (!glIsEnabled(GL_TEXTURE_2D)) {
-        glEnable(GL_TEXTURE_2D);
+    gl_state.Set_Texture_2D(1);
+
+    gl_state.Bind_Texture(m_texture_id);
+
+    // combine settings are passed per vertex
+    if (sprite_shader) {
+        glBegin(GL_QUADS);
+
+        if (shader_shadow) {
+            const float shadow_x = m_shadow_pos / m_scale_x;
+            const float shadow_y = m_shadow_pos / m_scale_y;
+
+            glNormal3f(static_cast<float>(m_shadow_color.red) / 260, static_cast<float>(m_shadow_color.green) / 260, static_cast<float>(m_shadow_color.blue) / 260);
+            cSprite_Shader::Add_Quad(-half_w + shadow_x, -half_h + shadow_y, tex_right + shadow_x, tex_bottom + shadow_y, -0.000001f / m_scale_z, 0.0f, 0.0f, 1.0f, 1.0f, cSprite_Shader::Get_Combine_Mode(GL_REPLACE));
+
+            glColor4ub(m_color.red, m_color.green, m_color.blue, m_color.alpha);
+            gl_state.Color_Changed(m_color);
+        }
+
+        glNormal3fv(m_combine_color);
+        cSprite_Shader::Add_Quad(-half_w, -half_h, tex_right, tex_bottom, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, cSprite_Shader::Get_Combine_Mode(m_combine_type));
+        glEnd();
+    }
+    else {
+        /* vertex arrays should not be used to draw simple primitives as it
+         * does have no positive performance gain
+        */
+        // rectangle
+        glBegin(GL_QUADS);
+        // top left
+        glTexCoord2f(0.0f, 0.0f);
+        glVertex2f(-half_w, -half_h);
+        // top right
+        glTexCoord2f(1.0f, 0.0f);
+        glVertex2f(tex_right, -half_h);
+        // bottom right
+        glTexCoord2f(1.0f, 1.0f);
+        glVertex2f(tex_right, tex_bottom);
+        // bottom left
+        glTexCoord2f(0.0f, 1.0f);
+        glVertex2f(-half_w, tex_bottom);
+        glEnd();
+    }
+
+    Render_Basic_Clear();
+}
+
+/* *** *** *** *** *** *** cRepeat_Surface_Request *** *** *** *** *** *** *** *** *** *** *** */
+
+cRepeat_Surface_Request::cRepeat_Surface_Request(void)
+    : cRender_Request_Advanced()
+{
+    m_type = REND_REPEAT_SURFACE;
+    m_texture_id = 0;
+    m_set_repeat = 0;
+
+    m_tex_x = 0.0f;
+    m_tex_y = 0.0f;
+    m_tex_w = 1.0f;
+    m_tex_h = 1.0f;
+
+    m_color = static_cast<uint8_t>(255);
+}
+
+cRepeat_Surface_Request::~cRepeat_Surface_Request(void)
+{
+
+}
+
+void cRepeat_Surface_Request::Draw(void)
+{
+    const bool sprite_shader = Can_Use_Sprite_Shader();
+
+    Render_Basic();
+
+    // set camera position
+    if (!m_no_camera) {
+        glTranslatef(m_rect.m_x - render_camera_x, m_rect.m_y - render_camera_y, m_pos_z);
+    }
+    else {
+        glTranslatef(m_rect.m_x, m_rect.m_y, m_pos_z);
     }
 
-    // only bind if not the same texture
-    if (last_bind_texture != m_texture_id) {
-        glBindTexture(GL_TEXTURE_2D, m_texture_id);
-        last_bind_texture = m_texture_id;
+    gl_state.Set_Sprite_Shader(sprite_shader);
+
+    Render_Advanced();
+
+    // color
+    gl_state.Set_Color(m_color);
+
+    gl_state.Set_Texture_2D(1);
+
+    gl_state.Bind_Texture(m_texture_id);
+
+    // textures are created clamped
+    if (m_set_repeat) {
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
     }
 
-    /* vertex arrays should not be used to draw simple primitives as it
-     * does have no positive performance gain
-    */
-    // rectangle
     glBegin(GL_QUADS);
-    // top left
-    glTexCoord2f(0.0f, 0.0f);
-    glVertex2f(-half_w, -half_h);
-    // top right
-    glTexCoord2f(1.0f, 0.0f);
-    glVertex2f(half_w, -half_h);
-    // bottom right
-    glTexCoord2f(1.0f, 1.0f);
-    glVertex2f(half_w, half_h);
-    // bottom left
-    glTexCoord2f(0.0f, 1.0f);
-    glVertex2f(-half_w, half_h);
+
+    // combine settings are passed per vertex
+    if (sprite_shader) {
+        glNormal3fv(m_combine_color);
+        cSprite_Shader::Add_Quad(0.0f, 0.0f, m_rect.m_w, m_rect.m_h, 0.0f, m_tex_x, m_tex_y, m_tex_x + m_tex_w, m_tex_y + m_tex_h, cSprite_Shader::Get_Combine_Mode(m_combine_type));
+    }
+    else {
+        // top left
+        glTexCoord2f(m_tex_x, m_tex_y);
+        glVertex2f(0.0f, 0.0f);
+        // top right
+        glTexCoord2f(m_tex_x + m_tex_w, m_tex_y);
+        glVertex2f(m_rect.m_w, 0.0f);
+        // bottom right
+        glTexCoord2f(m_tex_x + m_tex_w, m_tex_y + m_tex_h);
+        glVertex2f(m_rect.m_w, m_rect.m_h);
+        // bottom left
+        glTexCoord2f(m_tex_x, m_tex_y + m_tex_h);
+        glVertex2f(0.0f, m_rect.m_h);
+    }
+
     glEnd();
 
-    // clear color
-    if (m_color.red != 255 || m_color.green != 255 || m_color.blue != 255 || m_color.alpha != 255) {
-        /* alpha is automatically 1 for glColor3f
-         * update : not on the shitty intel drivers :(
-        */
-        glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
+    Render_Basic_Clear();
+}
+
+/* *** *** *** *** *** *** cDisplay_List_Request *** *** *** *** *** *** *** *** *** *** *** */
+
+cDisplay_List_Request::cDisplay_List_Request(void)
+    : cRender_Request_Advanced()
+{
+    m_type = REND_DISPLAY_LIST;
+    m_display_list = 0;
+}
+
+cDisplay_List_Request::~cDisplay_List_Request(void)
+{
+
+}
+
+void cDisplay_List_Request::Draw(void)
+{
+    Render_Basic();
+
+    // set camera position
+    if (!m_no_camera) {
+        glTranslatef(-render_camera_x, -render_camera_y, 0.0f);
     }
 
-    Render_Advanced_Clear();
+    gl_state.Set_Texture_2D(1);
+    // lists are compiled for the sprite shader if available
+    gl_state.Set_Sprite_Shader(pVideo->mp_sprite_shader != NULL);
+    // the list sets its own colors on top of the default state
+    if (!gl_state.Is_Sprite_Shader()) {
+        gl_state.Set_Combine(0, NULL);
+    }
+    gl_state.Set_Color(white);
+
+    glCallList(m_display_list);
+
+    // the list binds its own textures and ends with white
+    gl_state.Texture_Changed();
+    gl_state.Color_Changed(white);
+
     Render_Basic_Clear();
 }
 
@@ -650,6 +950,13 @@ void cSurface_Request::Draw(void)
 cRenderQueue::cRenderQueue(unsigned int reserve_items)
 {
     m_render_data.reserve(reserve_items);
+
+    m_camera_x = 0.0f;
+    m_camera_y = 0.0f;
+    m_camera_set = 0;
+
+    m_gl_calls_issued = 0;
+    m_gl_calls_skipped = 0;
 }
 
 cRenderQueue::~cRenderQueue(void)
@@ -681,8 +988,15 @@ void cRenderQueue::Render(bool clear /* = 1 */)
 {
     // z position sort
     std::sort(m_render_data.begin(), m_render_data.end(), zpos_sort());
-    // reset last texture
-    last_bind_texture = 0;
+    // other code changes the state between the frames
+    gl_state.Invalidate();
+
+    if (!m_camera_set) {
+        Set_Camera(pActive_Camera->m_x, pActive_Camera->m_y);
+    }
+
+    render_camera_x = m_camera_x;
+    render_camera_y = m_camera_y;
 
     for (RenderList::iterator itr = m_render_data.begin(); itr != m_render_data.end(); ++itr) {
         cRender_Request* obj = (*itr);
@@ -691,9 +1005,17 @@ void cRenderQueue::Render(bool clear /* = 1 */)
         obj->m_render_count--;
     }
 
+    // leave the default state for the gui
+    gl_state.Set_Defaults();
+
+    m_gl_calls_issued = gl_state.m_calls_issued;
+    m_gl_calls_skipped = gl_state.m_calls_skipped;
+
     if (clear) {
         Clear(0);
     }
+
+    m_camera_set = 0;
 }
 
 void cRenderQueue::Fake_Render(unsigned int amount /* = 1 */, bool clear /* = 1 */)
@@ -708,6 +1030,13 @@ void cRenderQueue::Fake_Render(unsigned int amount /* = 1 */, bool clear /* = 1
     }
 }
 
+void cRenderQueue::Set_Camera(float x, float y)
+{
+    m_camera_x = x;
+    m_camera_y = y;
+    m_camera_set = 1;
+}
+
 void cRenderQueue::Clear(bool force /* = 1 */)
 {
     for (RenderList::iterator itr = m_render_data.begin(); itr != m_render_data.end();) {
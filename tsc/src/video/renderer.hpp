@@ -33,7 +33,80 @@ namespace TSC {
         REND_SURFACE = 4,
         REND_TEXT = 5,
         REND_LINE = 6,
-        REND_CIRCLE = 7
+        REND_CIRCLE = 7,
+        REND_DISPLAY_LIST = 8,
+        REND_REPEAT_SURFACE = 9
+    };
+
+    /* *** *** *** *** *** *** cGL_State *** *** *** *** *** *** *** *** *** *** *** */
+
+    /* Caches the OpenGL state set by the render requests
+     * Calls that would not change the state are skipped.
+     * Other code may change the state between the frames so it is
+     * invalidated when a render queue starts and set back to the
+     * defaults when it finishes.
+    */
+    class cGL_State {
+    public:
+        cGL_State(void);
+
+        // forget the cached state and reset the counters
+        void Invalidate(void);
+        // set the default state used outside of the render queue
+        void Set_Defaults(void);
+
+        // enable or disable 2D texturing
+        void Set_Texture_2D(bool enable);
+        // bind the given texture
+        void Bind_Texture(GLuint texture_id);
+        // the bound texture was changed directly
+        void Texture_Changed(void);
+        // set the blend function
+        void Set_Blend_Func(GLenum sfactor, GLenum dfactor);
+        // set the current color
+        void Set_Color(const Color& color);
+        // the current color was changed directly
+        void Color_Changed(const Color& color);
+        /* set the texture color combine mode
+         * combine_type : 0 for the default modulation
+         * combine_color : the constant rgb color
+        */
+        void Set_Combine(GLint combine_type, const float* combine_color);
+        // set the line width
+        void Set_Line_Width(float width);
+        // set the line stipple pattern, 0 disables it
+        void Set_Line_Stipple(GLushort pattern);
+        // draw with the sprite shader program or the fixed-function pipeline
+        void Set_Sprite_Shader(bool enable);
+        // Returns true if the sprite shader program is used
+        inline bool Is_Sprite_Shader(void) const
+        {
+            return m_sprite_shader_valid && m_sprite_shader;
+        };
+
+        // OpenGL calls issued since the last invalidation
+        unsigned int m_calls_issued;
+        // OpenGL calls skipped since the last invalidation
+        unsigned int m_calls_skipped;
+    private:
+        bool m_texture_2d_valid;
+        bool m_texture_2d;
+        bool m_bound_texture_valid;
+        GLuint m_bound_texture;
+        bool m_blend_valid;
+        GLenum m_blend_sfactor;
+        GLenum m_blend_dfactor;
+        bool m_color_valid;
+        Color m_color;
+        bool m_combine_valid;
+        GLint m_combine_type;
+        float m_combine_color[3];
+        bool m_line_width_valid;
+        float m_line_width;
+        bool m_line_stipple_valid;
+        GLushort m_line_stipple;
+        bool m_sprite_shader_valid;
+        bool m_sprite_shader;
     };
 
     /* *** *** *** *** *** *** cRender_Request *** *** *** *** *** *** *** *** *** *** *** */
@@ -81,8 +154,9 @@ namespace TSC {
 
         // render advanced state
         void Render_Advanced(void);
-        // clear advanced render state
-        void Render_Advanced_Clear(void) const;
+
+        // Returns true if this request can be drawn with the sprite shader program
+        bool Can_Use_Sprite_Shader(void) const;
 
         // global scale
         bool m_global_scale;
@@ -212,6 +286,9 @@ namespace TSC {
         // size
         float m_w;
         float m_h;
+        // part of the size covered by the texture
+        float m_tex_part_w;
+        float m_tex_part_h;
 
         // color
         Color m_color;
@@ -220,6 +297,55 @@ namespace TSC {
         bool m_delete_texture;
     };
 
+    /* *** *** *** *** *** *** cRepeat_Surface_Request *** *** *** *** *** *** *** *** *** *** *** */
+
+    /* Draws a texture repeated over a rectangle
+     * the texture must have power of two dimensions
+    */
+    class cRepeat_Surface_Request : public cRender_Request_Advanced {
+    public:
+        cRepeat_Surface_Request(void);
+        virtual ~cRepeat_Surface_Request(void);
+
+        // Draw
+        virtual void Draw(void);
+
+        // texture id
+        GLuint m_texture_id;
+        /* if set the texture is switched to the repeat wrap mode
+         * it keeps it afterwards, see cGL_Surface::m_repeat_texture
+        */
+        bool m_set_repeat;
+        // drawing rect
+        GL_rect m_rect;
+        // texture coordinate of the top left corner
+        float m_tex_x;
+        float m_tex_y;
+        // texture repetitions over the rect
+        float m_tex_w;
+        float m_tex_h;
+
+        // color
+        Color m_color;
+    };
+
+    /* *** *** *** *** *** *** cDisplay_List_Request *** *** *** *** *** *** *** *** *** *** *** */
+
+    /* Calls a compiled OpenGL display list
+     * the list sets its own textures, colors and z positions
+    */
+    class cDisplay_List_Request : public cRender_Request_Advanced {
+    public:
+        cDisplay_List_Request(void);
+        virtual ~cDisplay_List_Request(void);
+
+        // Draw
+        virtual void Draw(void);
+
+        // display list id
+        GLuint m_display_list;
+    };
+
     /* *** *** *** *** *** *** cRenderQueue *** *** *** *** *** *** *** *** *** *** *** */
 
     class cRenderQueue {
@@ -247,6 +373,20 @@ namespace TSC {
         */
         void Clear(bool force = 1);
 
+        /* Set the camera position to render this data with
+         * If not set the position of pActive_Camera when rendering is used.
+        */
+        void Set_Camera(float x, float y);
+
+        // camera position
+        float m_camera_x;
+        float m_camera_y;
+        // if set the camera position was given for the current data
+        bool m_camera_set;
+        // OpenGL state calls issued and skipped by the last Render()
+        unsigned int m_gl_calls_issued;
+        unsigned int m_gl_calls_skipped;
+
         // render data array
         RenderList m_render_data;
 
@@ -0,0 +1,325 @@
+/***************************************************************************
+ * screenshot.cpp - screen capturing without stalling the game
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../video/screenshot.hpp"
+#include "../video/video.hpp"
+#include "../user/preferences.hpp"
+#include "../core/filesystem/filesystem.hpp"
+#include "../core/filesystem/resource_manager.hpp"
+#include "../core/property_helper.hpp"
+#include "../core/global_basic.hpp"
+
+using namespace std;
+
+namespace fs = boost::filesystem;
+
+namespace TSC {
+
+// buffer object functions are not exported by every OpenGL library
+static PFNGLGENBUFFERSPROC gl_gen_buffers = NULL;
+static PFNGLDELETEBUFFERSPROC gl_delete_buffers = NULL;
+static PFNGLBINDBUFFERPROC gl_bind_buffer = NULL;
+static PFNGLBUFFERDATAPROC gl_buffer_data = NULL;
+static PFNGLMAPBUFFERPROC gl_map_buffer = NULL;
+static PFNGLUNMAPBUFFERPROC gl_unmap_buffer = NULL;
+
+template<class T> static T Get_GL_Function(const char* name)
+{
+#if defined(_WIN32)
+    return reinterpret_cast<T>(wglGetProcAddress(name));
+#elif defined(__unix__)
+    return reinterpret_cast<T>(glXGetProcAddressARB(reinterpret_cast<const GLubyte*>(name)));
+#else
+    return NULL;
+#endif
+}
+
+/* *** *** *** *** *** *** *** cScreenshot_Capture *** *** *** *** *** *** *** *** *** *** */
+
+const unsigned int cScreenshot_Capture::m_max_pending = 8;
+
+cScreenshot_Capture::cScreenshot_Capture(void)
+{
+    m_async_read = 0;
+
+    for (unsigned int i = 0; i < m_buffer_count; i++) {
+        m_buffers[i].m_buffer = 0;
+        m_buffers[i].m_size = 0;
+        m_buffers[i].m_width = 0;
+        m_buffers[i].m_height = 0;
+        m_buffers[i].m_frame = 0;
+    }
+
+    m_frame = 0;
+    m_continuous_interval = 0;
+    m_continuous_number = 1;
+    m_exit = 0;
+
+    m_thread = boost::thread(boost::bind(&cScreenshot_Capture::Thread_Function, this));
+}
+
+cScreenshot_Capture::~cScreenshot_Capture(void)
+{
+    for (unsigned int i = 0; i < m_buffer_count; i++) {
+        if (!m_buffers[i].m_filename.empty()) {
+            Finish_Buffer(m_buffers[i]);
+        }
+
+        if (m_buffers[i].m_buffer) {
+            gl_delete_buffers(1, &m_buffers[i].m_buffer);
+        }
+    }
+
+    // write everything left
+    {
+        boost::lock_guard<boost::mutex> lock(m_mutex);
+        m_exit = 1;
+    }
+
+    m_condition.notify_all();
+    m_thread.join();
+}
+
+void cScreenshot_Capture::Init(void)
+{
+    // pixel buffer objects are core since OpenGL 2.1
+    if (pVideo->m_opengl_version < 2.1f) {
+        return;
+    }
+
+    gl_gen_buffers = Get_GL_Function<PFNGLGENBUFFERSPROC>("glGenBuffers");
+    gl_delete_buffers = Get_GL_Function<PFNGLDELETEBUFFERSPROC>("glDeleteBuffers");
+    gl_bind_buffer = Get_GL_Function<PFNGLBINDBUFFERPROC>("glBindBuffer");
+    gl_buffer_data = Get_GL_Function<PFNGLBUFFERDATAPROC>("glBufferData");
+    gl_map_buffer = Get_GL_Function<PFNGLMAPBUFFERPROC>("glMapBuffer");
+    gl_unmap_buffer = Get_GL_Function<PFNGLUNMAPBUFFERPROC>("glUnmapBuffer");
+
+    m_async_read = gl_gen_buffers && gl_delete_buffers && gl_bind_buffer && gl_buffer_data && gl_map_buffer && gl_unmap_buffer;
+
+    if (!m_async_read) {
+        cout << "Info : Pixel buffer objects are not available, screenshots are read directly" << endl;
+    }
+}
+
+void cScreenshot_Capture::Request(const fs::path& filename)
+{
+    m_requested.push_back(filename);
+}
+
+void cScreenshot_Capture::Set_Continuous(unsigned int interval)
+{
+    m_continuous_interval = interval;
+
+    if (m_continuous_interval && !Dir_Exists(Get_Capture_Directory())) {
+        fs::create_directories(Get_Capture_Directory());
+    }
+}
+
+void cScreenshot_Capture::Frame_Finished(void)
+{
+    m_frame++;
+
+    // the copies of the last frames are finished by now
+    for (unsigned int i = 0; i < m_buffer_count; i++) {
+        if (!m_buffers[i].m_filename.empty() && m_buffers[i].m_frame != m_frame) {
+            Finish_Buffer(m_buffers[i]);
+        }
+    }
+
+    for (std::vector<fs::path>::const_iterator itr = m_requested.begin(); itr != m_requested.end(); ++itr) {
+        Read_Screen(*itr);
+    }
+
+    m_requested.clear();
+
+    if (m_continuous_interval && m_frame % m_continuous_interval == 0) {
+        char filename[32];
+        snprintf(filename, sizeof(filename), "%06u.png", m_continuous_number);
+        m_continuous_number++;
+
+        Read_Screen(Get_Capture_Directory() / utf8_to_path(filename));
+    }
+}
+
+bool cScreenshot_Capture::Is_Pending(const fs::path& filename)
+{
+    if (std::find(m_requested.begin(), m_requested.end(), filename) != m_requested.end()) {
+        return 1;
+    }
+
+    for (unsigned int i = 0; i < m_buffer_count; i++) {
+        if (m_buffers[i].m_filename == filename) {
+            return 1;
+        }
+    }
+
+    boost::lock_guard<boost::mutex> lock(m_mutex);
+
+    if (m_writing == filename) {
+        return 1;
+    }
+
+    for (std::deque<Capture_Job*>::const_iterator itr = m_jobs.begin(); itr != m_jobs.end(); ++itr) {
+        if ((*itr)->m_filename == filename) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+fs::path cScreenshot_Capture::Get_Capture_Directory(void) const
+{
+    return pResource_Manager->Get_User_Screenshot_Directory() / utf8_to_path("capture");
+}
+
+void cScreenshot_Capture::Read_Screen(const fs::path& filename)
+{
+    const unsigned int width = pPreferences->m_video_screen_w;
+    const unsigned int height = pPreferences->m_video_screen_h;
+    const unsigned int size = width * height * 3;
+
+    // rows are not padded
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+
+    if (!m_async_read) {
+        Capture_Job* job = new Capture_Job();
+        job->m_filename = filename;
+        job->m_pixels.resize(size);
+        job->m_width = width;
+        job->m_height = height;
+
+        glReadPixels(0, 0, width, height, GL_RGB, GL_UNSIGNED_BYTE, static_cast<GLvoid*>(&job->m_pixels[0]));
+        glPixelStorei(GL_PACK_ALIGNMENT, 4);
+
+        Queue_Job(job);
+        return;
+    }
+
+    Capture_Buffer* buffer = NULL;
+
+    for (unsigned int i = 0; i < m_buffer_count; i++) {
+        // free
+        if (m_buffers[i].m_filename.empty()) {
+            buffer = &m_buffers[i];
+            break;
+        }
+        // oldest
+        if (!buffer || m_buffers[i].m_frame < buffer->m_frame) {
+            buffer = &m_buffers[i];
+        }
+    }
+
+    // all in use, wait for the oldest
+    if (!buffer->m_filename.empty()) {
+        Finish_Buffer(*buffer);
+    }
+
+    if (!buffer->m_buffer) {
+        gl_gen_buffers(1, &buffer->m_buffer);
+    }
+
+    gl_bind_buffer(GL_PIXEL_PACK_BUFFER, buffer->m_buffer);
+
+    if (buffer->m_size != size) {
+        gl_buffer_data(GL_PIXEL_PACK_BUFFER, size, NULL, GL_STREAM_READ);
+        buffer->m_size = size;
+    }
+
+    // returns at once and copies into the buffer object
+    glReadPixels(0, 0, width, height, GL_RGB, GL_UNSIGNED_BYTE, NULL);
+
+    gl_bind_buffer(GL_PIXEL_PACK_BUFFER, 0);
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+
+    buffer->m_filename = filename;
+    buffer->m_width = width;
+    buffer->m_height = height;
+    buffer->m_frame = m_frame;
+}
+
+void cScreenshot_Capture::Finish_Buffer(Capture_Buffer& buffer)
+{
+    gl_bind_buffer(GL_PIXEL_PACK_BUFFER, buffer.m_buffer);
+
+    const unsigned char* pixels = static_cast<const unsigned char*>(gl_map_buffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY));
+
+    if (pixels) {
+        Capture_Job* job = new Capture_Job();
+        job->m_filename = buffer.m_filename;
+        job->m_pixels.assign(pixels, pixels + buffer.m_width * buffer.m_height * 3);
+        job->m_width = buffer.m_width;
+        job->m_height = buffer.m_height;
+
+        gl_unmap_buffer(GL_PIXEL_PACK_BUFFER);
+
+        Queue_Job(job);
+    }
+    else {
+        cerr << "Warning : Could not map the screenshot buffer for " << path_to_utf8(buffer.m_filename) << endl;
+    }
+
+    gl_bind_buffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    buffer.m_filename.clear();
+}
+
+void cScreenshot_Capture::Queue_Job(Capture_Job* job)
+{
+    boost::unique_lock<boost::mutex> lock(m_mutex);
+
+    // limit the memory if the writer can not keep up
+    while (m_jobs.size() >= m_max_pending) {
+        m_condition.wait(lock);
+    }
+
+    m_jobs.push_back(job);
+    m_condition.notify_all();
+}
+
+void cScreenshot_Capture::Thread_Function(void)
+{
+    boost::unique_lock<boost::mutex> lock(m_mutex);
+
+    while (1) {
+        while (m_jobs.empty() && !m_exit) {
+            m_condition.wait(lock);
+        }
+
+        // finished and nothing left
+        if (m_jobs.empty()) {
+            break;
+        }
+
+        Capture_Job* job = m_jobs.front();
+        m_jobs.pop_front();
+        m_writing = job->m_filename;
+        m_condition.notify_all();
+
+        lock.unlock();
+
+        // glReadPixels starts with the bottom row
+        pVideo->Save_Surface(job->m_filename, &job->m_pixels[0], job->m_width, job->m_height, 3, 1);
+        delete job;
+
+        lock.lock();
+
+        m_writing.clear();
+    }
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
@@ -0,0 +1,129 @@
+/***************************************************************************
+ * screenshot.hpp - screen capturing without stalling the game
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_SCREENSHOT_HPP
+#define TSC_SCREENSHOT_HPP
+
+#include "../core/global_basic.hpp"
+#include <deque>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+namespace TSC {
+
+    /* *** *** *** *** *** *** *** cScreenshot_Capture *** *** *** *** *** *** *** *** *** *** */
+
+    /* Captures finished frames and saves them as png files
+     *
+     * The screen is read into a pixel buffer object, which lets the
+     * driver copy it while the game continues. It is mapped one frame
+     * later when the copy is finished. Without pixel buffer object
+     * support the screen is read directly. The png encoding is always
+     * done on a writer thread.
+     *
+     * For automated comparisons every n-th frame can also be saved to
+     * numbered files in the capture directory.
+    */
+    class cScreenshot_Capture {
+    public:
+        cScreenshot_Capture(void);
+        // Saves the pending captures, needs the OpenGL context
+        ~cScreenshot_Capture(void);
+
+        // Check for pixel buffer object support, needs the OpenGL context
+        void Init(void);
+
+        /* Save the next finished frame to the given file
+         * all files requested before it are saved from the same frame
+        */
+        void Request(const boost::filesystem::path& filename);
+        /* Save every interval-th frame to numbered files
+         * in the capture directory, 0 disables it
+        */
+        void Set_Continuous(unsigned int interval);
+
+        /* Called with the finished frame in the back buffer before it is displayed
+         * Starts the requested captures and finishes the ones of the last frames.
+        */
+        void Frame_Finished(void);
+
+        // Returns true if the given file is requested or not written yet
+        bool Is_Pending(const boost::filesystem::path& filename);
+
+        // directory of the continuous captures
+        boost::filesystem::path Get_Capture_Directory(void) const;
+
+        // number of frames read into pixel buffer objects at once
+        static const unsigned int m_buffer_count = 3;
+        // captures waiting for the writer thread before capturing waits for it
+        static const unsigned int m_max_pending;
+    private:
+        // a frame read into a pixel buffer object
+        struct Capture_Buffer {
+            GLuint m_buffer;
+            // allocated buffer size
+            unsigned int m_size;
+            // target file or empty if unused
+            boost::filesystem::path m_filename;
+            unsigned int m_width;
+            unsigned int m_height;
+            // frame it was read in
+            unsigned int m_frame;
+        };
+
+        // a frame waiting to be written
+        struct Capture_Job {
+            boost::filesystem::path m_filename;
+            std::vector<unsigned char> m_pixels;
+            unsigned int m_width;
+            unsigned int m_height;
+        };
+
+        // Read the back buffer for the given file
+        void Read_Screen(const boost::filesystem::path& filename);
+        // Map the given buffer and queue its pixels for writing
+        void Finish_Buffer(Capture_Buffer& buffer);
+        // Hand the job to the writer thread
+        void Queue_Job(Capture_Job* job);
+        void Thread_Function(void);
+
+        // if pixel buffer objects are used
+        bool m_async_read;
+        Capture_Buffer m_buffers[m_buffer_count];
+        // files requested for the next frame
+        std::vector<boost::filesystem::path> m_requested;
+
+        // frames finished
+        unsigned int m_frame;
+        // continuous capture frame interval or 0
+        unsigned int m_continuous_interval;
+        // number of the next continuous capture file
+        unsigned int m_continuous_number;
+
+        // jobs for the writer thread
+        std::deque<Capture_Job*> m_jobs;
+        // file the writer thread is writing
+        boost::filesystem::path m_writing;
+        boost::thread m_thread;
+        boost::mutex m_mutex;
+        boost::condition_variable m_condition;
+        bool m_exit;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
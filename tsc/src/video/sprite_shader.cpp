@@ -0,0 +1,143 @@
+/***************************************************************************
+ * sprite_shader.cpp - GLSL program for drawing sprites
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../video/sprite_shader.hpp"
+#include "../core/global_basic.hpp"
+
+using namespace std;
+
+namespace TSC {
+
+// GLSL 1.10 for OpenGL 2.0
+static const char* sprite_vertex_source =
+    "varying vec4 combine;\n"
+    "\n"
+    "void main()\n"
+    "{\n"
+    "    gl_Position = gl_ModelViewProjectionMatrix * gl_Vertex;\n"
+    "    gl_TexCoord[0] = vec4(gl_MultiTexCoord0.xy, 0.0, 1.0);\n"
+    "    gl_FrontColor = gl_Color;\n"
+    "    combine = vec4(gl_Normal, gl_MultiTexCoord0.z);\n"
+    "}\n";
+
+/* the same as GL_COMBINE with GL_CONSTANT as first and GL_TEXTURE as
+ * second source, the alpha is always modulated
+*/
+static const char* sprite_fragment_source =
+    "uniform sampler2D sprite_texture;\n"
+    "varying vec4 combine;\n"
+    "\n"
+    "void main()\n"
+    "{\n"
+    "    vec4 tex = texture2D(sprite_texture, gl_TexCoord[0].xy);\n"
+    "    vec3 rgb;\n"
+    "\n"
+    "    if (combine.a < 0.5) {\n"
+    "        rgb = tex.rgb * gl_Color.rgb;\n"
+    "    }\n"
+    "    else if (combine.a < 1.5) {\n"
+    "        rgb = combine.rgb;\n"
+    "    }\n"
+    "    else if (combine.a < 2.5) {\n"
+    "        rgb = combine.rgb * tex.rgb;\n"
+    "    }\n"
+    "    else if (combine.a < 3.5) {\n"
+    "        rgb = combine.rgb + tex.rgb;\n"
+    "    }\n"
+    "    else if (combine.a < 4.5) {\n"
+    "        rgb = combine.rgb + tex.rgb - 0.5;\n"
+    "    }\n"
+    "    else {\n"
+    "        rgb = combine.rgb - tex.rgb;\n"
+    "    }\n"
+    "\n"
+    "    gl_FragColor = vec4(clamp(rgb, 0.0, 1.0), tex.a * gl_Color.a);\n"
+    "}\n";
+
+/* *** *** *** *** *** *** *** cSprite_Shader *** *** *** *** *** *** *** *** *** *** */
+
+cSprite_Shader::cSprite_Shader(void)
+{
+    //
+}
+
+cSprite_Shader::~cSprite_Shader(void)
+{
+    //
+}
+
+bool cSprite_Shader::Load(void)
+{
+    if (!sf::Shader::isAvailable()) {
+        return 0;
+    }
+
+    if (!m_shader.loadFromMemory(sprite_vertex_source, sprite_fragment_source)) {
+        cerr << "Warning : Sprite shader compiling failed" << endl;
+        return 0;
+    }
+
+    return 1;
+}
+
+void cSprite_Shader::Bind(void)
+{
+    sf::Shader::bind(&m_shader);
+}
+
+void cSprite_Shader::Unbind(void)
+{
+    sf::Shader::bind(NULL);
+}
+
+bool cSprite_Shader::Supports_Combine(GLint combine_type)
+{
+    return combine_type == 0 || combine_type == GL_REPLACE || combine_type == GL_MODULATE || combine_type == GL_ADD || combine_type == GL_ADD_SIGNED || combine_type == GL_SUBTRACT;
+}
+
+float cSprite_Shader::Get_Combine_Mode(GLint combine_type)
+{
+    switch (combine_type) {
+    case GL_REPLACE:
+        return 1.0f;
+    case GL_MODULATE:
+        return 2.0f;
+    case GL_ADD:
+        return 3.0f;
+    case GL_ADD_SIGNED:
+        return 4.0f;
+    case GL_SUBTRACT:
+        return 5.0f;
+    default:
+        return 0.0f;
+    }
+}
+
+void cSprite_Shader::Add_Quad(float left, float top, float right, float bottom, float z, float tex_left, float tex_top, float tex_right, float tex_bottom, float combine_mode)
+{
+    // q stays 1 for the fixed-function pipeline
+    glTexCoord4f(tex_left, tex_top, combine_mode, 1.0f);
+    glVertex3f(left, top, z);
+    glTexCoord4f(tex_right, tex_top, combine_mode, 1.0f);
+    glVertex3f(right, top, z);
+    glTexCoord4f(tex_right, tex_bottom, combine_mode, 1.0f);
+    glVertex3f(right, bottom, z);
+    glTexCoord4f(tex_left, tex_bottom, combine_mode, 1.0f);
+    glVertex3f(left, bottom, z);
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
@@ -0,0 +1,70 @@
+/***************************************************************************
+ * sprite_shader.hpp - GLSL program for drawing sprites
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_SPRITE_SHADER_HPP
+#define TSC_SPRITE_SHADER_HPP
+
+#include "../core/global_basic.hpp"
+
+namespace TSC {
+
+    /* *** *** *** *** *** *** *** cSprite_Shader *** *** *** *** *** *** *** *** *** *** */
+
+    /* Draws textured quads with the color combine modes of the
+     * fixed-function texture environment, but with the combine
+     * settings given per vertex instead of as OpenGL state.
+     * Sprites with different colors, combine modes and shadows can
+     * so be drawn between the same glBegin() and glEnd() or compiled
+     * into the same display list.
+     *
+     * The per vertex attributes use the old immediate mode calls:
+     * glColor : color, as in the fixed-function pipeline
+     * glTexCoord4f : texture coordinates, r is the combine mode
+     * glNormal3f : combine color
+    */
+    class cSprite_Shader {
+    public:
+        cSprite_Shader(void);
+        ~cSprite_Shader(void);
+
+        /* Compile the program
+         * Returns false if shaders are not supported or compiling failed
+        */
+        bool Load(void);
+
+        // Draw with the program
+        void Bind(void);
+        // Draw with the fixed-function pipeline
+        static void Unbind(void);
+
+        // Returns true if the program can draw the given texture combine type
+        static bool Supports_Combine(GLint combine_type);
+        // Returns the combine mode vertex attribute of the given texture combine type
+        static float Get_Combine_Mode(GLint combine_type);
+
+        /* Add the vertices of a quad, must be called between glBegin(GL_QUADS) and glEnd()
+         * The combine color must be set before with glNormal3f.
+         * combine_mode : from Get_Combine_Mode()
+        */
+        static void Add_Quad(float left, float top, float right, float bottom, float z, float tex_left, float tex_top, float tex_right, float tex_bottom, float combine_mode);
+    private:
+        sf::Shader m_shader;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
@@ -0,0 +1,496 @@
+/***************************************************************************
+ * static_render_cache.cpp - prebuilt geometry for static level sprites
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../video/static_render_cache.hpp"
+#include "../video/renderer.hpp"
+#include "../video/gl_surface.hpp"
+#include "../video/img_manager.hpp"
+#include "../video/sprite_shader.hpp"
+#include "../video/animation.hpp"
+#include "../core/game_core.hpp"
+#include "../core/camera.hpp"
+#include "../core/static_collision.hpp"
+#include "../core/global_basic.hpp"
+
+using namespace std;
+
+namespace TSC {
+
+// a sprite waiting to be put into a chunk
+struct static_render_entry {
+    cSprite* m_sprite;
+    unsigned int m_band;
+    int m_chunk_x;
+    int m_chunk_y;
+};
+
+/* Get the z range the given sprite draws over
+ * returns false if it is only drawn at its z position
+*/
+static bool Get_Animated_Z_Range(const cSprite* sprite, float& z_min, float& z_max)
+{
+    z_min = sprite->m_pos_z;
+    z_max = sprite->m_pos_z;
+
+    // particles get a random z offset
+    if (sprite->m_type == TYPE_PARTICLE_EMITTER) {
+        z_max += static_cast<const cParticle_Emitter*>(sprite)->m_pos_z_rand;
+    }
+    // ghost shadows are drawn below
+    else if (sprite == pActive_Player) {
+        z_min -= 5 * cSprite::m_pos_z_delta;
+    }
+
+    return z_min < z_max;
+}
+
+// sort by band and chunk, then by z position
+struct static_render_entry_sort {
+    bool operator()(const static_render_entry& a, const static_render_entry& b) const
+    {
+        if (a.m_band != b.m_band) {
+            return a.m_band < b.m_band;
+        }
+        if (a.m_chunk_y != b.m_chunk_y) {
+            return a.m_chunk_y < b.m_chunk_y;
+        }
+        if (a.m_chunk_x != b.m_chunk_x) {
+            return a.m_chunk_x < b.m_chunk_x;
+        }
+
+        return a.m_sprite->m_pos_z < b.m_sprite->m_pos_z;
+    }
+};
+
+// sort by z position
+struct static_render_zpos_sort {
+    bool operator()(const cSprite* a, const cSprite* b) const
+    {
+        return a->m_pos_z < b->m_pos_z;
+    }
+};
+
+/* *** *** *** *** *** *** *** cStatic_Render_Chunk *** *** *** *** *** *** *** *** *** *** */
+
+cStatic_Render_Chunk::cStatic_Render_Chunk(void)
+{
+    m_pos_z = 0.0f;
+    m_band_z_min = 0.0f;
+    m_band_z_max = 0.0f;
+    m_display_list = 0;
+    m_dirty = 1;
+}
+
+cStatic_Render_Chunk::~cStatic_Render_Chunk(void)
+{
+    Delete_Display_List();
+}
+
+void cStatic_Render_Chunk::Delete_Display_List(void)
+{
+    if (m_display_list) {
+        // the render thread may still call it
+        pVideo->Render_Finish();
+        assert(!pVideo->Is_Render_Context_Lent());
+
+        glDeleteLists(m_display_list, 1);
+        m_display_list = 0;
+    }
+
+    if (pImage_Manager) {
+        for (vector<cGL_Surface*>::iterator itr = m_textures.begin(); itr != m_textures.end(); ++itr) {
+            pImage_Manager->Unpin(*itr);
+        }
+    }
+
+    m_textures.clear();
+}
+
+/* *** *** *** *** *** *** *** cStatic_Render_Cache *** *** *** *** *** *** *** *** *** *** */
+
+cStatic_Render_Cache::cStatic_Render_Cache(void)
+{
+    m_video_init_count = 0;
+}
+
+cStatic_Render_Cache::~cStatic_Render_Cache(void)
+{
+    Clear();
+}
+
+bool cStatic_Render_Cache::Is_Cacheable(const cSprite* sprite)
+{
+    // only basic sprites never change by themselves
+    if (sprite->m_type != TYPE_UNDEFINED) {
+        return 0;
+    }
+
+    if (!sprite->m_active || sprite->m_auto_destroy || sprite->m_spawned || !sprite->m_image || (!sprite->m_image->m_image && !sprite->m_image->m_evicted)) {
+        return 0;
+    }
+
+    // drawn relative to the screen
+    if (sprite->m_no_camera) {
+        return 0;
+    }
+
+    // only plain quads are compiled
+    if (sprite->m_rot_x || sprite->m_rot_y || sprite->m_rot_z ||
+            sprite->m_image->m_base_rot_x || sprite->m_image->m_base_rot_y || sprite->m_image->m_base_rot_z) {
+        return 0;
+    }
+
+    // color combining is only possible per vertex with the sprite shader
+    if (sprite->m_combine_type && !(pVideo->mp_sprite_shader && cSprite_Shader::Supports_Combine(sprite->m_combine_type))) {
+        return 0;
+    }
+
+    if (sprite->m_shadow_pos) {
+        return 0;
+    }
+
+    // scripted
+    if (sprite->has_event_handlers()) {
+        return 0;
+    }
+
+    return 1;
+}
+
+void cStatic_Render_Cache::Build(const cSprite_List& objects, const std::string& script_code /* = "" */)
+{
+    Clear();
+
+    std::set<int> script_uids;
+    Get_Script_UIDs(script_code, script_uids);
+
+    vector<static_render_entry> entries;
+    // z positions of everything drawn in between
+    vector<float> band_limits;
+    // z ranges drawn over by animated z positions
+    vector<pair<float, float> > animated_z;
+    cSprite_List candidates;
+    float z_min, z_max;
+
+    if (pActive_Player) {
+        band_limits.push_back(pActive_Player->m_pos_z);
+
+        if (Get_Animated_Z_Range(pActive_Player, z_min, z_max)) {
+            band_limits.push_back(z_min);
+            animated_z.push_back(pair<float, float>(z_min, z_max));
+        }
+    }
+
+    for (cSprite_List::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+        cSprite* obj = (*itr);
+
+        if (Is_Cacheable(obj) && !script_uids.count(obj->m_uid)) {
+            candidates.push_back(obj);
+            continue;
+        }
+
+        if (obj->m_auto_destroy) {
+            continue;
+        }
+
+        band_limits.push_back(obj->m_pos_z);
+
+        if (Get_Animated_Z_Range(obj, z_min, z_max)) {
+            band_limits.push_back(z_max);
+            animated_z.push_back(pair<float, float>(z_min, z_max));
+        }
+    }
+
+    for (cSprite_List::iterator itr = candidates.begin(); itr != candidates.end(); ++itr) {
+        cSprite* obj = (*itr);
+
+        // would be drawn in between an animated z range
+        bool animated = 0;
+
+        for (vector<pair<float, float> >::iterator z_itr = animated_z.begin(); z_itr != animated_z.end(); ++z_itr) {
+            if (obj->m_pos_z > z_itr->first && obj->m_pos_z < z_itr->second) {
+                animated = 1;
+                break;
+            }
+        }
+
+        if (animated) {
+            band_limits.push_back(obj->m_pos_z);
+            continue;
+        }
+
+        static_render_entry entry;
+        entry.m_sprite = obj;
+        entry.m_band = 0;
+        entry.m_chunk_x = static_cast<int>(floor(obj->m_pos_x / game_res_w));
+        entry.m_chunk_y = static_cast<int>(floor(obj->m_pos_y / game_res_h));
+        entries.push_back(entry);
+    }
+
+    if (entries.empty()) {
+        return;
+    }
+
+    std::sort(band_limits.begin(), band_limits.end());
+
+    for (vector<static_render_entry>::iterator itr = entries.begin(); itr != entries.end(); ++itr) {
+        itr->m_band = std::upper_bound(band_limits.begin(), band_limits.end(), itr->m_sprite->m_pos_z) - band_limits.begin();
+    }
+
+    std::sort(entries.begin(), entries.end(), static_render_entry_sort());
+
+    cStatic_Render_Chunk* chunk = NULL;
+
+    for (vector<static_render_entry>::iterator itr = entries.begin(); itr != entries.end(); ++itr) {
+        // next chunk
+        if (!chunk || itr->m_band != (itr - 1)->m_band ||
+                itr->m_chunk_x != (itr - 1)->m_chunk_x || itr->m_chunk_y != (itr - 1)->m_chunk_y) {
+            chunk = new cStatic_Render_Chunk();
+
+            // the band is limited by the surrounding dynamic z positions
+            chunk->m_band_z_min = itr->m_band > 0 ? band_limits[itr->m_band - 1] : -1.0f;
+            chunk->m_band_z_max = itr->m_band < band_limits.size() ? band_limits[itr->m_band] : 1.0f;
+
+            m_chunks.push_back(chunk);
+        }
+
+        chunk->m_members.push_back(itr->m_sprite);
+        m_member_chunk[itr->m_sprite] = m_chunks.size() - 1;
+        itr->m_sprite->m_render_cached = 1;
+    }
+
+    debug_print("Cached %u static sprites in %u render chunks\n", static_cast<unsigned int>(m_member_chunk.size()), static_cast<unsigned int>(m_chunks.size()));
+}
+
+void cStatic_Render_Cache::Clear(void)
+{
+    for (cStatic_Render_Chunk_List::iterator itr = m_chunks.begin(); itr != m_chunks.end(); ++itr) {
+        cStatic_Render_Chunk* chunk = (*itr);
+
+        for (cSprite_List::iterator member_itr = chunk->m_members.begin(); member_itr != chunk->m_members.end(); ++member_itr) {
+            (*member_itr)->m_render_cached = 0;
+        }
+
+        // no context left at exit
+        if (!pVideo) {
+            chunk->m_display_list = 0;
+        }
+
+        delete chunk;
+    }
+
+    m_chunks.clear();
+    m_member_chunk.clear();
+}
+
+void cStatic_Render_Cache::Remove(cSprite* sprite)
+{
+    if (!sprite->m_render_cached) {
+        return;
+    }
+
+    std::unordered_map<cSprite*, unsigned int>::iterator chunk_itr = m_member_chunk.find(sprite);
+
+    if (chunk_itr != m_member_chunk.end()) {
+        cStatic_Render_Chunk* chunk = m_chunks[chunk_itr->second];
+        cSprite_List::iterator member_itr = std::find(chunk->m_members.begin(), chunk->m_members.end(), sprite);
+
+        if (member_itr != chunk->m_members.end()) {
+            chunk->m_members.erase(member_itr);
+        }
+
+        chunk->m_dirty = 1;
+        m_member_chunk.erase(chunk_itr);
+    }
+
+    sprite->m_render_cached = 0;
+}
+
+void cStatic_Render_Cache::Invalidate(cSprite* sprite)
+{
+    std::unordered_map<cSprite*, unsigned int>::iterator chunk_itr = m_member_chunk.find(sprite);
+
+    if (chunk_itr != m_member_chunk.end()) {
+        m_chunks[chunk_itr->second]->m_dirty = 1;
+    }
+}
+
+void cStatic_Render_Cache::Draw(void)
+{
+    if (m_chunks.empty()) {
+        return;
+    }
+
+    // video was reinitialized and the textures may have new ids
+    if (m_video_init_count != pVideo->m_init_count) {
+        for (cStatic_Render_Chunk_List::iterator itr = m_chunks.begin(); itr != m_chunks.end(); ++itr) {
+            (*itr)->m_dirty = 1;
+        }
+
+        m_video_init_count = pVideo->m_init_count;
+    }
+
+    const GL_rect camera_rect(pActive_Camera->m_x, pActive_Camera->m_y, static_cast<float>(game_res_w), static_cast<float>(game_res_h));
+
+    for (cStatic_Render_Chunk_List::iterator itr = m_chunks.begin(); itr != m_chunks.end(); ++itr) {
+        cStatic_Render_Chunk* chunk = (*itr);
+
+        if (chunk->m_dirty) {
+            Compile(chunk);
+        }
+
+        if (!chunk->m_display_list || !camera_rect.Intersects(chunk->m_rect)) {
+            continue;
+        }
+
+        cDisplay_List_Request* request = new cDisplay_List_Request();
+        request->m_display_list = chunk->m_display_list;
+        request->m_pos_z = chunk->m_pos_z;
+        request->m_no_camera = 0;
+        pRenderer->Add(request);
+    }
+}
+
+void cStatic_Render_Cache::Compile(cStatic_Render_Chunk* chunk)
+{
+    chunk->Delete_Display_List();
+    chunk->m_dirty = 0;
+
+    // drop members which changed too much
+    for (cSprite_List::iterator itr = chunk->m_members.begin(); itr != chunk->m_members.end();) {
+        cSprite* obj = (*itr);
+
+        if (!Is_Cacheable(obj) || obj->m_pos_z < chunk->m_band_z_min || obj->m_pos_z >= chunk->m_band_z_max) {
+            obj->m_render_cached = 0;
+            m_member_chunk.erase(obj);
+            itr = chunk->m_members.erase(itr);
+        }
+        else {
+            ++itr;
+        }
+    }
+
+    if (chunk->m_members.empty()) {
+        return;
+    }
+
+    // back to front for blending
+    std::sort(chunk->m_members.begin(), chunk->m_members.end(), static_render_zpos_sort());
+
+    chunk->m_pos_z = chunk->m_members.front()->m_pos_z;
+    chunk->m_display_list = glGenLists(1);
+
+    if (!chunk->m_display_list) {
+        return;
+    }
+
+    glNewList(chunk->m_display_list, GL_COMPILE);
+
+    GLuint bound_texture = 0;
+    Color bound_color = white;
+    bool first_rect = 1;
+    // compiled with the combine settings per vertex
+    const bool sprite_shader = pVideo->mp_sprite_shader != NULL;
+    bool combine_color_set = 0;
+    float bound_combine_color[3] = { 0.0f, 0.0f, 0.0f };
+
+    for (cSprite_List::iterator itr = chunk->m_members.begin(); itr != chunk->m_members.end(); ++itr) {
+        cSprite* obj = (*itr);
+
+        // let the sprite calculate its final position and size
+        cSurface_Request request;
+        obj->Draw_Image_Normal(&request);
+
+        const GL_rect rect(request.m_pos_x, request.m_pos_y, request.m_w * request.m_scale_x, request.m_h * request.m_scale_y);
+
+        if (first_rect) {
+            chunk->m_rect = rect;
+            first_rect = 0;
+        }
+        else {
+            const float right = std::max(chunk->m_rect.m_x + chunk->m_rect.m_w, rect.m_x + rect.m_w);
+            const float bottom = std::max(chunk->m_rect.m_y + chunk->m_rect.m_h, rect.m_y + rect.m_h);
+            chunk->m_rect.m_x = std::min(chunk->m_rect.m_x, rect.m_x);
+            chunk->m_rect.m_y = std::min(chunk->m_rect.m_y, rect.m_y);
+            chunk->m_rect.m_w = right - chunk->m_rect.m_x;
+            chunk->m_rect.m_h = bottom - chunk->m_rect.m_y;
+        }
+
+        // textures can only be changed outside of begin/end
+        if (bound_texture != request.m_texture_id) {
+            if (bound_texture) {
+                glEnd();
+            }
+
+            // the display list keeps the texture id
+            if (std::find(chunk->m_textures.begin(), chunk->m_textures.end(), obj->m_image) == chunk->m_textures.end()) {
+                pImage_Manager->Pin(obj->m_image);
+                chunk->m_textures.push_back(obj->m_image);
+            }
+
+            glBindTexture(GL_TEXTURE_2D, request.m_texture_id);
+            bound_texture = request.m_texture_id;
+            glBegin(GL_QUADS);
+        }
+
+        if (bound_color != request.m_color) {
+            glColor4ub(request.m_color.red, request.m_color.green, request.m_color.blue, request.m_color.alpha);
+            bound_color = request.m_color;
+        }
+
+        // the padding behind the texture is not drawn
+        const float tex_right = rect.m_x + (rect.m_w * request.m_tex_part_w);
+        const float tex_bottom = rect.m_y + (rect.m_h * request.m_tex_part_h);
+
+        if (sprite_shader) {
+            if (request.m_combine_type && (!combine_color_set || bound_combine_color[0] != request.m_combine_color[0] || bound_combine_color[1] != request.m_combine_color[1] || bound_combine_color[2] != request.m_combine_color[2])) {
+                glNormal3fv(request.m_combine_color);
+                bound_combine_color[0] = request.m_combine_color[0];
+                bound_combine_color[1] = request.m_combine_color[1];
+                bound_combine_color[2] = request.m_combine_color[2];
+                combine_color_set = 1;
+            }
+
+            cSprite_Shader::Add_Quad(rect.m_x, rect.m_y, tex_right, tex_bottom, request.m_pos_z, 0.0f, 0.0f, 1.0f, 1.0f, cSprite_Shader::Get_Combine_Mode(request.m_combine_type));
+            continue;
+        }
+
+        // top left
+        glTexCoord2f(0.0f, 0.0f);
+        glVertex3f(rect.m_x, rect.m_y, request.m_pos_z);
+        // top right
+        glTexCoord2f(1.0f, 0.0f);
+        glVertex3f(tex_right, rect.m_y, request.m_pos_z);
+        // bottom right
+        glTexCoord2f(1.0f, 1.0f);
+        glVertex3f(tex_right, tex_bottom, request.m_pos_z);
+        // bottom left
+        glTexCoord2f(0.0f, 1.0f);
+        glVertex3f(rect.m_x, tex_bottom, request.m_pos_z);
+    }
+
+    glEnd();
+
+    // clear color
+    if (bound_color != white) {
+        glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
+    }
+
+    glEndList();
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
@@ -0,0 +1,113 @@
+/***************************************************************************
+ * static_render_cache.hpp - prebuilt geometry for static level sprites
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_STATIC_RENDER_CACHE_HPP
+#define TSC_STATIC_RENDER_CACHE_HPP
+
+#include "../core/global_game.hpp"
+#include "../core/math/rect.hpp"
+#include "../objects/sprite.hpp"
+
+namespace TSC {
+
+    /* *** *** *** *** *** *** *** cStatic_Render_Chunk *** *** *** *** *** *** *** *** *** *** */
+
+    /* The static sprites of one screen sized area and z band
+     * compiled into a single OpenGL display list.
+    */
+    class cStatic_Render_Chunk {
+    public:
+        cStatic_Render_Chunk(void);
+        ~cStatic_Render_Chunk(void);
+
+        // Delete the display list and release its textures
+        void Delete_Display_List(void);
+
+        // the cached sprites sorted by z position
+        cSprite_List m_members;
+        // bounding drawing rect of all members
+        GL_rect m_rect;
+        // lowest member z position
+        float m_pos_z;
+        // z position range members must stay in
+        float m_band_z_min;
+        float m_band_z_max;
+
+        // compiled display list or 0
+        GLuint m_display_list;
+        // textures compiled into the display list, pinned until it is deleted
+        std::vector<cGL_Surface*> m_textures;
+        // if set the display list must be compiled again
+        bool m_dirty;
+    };
+
+    typedef vector<cStatic_Render_Chunk*> cStatic_Render_Chunk_List;
+
+    /* *** *** *** *** *** *** *** cStatic_Render_Cache *** *** *** *** *** *** *** *** *** *** */
+
+    /* Most level sprites are plain decoration and terrain that
+     * never moves or changes its image. Instead of creating a
+     * surface request for each of them every frame they are
+     * grouped by screen sized chunks and compiled into display
+     * lists which are drawn with one request per visible chunk.
+     *
+     * Chunks are also split into z bands at the z position of every
+     * sprite that is not cached, so that dynamic sprites are still
+     * drawn in front of or behind the cached ones as before.
+     *
+     * Cached sprites have cSprite::m_render_cached set and only draw
+     * their debug rects themselves. If a member changes it calls
+     * Invalidate() and its chunk is compiled again on the next
+     * Draw(), members that can not be cached anymore are dropped.
+    */
+    class cStatic_Render_Cache {
+    public:
+        cStatic_Render_Cache(void);
+        ~cStatic_Render_Cache(void);
+
+        /* Cache the suitable sprites of the given list
+         * script_code : level script, sprites referenced by UID in it are excluded
+        */
+        void Build(const cSprite_List& objects, const std::string& script_code = "");
+        // Uncache all sprites
+        void Clear(void);
+        // Remove the given sprite from its chunk
+        void Remove(cSprite* sprite);
+        // The given member sprite changed
+        void Invalidate(cSprite* sprite);
+
+        // Add a render request for each visible chunk
+        void Draw(void);
+
+        // Returns true if the given sprite can be cached
+        static bool Is_Cacheable(const cSprite* sprite);
+
+        // chunks
+        cStatic_Render_Chunk_List m_chunks;
+        // chunk index of each member
+        std::unordered_map<cSprite*, unsigned int> m_member_chunk;
+    private:
+        // Compile the display list of the given chunk
+        void Compile(cStatic_Render_Chunk* chunk);
+
+        // video initialization the display lists were compiled with
+        unsigned int m_video_init_count;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
@@ -23,7 +23,10 @@
 #include "img_manager.hpp"
 #include "../input/mouse.hpp"
 #include "../input/joystick.hpp"
+#include "../input/input_recorder.hpp"
 #include "../video/renderer.hpp"
+#include "../video/sprite_shader.hpp"
+#include "../video/screenshot.hpp"
 #include "../core/main.hpp"
 #include "../core/math/utilities.hpp"
 #include "../core/i18n.hpp"
@@ -32,6 +35,7 @@
 #include "../core/filesystem/resource_manager.hpp"
 #include "../core/filesystem/relative.hpp"
 #include "../gui/hud.hpp"
+#include "../core/camera.hpp"
 #include "video.hpp"
 
 using namespace std;
@@ -55,6 +59,9 @@ cVideo::cVideo(void)
 
     m_default_buffer = GL_BACK;
     m_max_texture_size = 512;
+    m_npot_textures = 0;
+    mp_sprite_shader = NULL;
+    mp_screenshot_capture = NULL;
 
     m_audio_init_failed = 0;
     m_joy_init_failed = 0;
@@ -65,15 +72,34 @@ cVideo::cVideo(void)
     glx_context = NULL;
 #endif
     m_render_thread = boost::thread();
+    m_render_pending = 0;
+    m_render_context_lent = 0;
+    m_render_exit = 0;
+    m_render_thread_ms = 0;
+    mp_loading_context = NULL;
 
     mp_cegui_renderer = NULL;
     mp_default_tooltip = NULL;
 
     m_initialised = 0;
+    m_init_count = 0;
 }
 
 cVideo::~cVideo(void)
 {
+    Stop_Render_Thread();
+
+    if (mp_sprite_shader) {
+        delete mp_sprite_shader;
+        mp_sprite_shader = NULL;
+    }
+
+    // writes the remaining captures
+    if (mp_screenshot_capture) {
+        delete mp_screenshot_capture;
+        mp_screenshot_capture = NULL;
+    }
+
     if (mp_default_tooltip) {
         CEGUI::WindowManager::getSingleton().destroyWindow(mp_default_tooltip);
         CEGUI::System::getSingleton().getDefaultGUIContext().setDefaultTooltipObject(0);
@@ -208,6 +234,7 @@ void cVideo::Init_Video(bool reload_textures_from_file /* = false */, bool use_p
 
     mp_window->create(videomode, CAPTION, style);
     mp_window->setMouseCursorVisible(false);
+    m_init_count++;
 
     if (use_preferences && pPreferences->m_video_vsync) {
         mp_window->setVerticalSyncEnabled(true);
@@ -219,10 +246,19 @@ void cVideo::Init_Video(bool reload_textures_from_file /* = false */, bool use_p
     if (m_initialised) {
         Loading_Screen_Init();
 
-        // save textures
-        pImage_Manager->Grab_Textures(reload_textures_from_file, 1);
+        /* all SFML contexts share their objects and the textures stay valid with the new window
+         * they only need to be saved if they are loaded again with a new size
+        */
+        if (reload_textures_from_file) {
+            pImage_Manager->Grab_Textures(1, 1);
+        }
+
+        // CEGUI render targets are not shared
         mp_cegui_renderer->grabTextures();
-        pImage_Manager->Delete_Hardware_Textures();
+
+        if (reload_textures_from_file) {
+            pImage_Manager->Delete_Hardware_Textures();
+        }
 
         // exit loading screen
         Loading_Screen_Exit();
@@ -248,7 +284,9 @@ void cVideo::Init_Video(bool reload_textures_from_file /* = false */, bool use_p
     // if reinitialization
     if (m_initialised) {
         // reset highest texture id
-        pImage_Manager->m_high_texture_id = 0;
+        if (reload_textures_from_file) {
+            pImage_Manager->m_high_texture_id = 0;
+        }
 
         /* restore GUI textures
          * must be the first CEGUI call after the grabTextures function
@@ -260,14 +298,12 @@ void cVideo::Init_Video(bool reload_textures_from_file /* = false */, bool use_p
 
         Loading_Screen_Init();
 
-        // initialize new image cache
+        // initialize new image cache and restore textures
         if (reload_textures_from_file) {
             Init_Image_Cache(0);
+            pImage_Manager->Restore_Textures(1);
         }
 
-        // restore textures
-        pImage_Manager->Restore_Textures(1);
-
         // Tell the HUD about the size change so it can adapt
         gp_hud->Screen_Size_Changed();
 
@@ -301,6 +337,30 @@ void cVideo::Init_Video(bool reload_textures_from_file /* = false */, bool use_p
 
         }
 
+        // non power of 2 textures are core since OpenGL 2.0
+        m_npot_textures = m_opengl_version >= 2.0f || gluCheckExtension(reinterpret_cast<const GLubyte*>("GL_ARB_texture_non_power_of_two"), glGetString(GL_EXTENSIONS));
+
+        if (!m_npot_textures) {
+            cout << "Info : Non power of 2 textures are not supported, textures are padded" << endl;
+        }
+
+        // GLSL is core since OpenGL 2.0
+        if (m_opengl_version >= 2.0f) {
+            mp_sprite_shader = new cSprite_Shader();
+
+            if (!mp_sprite_shader->Load()) {
+                delete mp_sprite_shader;
+                mp_sprite_shader = NULL;
+            }
+        }
+
+        if (!mp_sprite_shader) {
+            cout << "Info : Sprite shaders are not supported, sprites are drawn with the fixed-function pipeline" << endl;
+        }
+
+        mp_screenshot_capture = new cScreenshot_Capture();
+        mp_screenshot_capture->Init();
+
         // Init CEGUI
         Init_CEGUI();
 
@@ -547,9 +607,6 @@ void cVideo::Init_Image_Cache(bool recreate /* = 0 */)
             continue;
         }
 
-        // create final image
-        p_sf_image = Convert_To_Final_Software_Image(p_sf_image);
-
         // get final size for this resolution
         cSize_Int size = settings->Get_Surface_Size(p_sf_image);
         delete settings;
@@ -559,16 +616,20 @@ void cVideo::Init_Image_Cache(bool recreate /* = 0 */)
         // apply maximum texture size
         Apply_Max_Texture_Size(new_width, new_height);
 
+        // the cached image keeps the power of 2 padding
+        const int padded_width = Get_Power_of_2(p_sf_image->getSize().x);
+        const int padded_height = Get_Power_of_2(p_sf_image->getSize().y);
+
         // does not need to be downsampled
-        if (new_width >= p_sf_image->getSize().x && new_height >= p_sf_image->getSize().y) {
+        if (new_width >= padded_width && new_height >= padded_height) {
             delete p_sf_image;
             p_sf_image = NULL;
             continue;
         }
 
         // calculate block reduction
-        int reduce_block_x = p_sf_image->getSize().x / new_width;
-        int reduce_block_y = p_sf_image->getSize().y / new_height;
+        int reduce_block_x = padded_width / new_width;
+        int reduce_block_y = padded_height / new_height;
 
         // create downsampled image
         /* Old SDL TSC queried SDL for a "bytes per pixels" value, see
@@ -590,23 +651,17 @@ void cVideo::Init_Image_Cache(bool recreate /* = 0 */)
          * instead. For now, relying on SFML's docs, we just hardcode
          * 4 bytes as that is what SFML returns to us. */
         unsigned int image_bpp = 4; // 8 bits-per-color x 4 colors (RGBA) = 32 bits. 32 bits / 8 bits = 4 bytes.
-        unsigned char* image_downsampled = new unsigned char[new_width * new_height * image_bpp];
-        bool downsampled = Downscale_Image(static_cast<const unsigned char*>(p_sf_image->getPixelsPtr()), p_sf_image->getSize().x, p_sf_image->getSize().y, image_bpp, image_downsampled, reduce_block_x, reduce_block_y);
+        const unsigned char* image_downsampled = Get_Texture_Pixels(p_sf_image, reduce_block_x, reduce_block_y, new_width, new_height);
 
-        delete p_sf_image;
-
-        // if image is available
-        if (downsampled) {
-            // save as png
-            if (settings_file) {
-                cache_filename.replace_extension(".png");
-            }
-
-            // save image
-            Save_Surface(cache_filename, image_downsampled, new_width, new_height, image_bpp);
+        // save as png
+        if (settings_file) {
+            cache_filename.replace_extension(".png");
         }
 
-        delete[] image_downsampled;
+        // save image
+        Save_Surface(cache_filename, image_downsampled, new_width, new_height, image_bpp);
+
+        delete p_sf_image;
 
         // count files
         loaded_files++;
@@ -665,59 +720,112 @@ vector<cSize_Int> cVideo::Get_Supported_Resolutions(int flags /* = 0 */) const
 
 void cVideo::Make_GL_Context_Current(void)
 {
-// Not ported to SFML yet, because unused function
-// Part of the unfinished separate rendering thread implementation in TSC
-// (TSC_RENDER_THREAD_TEST macro).
-    throw(std::runtime_error("Make_GL_Context_Current() not implemented"));
-
-// scoped context lock here
-//#ifdef _WIN32
-//    if (wglGetCurrentContext() != wm_info.hglrc) {
-//        wglMakeCurrent(GetDC(wm_info.window), wm_info.hglrc);
-//    }
-//#elif __unix__
-//    if (glx_context != NULL) {
-//        glXMakeCurrent(wm_info.info.x11.gfxdisplay, wm_info.info.x11.window, glx_context);
-//    }
-//#elif __APPLE__
-//    // party time
-//#endif
+    mp_window->setActive(1);
 }
 
 void cVideo::Make_GL_Context_Inactive(void)
 {
-#ifdef _WIN32
-    wglMakeCurrent(NULL, NULL);
-#elif __unix__
-    // OLD glXMakeCurrent(wm_info.info.x11.gfxdisplay, None, NULL);
-#elif __APPLE__
-    // party time
-#endif
+    mp_window->setActive(0);
 }
 
-void cVideo::Render_From_Thread(void)
+void cVideo::Start_Render_Thread(void)
 {
+    if (m_render_thread.joinable()) {
+        return;
+    }
+
+    /* shares its textures with the window context
+     * creating it makes it active so switch back afterwards
+    */
+    mp_loading_context = new sf::Context();
     Make_GL_Context_Current();
 
-    pRenderer_current->Render();
-    // under linux with sofware mesa 7.9 it only showed the rendered output with SDL_GL_SwapBuffers()
+    m_render_pending = 0;
+    m_render_context_lent = 0;
+    m_render_exit = 0;
 
-    // update performance timer
-    //pFramerate->m_perf_timer[PERF_RENDER_GAME]->Update();
+    m_render_thread = boost::thread(&cVideo::Render_From_Thread, this);
+}
+
+void cVideo::Stop_Render_Thread(void)
+{
+    if (!m_render_thread.joinable()) {
+        return;
+    }
+
+    Render_Finish();
 
-    Make_GL_Context_Inactive();
+    {
+        boost::lock_guard<boost::mutex> lock(m_render_mutex);
+        m_render_exit = 1;
+    }
+
+    m_render_condition.notify_all();
+    m_render_thread.join();
+
+    delete mp_loading_context;
+    mp_loading_context = NULL;
+}
+
+void cVideo::Render_From_Thread(void)
+{
+    boost::unique_lock<boost::mutex> lock(m_render_mutex);
+
+    while (1) {
+        while (!m_render_pending && !m_render_exit) {
+            m_render_condition.wait(lock);
+        }
+
+        if (m_render_exit) {
+            break;
+        }
+
+        // pRenderer_current is only touched by the main thread after the frame is finished
+        lock.unlock();
+
+        uint32_t perf_ticks = TSC_GetTicks();
+
+        Make_GL_Context_Current();
+
+        pRenderer_current->Render();
+        // submit everything before the main thread takes over the context
+        glFlush();
+
+        Make_GL_Context_Inactive();
+
+        const uint32_t render_ms = TSC_GetTicks() - perf_ticks;
+
+        lock.lock();
+
+        // added to the performance timer by the main thread
+        m_render_thread_ms = render_ms;
+        m_render_pending = 0;
+        m_render_condition.notify_all();
+    }
 }
 
 void cVideo::Render(bool threaded /* = 0 */)
 {
     Render_Finish();
 
+    // textures drawn in this frame are already marked
+    pImage_Manager->Update_Residency();
+
+    // update performance timer
+    pFramerate->m_perf_timer[PERF_RENDER_WAIT]->Update();
+
     if (threaded) {
+        Start_Render_Thread();
+
+        /* CEGUI is not thread safe and is drawn here over the last
+         * game frame finished by the render thread */
         CEGUI::System::getSingleton().renderAllGUIContexts();
 
         // update performance timer
         pFramerate->m_perf_timer[PERF_RENDER_GUI]->Update();
 
+        mp_screenshot_capture->Frame_Finished();
+
         mp_window->display();
 
         // update performance timer
@@ -734,10 +842,24 @@ void cVideo::Render(bool threaded /* = 0 */)
             pRenderer->m_render_data.clear();
         }
 
-        // make main thread inactive
+        // the camera is updated while the frame renders
+        if (!pRenderer_current->m_camera_set) {
+            pRenderer_current->Set_Camera(pActive_Camera->m_x, pActive_Camera->m_y);
+        }
+
+        // hand the window context to the render thread
         Make_GL_Context_Inactive();
-        // start render thread
-        m_render_thread = boost::thread(&cVideo::Render_From_Thread, this);
+        // textures loaded meanwhile go into the shared context
+        mp_loading_context->setActive(1);
+
+        {
+            boost::lock_guard<boost::mutex> lock(m_render_mutex);
+            m_render_pending = 1;
+            m_render_context_lent = 1;
+        }
+
+        // render this frame while the next one is updated
+        m_render_condition.notify_all();
     }
     // single thread mode
     else {
@@ -752,6 +874,8 @@ void cVideo::Render(bool threaded /* = 0 */)
         // update performance timer
         pFramerate->m_perf_timer[PERF_RENDER_GUI]->Update();
 
+        mp_screenshot_capture->Frame_Finished();
+
         mp_window->display();
 
         // update performance timer
@@ -759,16 +883,32 @@ void cVideo::Render(bool threaded /* = 0 */)
     }
 }
 
+bool cVideo::Is_Render_Context_Lent(void)
+{
+    boost::lock_guard<boost::mutex> lock(m_render_mutex);
+    return m_render_context_lent;
+}
+
 void cVideo::Render_Finish(void)
 {
-#ifndef TSC_RENDER_THREAD_TEST
-    return;
-#endif
-    if (m_render_thread.joinable()) {
-        m_render_thread.join();
+    boost::unique_lock<boost::mutex> lock(m_render_mutex);
+
+    // the main thread owns the context
+    if (!m_render_context_lent) {
+        return;
     }
 
-    // todo : use opengl in only one thread
+    while (m_render_pending) {
+        m_render_condition.wait(lock);
+    }
+
+    m_render_context_lent = 0;
+
+    // update performance timer
+    pFramerate->m_perf_timer[PERF_RENDER_THREAD]->Add(m_render_thread_ms);
+
+    // textures uploaded through the loading context must be complete before they are drawn
+    glFlush();
     Make_GL_Context_Current();
 }
 
@@ -915,8 +1055,16 @@ cGL_Surface* cVideo::Load_GL_Surface(boost::filesystem::path filename, bool use_
 
     // load software image
     cSoftware_Image software_image = Load_Image(filename, use_settings, print_errors);
+
+    return Create_GL_Surface(filename, software_image, print_errors);
+}
+
+cGL_Surface* cVideo::Create_GL_Surface(const fs::path& filename, cSoftware_Image& software_image, bool print_errors /* = 1 */)
+{
     sf::Image* p_sf_image = software_image.m_sf_image;
     cImage_Settings_Data* settings = software_image.m_settings;
+    // freed by Create_Texture()
+    software_image.m_sf_image = NULL;
 
     // final surface
     cGL_Surface* image = NULL;
@@ -931,6 +1079,7 @@ cGL_Surface* cVideo::Load_GL_Surface(boost::filesystem::path filename, bool use_
         // apply settings
         settings->Apply(image);
         delete settings;
+        software_image.m_settings = NULL;
     }
     // without settings
     else {
@@ -949,45 +1098,83 @@ cGL_Surface* cVideo::Load_GL_Surface(boost::filesystem::path filename, bool use_
     return image;
 }
 
-/**
- * OpenGL only understands textures whose edges each have a length
- * that is a power of 2. This function ensures that our images fulfill
- * this requirement; if they don’t already have such edges, `p_sf_image'
- * is expanded to a size that fits the power-of-2 rule; the newly created
- * pixels are set to transparency.
- */
-sf::Image* cVideo::Convert_To_Final_Software_Image(sf::Image* p_sf_image) const
+const unsigned char* cVideo::Get_Texture_Pixels(const sf::Image* p_sf_image, unsigned int block_x, unsigned int block_y, unsigned int width, unsigned int height)
 {
-    // get power of two size
-    sf::Vector2u cursize = p_sf_image->getSize();
-    const unsigned int width = Get_Power_of_2(cursize.x);
-    const unsigned int height = Get_Power_of_2(cursize.y);
-
-    // if it needs to be changed
-    if (width != cursize.x || height != cursize.y) {
-        // create power of 2 surface
-        sf::Image* new_image = new sf::Image();
-        new_image->create(width, height, sf::Color::Transparent);
-        // copy over the old image into the new one (i.e., blit it onto it)
-        new_image->copy(*p_sf_image, 0, 0);
-        // delete original surface
-        delete p_sf_image;
-        // set new surface
-        p_sf_image = new_image;
+    const unsigned int image_width = p_sf_image->getSize().x;
+    const unsigned int image_height = p_sf_image->getSize().y;
+    // getPixelsPtr() guarantees 4 bytes per pixel
+    const unsigned char* pixels = static_cast<const unsigned char*>(p_sf_image->getPixelsPtr());
+
+    // already the final image
+    if (block_x == 1 && block_y == 1 && width == image_width && height == image_height) {
+        return pixels;
     }
 
-    return p_sf_image;
+    m_texture_buffer.resize(width * height * 4);
+    unsigned char* buffer = &m_texture_buffer[0];
+
+    // only padding
+    if (block_x == 1 && block_y == 1) {
+        const unsigned int row_size = width * 4;
+        const unsigned int copy_size = std::min(width, image_width) * 4;
+
+        for (unsigned int y = 0; y < height; y++) {
+            unsigned char* row = buffer + y * row_size;
+
+            if (y < image_height) {
+                memcpy(row, pixels + y * image_width * 4, copy_size);
+                memset(row + copy_size, 0, row_size - copy_size);
+            }
+            else {
+                memset(row, 0, row_size);
+            }
+        }
+
+        return buffer;
+    }
+
+    // average every block, the padding counts as transparent pixels
+    const unsigned int block_area = block_x * block_y;
+
+    for (unsigned int y = 0; y < height; y++) {
+        const unsigned int start_y = y * block_y;
+        const unsigned int end_y = std::min(start_y + block_y, image_height);
+
+        for (unsigned int x = 0; x < width; x++) {
+            const unsigned int start_x = x * block_x;
+            const unsigned int end_x = std::min(start_x + block_x, image_width);
+            // start the sum at the rounding value
+            unsigned int sum[4] = { block_area >> 1, block_area >> 1, block_area >> 1, block_area >> 1 };
+
+            for (unsigned int v = start_y; v < end_y; v++) {
+                const unsigned char* pixel = pixels + (v * image_width + start_x) * 4;
+
+                for (unsigned int u = start_x; u < end_x; u++) {
+                    sum[0] += pixel[0];
+                    sum[1] += pixel[1];
+                    sum[2] += pixel[2];
+                    sum[3] += pixel[3];
+                    pixel += 4;
+                }
+            }
+
+            unsigned char* dest = buffer + (y * width + x) * 4;
+            dest[0] = sum[0] / block_area;
+            dest[1] = sum[1] / block_area;
+            dest[2] = sum[2] / block_area;
+            dest[3] = sum[3] / block_area;
+        }
+    }
+
+    return buffer;
 }
 
-cGL_Surface* cVideo::Create_Texture(sf::Image* p_sf_image, bool mipmap /* = 0 */, unsigned int force_width /* = 0 */, unsigned int force_height /* = 0 */) const
+cGL_Surface* cVideo::Create_Texture(sf::Image* p_sf_image, bool mipmap /* = 0 */, unsigned int force_width /* = 0 */, unsigned int force_height /* = 0 */)
 {
     if (!p_sf_image) {
         return NULL;
     }
 
-    // create final image
-    p_sf_image = Convert_To_Final_Software_Image(p_sf_image);
-
     /* todo : Make this a render request because it forces an early thread render finish as opengl commands are used directly.
      * Reduces performance if the render thread is on. It's usually called from the text rendering in cTimeDisplay::Update.
     */
@@ -1009,8 +1196,14 @@ cGL_Surface* cVideo::Create_Texture(sf::Image* p_sf_image, bool mipmap /* = 0 */
         pImage_Manager->m_high_texture_id = image_num;
     }
 
-    int width = p_sf_image->getSize().x;
-    int height = p_sf_image->getSize().y;
+    const unsigned int image_width = p_sf_image->getSize().x;
+    const unsigned int image_height = p_sf_image->getSize().y;
+    // the image is drawn as if padded with transparent pixels to a power of 2 size
+    const unsigned int padded_width = Get_Power_of_2(image_width);
+    const unsigned int padded_height = Get_Power_of_2(image_height);
+
+    int width = padded_width;
+    int height = padded_height;
 
     // forced size is set
     if (force_width > 0 && force_height > 0) {
@@ -1031,24 +1224,40 @@ cGL_Surface* cVideo::Create_Texture(sf::Image* p_sf_image, bool mipmap /* = 0 */
     // check if the image size is greater than the maximum texture size
     Apply_Max_Texture_Size(texture_width, texture_height);
 
-    // scale to new size
-    if (texture_width != p_sf_image->getSize().x || texture_height != p_sf_image->getSize().y) {
-        int reduce_block_x = p_sf_image->getSize().x / texture_width;
-        int reduce_block_y = p_sf_image->getSize().y / texture_height;
+    // downscale factor of the padded image
+    unsigned int reduce_block_x = padded_width / texture_width;
+    unsigned int reduce_block_y = padded_height / texture_height;
 
-        // create scaled image
-        unsigned char* new_pixels = static_cast<unsigned char*>(malloc(texture_width * texture_height * 4));
-        Downscale_Image(static_cast<const unsigned char*>(p_sf_image->getPixelsPtr()), p_sf_image->getSize().x, p_sf_image->getSize().y, 8 /* getPixelsPtr() guarantees 8 BPP */, new_pixels, reduce_block_x, reduce_block_y);
+    if (reduce_block_x < 1) {
+        reduce_block_x = 1;
+    }
+    if (reduce_block_y < 1) {
+        reduce_block_y = 1;
+    }
 
-        sf::Image* p_new_image = new sf::Image();
-        p_new_image->create(texture_width, texture_height, static_cast<const uint8_t*>(new_pixels));
+    // padded and downscaled size
+    const unsigned int scaled_width = padded_width / reduce_block_x;
+    const unsigned int scaled_height = padded_height / reduce_block_y;
 
-        delete p_sf_image;
-        p_sf_image = p_new_image;
+    // uploaded size
+    unsigned int upload_width = scaled_width;
+    unsigned int upload_height = scaled_height;
 
-        free(new_pixels);
+    /* without the padding
+     * the image keeps one transparent column and row of it if there was any
+     * so that the far edges are filtered like with the whole padding
+    */
+    if (m_npot_textures) {
+        upload_width = std::min((image_width + reduce_block_x - 1) / reduce_block_x + 1, scaled_width);
+        upload_height = std::min((image_height + reduce_block_y - 1) / reduce_block_y + 1, scaled_height);
     }
 
+    const unsigned char* pixels = Get_Texture_Pixels(p_sf_image, reduce_block_x, reduce_block_y, upload_width, upload_height);
+
+    // only the part covered by the texture is drawn
+    const float tex_part_w = static_cast<float>(upload_width) / scaled_width;
+    const float tex_part_h = static_cast<float>(upload_height) / scaled_height;
+
     // use the generated texture
     glBindTexture(GL_TEXTURE_2D, image_num);
 
@@ -1058,18 +1267,18 @@ cGL_Surface* cVideo::Create_Texture(sf::Image* p_sf_image, bool mipmap /* = 0 */
     // set texture magnification function
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
     // upload to OpenGL texture
-    Create_GL_Texture(texture_width, texture_height, p_sf_image->getPixelsPtr(), mipmap);
-
-    // unset pixel store mode
-    // OLD (see corresponding call further above) glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    Create_GL_Texture(upload_width, upload_height, pixels, mipmap);
 
+    // the pixels may be the image itself
     delete p_sf_image;
 
     // create OpenGL surface class
     cGL_Surface* image = new cGL_Surface();
     image->m_image = image_num;
-    image->m_tex_w = texture_width;
-    image->m_tex_h = texture_height;
+    image->m_tex_w = upload_width;
+    image->m_tex_h = upload_height;
+    image->m_tex_part_w = tex_part_w;
+    image->m_tex_part_h = tex_part_h;
     image->m_start_w = static_cast<float>(width);
     image->m_start_h = static_cast<float>(height);
     image->m_w = image->m_start_w;
@@ -1415,22 +1624,14 @@ bool cVideo::Downscale_Image(const unsigned char* const orig, int width, int hei
 
 void cVideo::Save_Screenshot(void)
 {
-    Render_Finish();
-
     fs::path filename;
 
     for (unsigned int i = 1; i < 1000; i++) {
         filename = pResource_Manager->Get_User_Screenshot_Directory() / utf8_to_path(int_to_string(i) + ".png");
 
-        if (!File_Exists(filename)) {
-            // create image data
-            GLubyte* data = new GLubyte[pPreferences->m_video_screen_w * pPreferences->m_video_screen_h * 3];
-            // read opengl screen
-            glReadPixels(0, 0, pPreferences->m_video_screen_w, pPreferences->m_video_screen_h, GL_RGB, GL_UNSIGNED_BYTE, static_cast<GLvoid*>(data));
-            // save
-            Save_Surface(filename, data, pPreferences->m_video_screen_w, pPreferences->m_video_screen_h, 3, 1);
-            // clear data
-            delete[] data;
+        if (!File_Exists(filename) && !mp_screenshot_capture->Is_Pending(filename)) {
+            // read and written in the background
+            mp_screenshot_capture->Request(filename);
 
             // show info
             gp_hud->Set_Text("Screenshot " + int_to_string(i) + _(" saved"));
@@ -1531,6 +1732,20 @@ static void Handle_Important_Events(const sf::Event& event)
         break;
     default: break;
     }
+
+    // a replay sets the input states from the recording
+    if (pInput_Recorder && pInput_Recorder->Is_Replaying()) {
+        return;
+    }
+
+    /* Input states are updated here for every read event, even when
+     * a blocking loop reads it, so keys never get stuck.
+    */
+    cInput_Recorder::Update_Input_States(event);
+
+    if (pInput_Recorder) {
+        pInput_Recorder->Record_Event(event);
+    }
 }
 
 bool cVideo::PollEvent(sf::Event& event) {
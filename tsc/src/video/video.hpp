@@ -20,6 +20,8 @@
 #include "../core/global_basic.hpp"
 #include "../core/global_game.hpp"
 #include "../video/color.hpp"
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
 
 namespace TSC {
 
@@ -56,7 +58,7 @@ namespace TSC {
         ~cVideo(void);
 
         /* Initialize the screen surface
-         * reload_textures_from_file: if set reloads all textures from the original file
+         * reload_textures_from_file: if set reloads all textures from the original file, otherwise they are kept
          * use_preferences: if set use user preferences settings
          * shows an error if failed and exits
          * Calls several subinitialisations.
@@ -87,12 +89,27 @@ namespace TSC {
         // make the opengl context inactive for the current thread
         void Make_GL_Context_Inactive(void);
 
-        // Render. Should be called from a thread
+        /* Start the render thread if not already running
+         * From then on the window context is lent to it while it renders a frame.
+        */
+        void Start_Render_Thread(void);
+        // Finish the current frame and stop the render thread
+        void Stop_Render_Thread(void);
+        // Render thread loop. Renders pRenderer_current each time a frame is handed over
         void Render_From_Thread(void);
-        // Render game, GUI and swap the opengl buffer
+        /* Render game, GUI and swap the opengl buffer
+         * threaded : if set the GUI is rendered over the last finished frame and
+         * the game is rendered by the render thread while the next frame is updated
+        */
         void Render(bool threaded = 0);
-        // Finish thread rendering
+        /* Wait until the render thread finished its frame and take the window context back
+         * Must be called before using OpenGL state of the window outside of rendering.
+        */
         void Render_Finish(void);
+        /* Returns true if the render thread may use the window context
+         * OpenGL objects must not be deleted by the main thread then.
+        */
+        bool Is_Render_Context_Lent(void);
 
         // Toggle fullscreen video mode ( new mode is set to preferences )
         void Toggle_Fullscreen(void);
@@ -130,21 +147,31 @@ namespace TSC {
         */
         cGL_Surface* Load_GL_Surface(boost::filesystem::path filename, bool use_settings = 1, bool print_errors = 1);
 
-        /* Convert to a scaled software image with a power of 2 size and 32 bits per pixel.
-         * Conversion only happens if needed.
-         * surface : the source image which gets converted if needed
-         * Do not use p_sf_image after calling this function anymore,
-         * use the returned new image instead. p_sf_image is freed by
-         * this function automatically.
+        /* Create the hardware image from a loaded software image
+         * Only the software image can be loaded on other threads, the texture is created here.
+         * filename : absolute image path set to the surface
+         * software_image : from Load_Image(), its image and settings are freed
+         * The returned image should be deleted if not used anymore
+        */
+        cGL_Surface* Create_GL_Surface(const boost::filesystem::path& filename, cSoftware_Image& software_image, bool print_errors = 1);
+
+        /* Return the image pixels padded with transparent pixels to a power of 2 size and downscaled
+         * Padding and downscaling are done in one pass into a buffer which is reused by the next call.
+         * If the image needs no changes its own pixels are returned.
+         * block_x/y : downscale factor of the padded image
+         * width/height : size of the returned pixels, smaller than the padded and downscaled size crops the padding
         */
-        sf::Image* Convert_To_Final_Software_Image(sf::Image* p_sf_image) const;
+        const unsigned char* Get_Texture_Pixels(const sf::Image* p_sf_image, unsigned int block_x, unsigned int block_y, unsigned int width, unsigned int height);
 
         /* Convert an SFML image to a GL image
+         * The image is drawn as if padded to a power of 2 size. If
+         * supported the padding is not uploaded and only the part
+         * covered by the texture is drawn.
          * surface : the source SFML image which will be auto-deleted.
          * mipmap : create texture mipmaps
          * force_width/height : force the given width and height
         */
-        cGL_Surface* Create_Texture(sf::Image* p_sf_image, bool mipmap = 0, unsigned int force_width = 0, unsigned int force_height = 0) const;
+        cGL_Surface* Create_Texture(sf::Image* p_sf_image, bool mipmap = 0, unsigned int force_width = 0, unsigned int force_height = 0);
 
         /* Copy pixels to the bound GL texture
          * mipmap : create texture mipmaps
@@ -186,7 +213,7 @@ namespace TSC {
         */
         bool Downscale_Image(const unsigned char* const orig, int width, int height, int channels, unsigned char* resampled, int block_size_x, int block_size_y) const;
 
-        // Save an image of the current screen
+        // Save an image of the next finished frame to the screenshot directory
         void Save_Screenshot(void);
         // Save data as png image
         void Save_Surface(const boost::filesystem::path& filename, const unsigned char* data, unsigned int width, unsigned int height, unsigned int bpp = 4, bool reverse_data = 0) const;
@@ -211,6 +238,12 @@ namespace TSC {
         GLint m_default_buffer;
         // max texture size
         GLint m_max_texture_size;
+        // if textures can have sizes which are not a power of 2
+        bool m_npot_textures;
+        // sprite shader program or NULL if sprites are drawn with the fixed-function pipeline
+        cSprite_Shader* mp_sprite_shader;
+        // saves screenshots and continuous captures
+        cScreenshot_Capture* mp_screenshot_capture;
 
         // if audio initialization failed
         bool m_audio_init_failed;
@@ -233,6 +266,21 @@ namespace TSC {
 #endif
         // rendering thread
         boost::thread m_render_thread;
+        boost::mutex m_render_mutex;
+        // signaled when a frame is handed to or finished by the render thread
+        boost::condition_variable m_render_condition;
+        // set while the render thread renders pRenderer_current
+        bool m_render_pending;
+        // set while the main thread has lent the window context to the render thread
+        bool m_render_context_lent;
+        // if set the render thread exits
+        bool m_render_exit;
+        // milliseconds the render thread needed for the last frame
+        uint32_t m_render_thread_ms;
+        /* active in the main thread while the render thread owns the window context
+         * shares its textures with it
+        */
+        sf::Context* mp_loading_context;
 
         // GUI System
         CEGUI::OpenGLRenderer* mp_cegui_renderer;
@@ -253,8 +301,15 @@ namespace TSC {
         // initialize the up/down scaling value for the current resolution ( image/mouse scale )
         void Init_Resolution_Scale(void) const;
 
+        // pixels for texture uploads, see Get_Texture_Pixels()
+        std::vector<unsigned char> m_texture_buffer;
+
         // if set video is initialized successfully
         bool m_initialised;
+        /* amount of Init_Video() calls
+         * textures may have been loaded again with new ids since the last one
+        */
+        unsigned int m_init_count;
     };
 
     /* Draw an Screen Fadeout Effect